@@ -0,0 +1,131 @@
+#include "benchmark.hpp"
+
+#include <limitless/models/animation_blender.hpp>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr uint32_t BONE_COUNT = 100;
+    constexpr uint32_t CLIP_COUNT = 4;
+    constexpr uint32_t KEY_COUNT = 120;
+    constexpr uint32_t FRAMES = 1000;
+    constexpr double FRAME_TIME = 1.0 / 60.0;
+
+    /**
+     * Rig of 100 bones as five chains of twenty under single root
+     */
+    std::shared_ptr<SkeletalModel> makeRig() {
+        std::vector<Bone> bones;
+        bones.reserve(BONE_COUNT);
+        for (uint32_t i = 0; i < BONE_COUNT; ++i) {
+            bones.emplace_back(i, "bone" + std::to_string(i), glm::mat4{1.0f});
+            bones.back().joint_index = i;
+        }
+
+        std::vector<Animation> animations;
+        for (uint32_t clip = 0; clip < CLIP_COUNT; ++clip) {
+            std::vector<AnimationNode> nodes;
+            nodes.reserve(BONE_COUNT);
+
+            for (auto& bone : bones) {
+                std::vector<KeyFrame<glm::vec3>> positions;
+                std::vector<KeyFrame<glm::fquat>> rotations;
+                std::vector<KeyFrame<glm::vec3>> scales;
+
+                for (uint32_t k = 0; k < KEY_COUNT; ++k) {
+                    const auto t = static_cast<double>(k);
+                    const auto f = static_cast<float>(k + clip * 7 + bone.index) * 0.05f;
+                    positions.emplace_back(glm::vec3{glm::sin(f), glm::cos(f), 0.1f}, t);
+                    rotations.emplace_back(glm::angleAxis(f, glm::normalize(glm::vec3{1.0f, 2.0f, static_cast<float>(clip)})), t);
+                    scales.emplace_back(glm::vec3{1.0f}, t);
+                }
+
+                nodes.emplace_back(std::move(positions), std::move(rotations), std::move(scales), bone);
+            }
+
+            animations.emplace_back("clip" + std::to_string(clip), static_cast<double>(KEY_COUNT - 1), 30.0, std::move(nodes));
+        }
+
+        Tree<uint32_t> root {0};
+        for (uint32_t chain = 0; chain < 5; ++chain) {
+            Tree<uint32_t>* node = &root;
+            for (uint32_t i = 0; i < BONE_COUNT / 5; ++i) {
+                const auto bone = 1 + chain * (BONE_COUNT / 5) + i;
+                if (bone >= BONE_COUNT) {
+                    break;
+                }
+                node->add(bone);
+                node = &(*node)[node->size() - 1];
+            }
+        }
+
+        std::unordered_map<std::string, uint32_t> bone_map;
+        for (const auto& bone : bones) {
+            bone_map.emplace(bone.name, bone.index);
+        }
+
+        return std::make_shared<SkeletalModel>(
+            std::vector<std::shared_ptr<AbstractMesh>>{},
+            std::vector<std::shared_ptr<ms::Material>>{},
+            std::move(bones),
+            std::move(bone_map),
+            std::vector<Tree<uint32_t>>{std::move(root)},
+            std::move(animations),
+            "rig"
+        );
+    }
+}
+
+int main() {
+    const auto model = makeRig();
+    const auto& animations = model->getAnimations();
+
+    std::vector<glm::mat4> global(model->getFlatSkeleton().size(), glm::mat4{1.0f});
+    std::vector<glm::mat4> palette(BONE_COUNT, glm::mat4{1.0f});
+
+    std::printf("%u bones, %u clips, %u frames per iteration\n", BONE_COUNT, CLIP_COUNT, FRAMES);
+
+    std::vector<AnimationNode::Cursor> cursors(BONE_COUNT);
+    measure("single clip", 20, [&] {
+        double time = 0.0;
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time += FRAME_TIME;
+            const auto& anim = animations[0];
+            model->evaluatePose(anim, glm::mod(time * anim.tps, anim.duration), cursors, global, palette);
+            doNotOptimize(palette);
+        }
+    });
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    for (const auto& animation : animations) {
+        blender.add(animation, 0.25f);
+    }
+
+    measure("4-clip blend", 20, [&] {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            blender.advance(FRAME_TIME);
+            blender.evaluate(*model, global, palette);
+            doNotOptimize(palette);
+        }
+    });
+
+    auto upper = std::make_shared<BoneMask>(BoneMask::subtree(*model, "bone1"));
+    AnimationBlender layered;
+    layered.initialize(*model);
+    layered.add(animations[0], 1.0f);
+    layered.add(animations[1], 1.0f, upper);
+    layered.add(animations[2], 0.5f);
+    layered.add(animations[3], 0.3f, {}, true);
+
+    measure("4-clip layered with mask and additive", 20, [&] {
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            layered.advance(FRAME_TIME);
+            layered.evaluate(*model, global, palette);
+            doNotOptimize(palette);
+        }
+    });
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "benchmark.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr uint32_t BONE_COUNT = 150;
+    constexpr uint32_t KEY_COUNT = 3000; // 100 seconds of 30 fps mocap
+    constexpr uint32_t FRAMES = 600;
+    constexpr double FRAME_TICKS = 0.5;
+
+    Animation makeClip(std::vector<Bone>& bones) {
+        std::vector<AnimationNode> nodes;
+        nodes.reserve(bones.size());
+
+        for (auto& bone : bones) {
+            std::vector<KeyFrame<glm::vec3>> positions;
+            std::vector<KeyFrame<glm::fquat>> rotations;
+            std::vector<KeyFrame<glm::vec3>> scales;
+
+            const auto phase = static_cast<float>(bone.index) * 0.1f;
+            for (uint32_t k = 0; k < KEY_COUNT; ++k) {
+                const auto t = static_cast<double>(k);
+                const auto f = static_cast<float>(k) * 0.02f + phase;
+                positions.emplace_back(glm::vec3{glm::sin(f) * 0.2f, 1.0f + glm::cos(f * 0.5f) * 0.1f, 0.0f}, t);
+                rotations.emplace_back(glm::angleAxis(glm::sin(f) * 1.2f, glm::normalize(glm::vec3{1.0f, glm::cos(phase), 0.3f})), t);
+                scales.emplace_back(glm::vec3{1.0f}, t);
+            }
+
+            nodes.emplace_back(std::move(positions), std::move(rotations), std::move(scales), bone);
+        }
+
+        return {"mocap", static_cast<double>(KEY_COUNT - 1), 30.0, std::move(nodes)};
+    }
+
+    double sampleAll(const Animation& clip, std::vector<AnimationNode::Cursor>& cursors) {
+        double checksum = 0.0;
+        double time = 0.0;
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time = glm::mod(time + FRAME_TICKS, clip.duration);
+            for (size_t i = 0; i < clip.nodes.size(); ++i) {
+                checksum += clip.nodes[i].positionLerp(time, cursors[i])->x;
+                checksum += clip.nodes[i].rotationLerp(time, cursors[i])->w;
+                checksum += clip.nodes[i].scalingLerp(time, cursors[i])->y;
+            }
+        }
+        return checksum;
+    }
+}
+
+int main() {
+    std::vector<Bone> bones;
+    bones.reserve(BONE_COUNT);
+    for (uint32_t i = 0; i < BONE_COUNT; ++i) {
+        bones.emplace_back(i, "bone" + std::to_string(i), glm::mat4{1.0f});
+    }
+
+    const auto original = makeClip(bones);
+    auto compressed = makeClip(bones);
+
+    const auto begin = std::chrono::steady_clock::now();
+    compressed.compress({});
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto original_usage = original.getMemoryUsage();
+    const auto compressed_usage = compressed.getMemoryUsage();
+
+    std::printf("%u bones, %u keys per track\n", BONE_COUNT, KEY_COUNT);
+    std::printf("original   %10.2f MB\n", static_cast<double>(original_usage) / (1024.0 * 1024.0));
+    std::printf("compressed %10.2f MB (%.1fx smaller, compressed in %.1f ms)\n",
+                static_cast<double>(compressed_usage) / (1024.0 * 1024.0),
+                static_cast<double>(original_usage) / static_cast<double>(compressed_usage),
+                std::chrono::duration<double, std::milli>(end - begin).count());
+
+    // error of compressed sampling against original keyframes
+    float position_error = 0.0f;
+    float rotation_error = 0.0f;
+    for (double time = 0.0; time < original.duration; time += 0.37) {
+        for (size_t i = 0; i < original.nodes.size(); ++i) {
+            const auto p0 = *original.nodes[i].positionLerp(time);
+            const auto p1 = *compressed.nodes[i].positionLerp(time);
+            const auto d = glm::abs(p0 - p1);
+            position_error = std::max(position_error, std::max(d.x, std::max(d.y, d.z)));
+
+            const auto r0 = *original.nodes[i].rotationLerp(time);
+            const auto r1 = *compressed.nodes[i].rotationLerp(time);
+            rotation_error = std::max(rotation_error, 2.0f * std::acos(std::min(1.0f, std::abs(glm::dot(r0, r1)))));
+        }
+    }
+    std::printf("max position error %f, max rotation error %f rad\n", position_error, rotation_error);
+
+    std::vector<AnimationNode::Cursor> cursors(BONE_COUNT);
+    measure("keyframes with cursors", 20, [&] {
+        doNotOptimize(sampleAll(original, cursors));
+    });
+
+    measure("compressed tracks", 20, [&] {
+        doNotOptimize(sampleAll(compressed, cursors));
+    });
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "benchmark.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr uint32_t BONE_COUNT = 150;
+    constexpr uint32_t KEY_COUNT = 6000; // ~100 seconds of 60 fps mocap
+    constexpr double TPS = 60.0;
+    constexpr double FRAME_TIME = 1.0 / 60.0;
+
+    /**
+     * Previous linear scan from keyframe 0 for reference
+     */
+    template<typename T>
+    size_t linearKeyframe(const std::vector<KeyFrame<T>>& keys, double time) {
+        for (size_t i = 0; i < keys.size() - 1; ++i) {
+            if (time <= keys[i + 1].time) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    std::vector<AnimationNode> makeNodes(std::vector<Bone>& bones) {
+        std::vector<AnimationNode> nodes;
+        nodes.reserve(bones.size());
+
+        for (auto& bone : bones) {
+            std::vector<KeyFrame<glm::vec3>> positions;
+            std::vector<KeyFrame<glm::fquat>> rotations;
+            std::vector<KeyFrame<glm::vec3>> scales;
+
+            for (uint32_t k = 0; k < KEY_COUNT; ++k) {
+                const auto t = static_cast<double>(k);
+                const auto f = static_cast<float>(k) * 0.01f;
+                positions.emplace_back(glm::vec3{glm::sin(f), glm::cos(f), f}, t);
+                rotations.emplace_back(glm::angleAxis(f, glm::vec3{0.0f, 1.0f, 0.0f}), t);
+                scales.emplace_back(glm::vec3{1.0f}, t);
+            }
+
+            nodes.emplace_back(std::move(positions), std::move(rotations), std::move(scales), bone);
+        }
+
+        return nodes;
+    }
+}
+
+int main() {
+    std::vector<Bone> bones;
+    bones.reserve(BONE_COUNT);
+    for (uint32_t i = 0; i < BONE_COUNT; ++i) {
+        bones.emplace_back(i, "bone" + std::to_string(i), glm::mat4{1.0f});
+    }
+
+    const auto nodes = makeNodes(bones);
+    const auto duration = static_cast<double>(KEY_COUNT - 1);
+
+    // samples 600 consecutive frames spread over the whole clip, wrapping around at the end
+    constexpr uint32_t FRAMES = 600;
+    double start_time = 0.0;
+    const auto next_start = [&] {
+        start_time = glm::mod(start_time + 997.0, duration);
+        return start_time;
+    };
+
+    std::printf("%u bones, %u keys per track, %u frames per iteration\n", BONE_COUNT, KEY_COUNT, FRAMES);
+
+    measure("linear scan (previous)", 10, [&] {
+        auto time = next_start();
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time = glm::mod(time + FRAME_TIME * TPS, duration);
+            for (const auto& node : nodes) {
+                doNotOptimize(linearKeyframe(node.positions, time));
+                doNotOptimize(linearKeyframe(node.rotations, time));
+                doNotOptimize(linearKeyframe(node.scales, time));
+            }
+        }
+    });
+
+    measure("binary search", 10, [&] {
+        auto time = next_start();
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time = glm::mod(time + FRAME_TIME * TPS, duration);
+            for (const auto& node : nodes) {
+                doNotOptimize(node.findPositionKeyframe(time));
+                doNotOptimize(node.findRotationKeyframe(time));
+                doNotOptimize(node.findScalingKeyframe(time));
+            }
+        }
+    });
+
+    std::vector<AnimationNode::Cursor> cursors(nodes.size());
+    measure("cached cursors", 10, [&] {
+        auto time = next_start();
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time = glm::mod(time + FRAME_TIME * TPS, duration);
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                doNotOptimize(nodes[i].findPositionKeyframe(time, cursors[i].position));
+                doNotOptimize(nodes[i].findRotationKeyframe(time, cursors[i].rotation));
+                doNotOptimize(nodes[i].findScalingKeyframe(time, cursors[i].scaling));
+            }
+        }
+    });
+
+    measure("cached cursors with interpolation", 10, [&] {
+        auto time = next_start();
+        for (uint32_t f = 0; f < FRAMES; ++f) {
+            time = glm::mod(time + FRAME_TIME * TPS, duration);
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                doNotOptimize(nodes[i].positionLerp(time, cursors[i]));
+                doNotOptimize(nodes[i].rotationLerp(time, cursors[i]));
+                doNotOptimize(nodes[i].scalingLerp(time, cursors[i]));
+            }
+        }
+    });
+
+    // verifies cursor lookups against stateless search
+    std::vector<AnimationNode::Cursor> check(nodes.size());
+    for (double time = 0.0; time < duration * 2.0; time += 0.37) {
+        const auto t = glm::mod(time, duration);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].findPositionKeyframe(t, check[i].position) != linearKeyframe(nodes[i].positions, t)) {
+                std::printf("mismatch at time %f\n", t);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
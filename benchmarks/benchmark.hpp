@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace LimitlessBenchmark {
+    /**
+     * Runs function specified number of times and prints average time per iteration
+     */
+    template<typename F>
+    double measure(const std::string& name, uint32_t iterations, F&& function) {
+        // warm up
+        function();
+
+        const auto begin = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            function();
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto ms = std::chrono::duration<double, std::milli>(end - begin).count() / iterations;
+        std::printf("%-48s %12.4f ms\n", name.c_str(), ms);
+
+        return ms;
+    }
+
+    /**
+     * Prevents compiler from optimizing out computed value
+     */
+    template<typename T>
+    void doNotOptimize(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+}
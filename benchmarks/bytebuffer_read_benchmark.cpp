@@ -0,0 +1,120 @@
+#include "benchmark.hpp"
+
+#include <limitless/util/bytebuffer.hpp>
+
+#include <cstring>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr size_t MIN_FILE_SIZE = 64 * 1024;
+    constexpr size_t MAX_FILE_SIZE = 4 * 1024 * 1024;
+
+    // erasing reader is quadratic, it is not run on files that take seconds to read
+    constexpr size_t MAX_ERASING_FILE_SIZE = 2 * 1024 * 1024;
+
+    // material-like record: name, a few properties and shader snippet
+    struct Record {
+        std::string name;
+        uint8_t shading {};
+        std::vector<float> properties;
+        std::string code;
+    };
+
+    Record makeRecord(size_t index) {
+        Record record;
+        record.name = "material_" + std::to_string(index);
+        record.shading = static_cast<uint8_t>(index % 4);
+        record.properties.assign(8, static_cast<float>(index));
+        record.code.assign(1024, 'a' + static_cast<char>(index % 26));
+        return record;
+    }
+
+    ByteBuffer makeFile(size_t size) {
+        ByteBuffer buffer;
+
+        size_t count = 0;
+        while (buffer.size() < size) {
+            const auto record = makeRecord(count++);
+            buffer << record.name << record.shading << record.properties << record.code;
+        }
+
+        ByteBuffer file;
+        file << count << buffer;
+        return file;
+    }
+
+    // reading as ByteBuffer did it before, every read erases bytes from the front of buffer
+    class ErasingReader {
+    private:
+        std::vector<std::byte> buffer;
+
+        void read(std::byte* bytes, size_t size) {
+            std::copy(buffer.begin(), buffer.begin() + size, bytes);
+            buffer.erase(buffer.begin(), buffer.begin() + size);
+        }
+    public:
+        explicit ErasingReader(const ByteBuffer& file)
+            : buffer {file.begin(), file.end()} {
+        }
+
+        template<typename T>
+        ErasingReader& operator>>(T& value) {
+            read(reinterpret_cast<std::byte*>(&value), sizeof(T));
+            return *this;
+        }
+
+        ErasingReader& operator>>(std::string& str) {
+            size_t size {};
+            *this >> size;
+            str.resize(size);
+            read(reinterpret_cast<std::byte*>(str.data()), size);
+            return *this;
+        }
+
+        ErasingReader& operator>>(std::vector<float>& v) {
+            size_t size {};
+            *this >> size;
+            for (size_t i = 0; i < size; ++i) {
+                float value {};
+                *this >> value;
+                v.emplace_back(value);
+            }
+            return *this;
+        }
+    };
+
+    template<typename Reader>
+    std::vector<Record> readFile(Reader& reader) {
+        size_t count {};
+        reader >> count;
+
+        std::vector<Record> records(count);
+        for (auto& record : records) {
+            reader >> record.name >> record.shading >> record.properties >> record.code;
+        }
+        return records;
+    }
+}
+
+int main() {
+    for (auto size = MIN_FILE_SIZE; size <= MAX_FILE_SIZE; size *= 4) {
+        const auto file = makeFile(size);
+        const auto kb = std::to_string(file.size() / 1024) + " KB";
+
+        if (file.size() <= MAX_ERASING_FILE_SIZE) {
+            measure("erasing reader, " + kb, 3, [&] () {
+                ErasingReader reader {file};
+                doNotOptimize(readFile(reader));
+            });
+        }
+
+        measure("ByteReader, " + kb, 20, [&] () {
+            auto reader = file.reader();
+            doNotOptimize(readFile(reader));
+        });
+    }
+
+    return 0;
+}
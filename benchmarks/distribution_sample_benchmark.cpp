@@ -0,0 +1,36 @@
+#include "benchmark.hpp"
+
+#include <limitless/fx/modules/distribution.hpp>
+
+#include <vector>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr size_t VALUE_COUNT = 10000;
+    constexpr uint32_t ITERATIONS = 1000;
+}
+
+int main() {
+    RandomStream::Engine engine {1};
+    const RandomStream::Scope scope {engine};
+
+    const RangeDistribution<glm::vec4> distribution {glm::vec4(0.0f), glm::vec4(1.0f)};
+    std::vector<glm::vec4> values(VALUE_COUNT);
+
+    // value per spawned particle, as emitter modules did before batching
+    measure("get per particle", ITERATIONS, [&] () {
+        for (auto& value : values) {
+            value = distribution.get();
+        }
+        doNotOptimize(values.back());
+    });
+
+    measure("sample batch", ITERATIONS, [&] () {
+        distribution.sample(values.data(), values.size());
+        doNotOptimize(values.back());
+    });
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "benchmark.hpp"
+
+#include <limitless/fx/mesh_gpu_particle.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <vector>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr size_t PARTICLE_COUNT = 20000;
+    constexpr uint32_t ITERATIONS = 200;
+
+    // layout mesh particles were uploaded in before, model matrix built on CPU
+    struct alignas(64) MatrixMeshParticle {
+        glm::mat4 model;
+        MeshParticle particle;
+    };
+
+    MeshParticle makeParticle(float index) {
+        MeshParticle particle;
+        particle.color = glm::vec4(0.1f * index, 0.5f, 1.0f, 2.0f);
+        particle.properties = glm::vec4(index, -1.0f, 0.0f, 3.5f);
+        particle.lifetime = 1.0f + index;
+        particle.position = glm::vec3(100.0f * index, 0.5f, -index);
+        particle.rotation = glm::vec3(0.1f * index, 2.0f, -3.0f);
+        particle.velocity = glm::vec3(1.0f, index, -2.0f);
+        particle.size = glm::vec3(0.5f, 1.0f, 2.0f + index);
+        return particle;
+    }
+}
+
+int main() {
+    std::vector<MeshParticle> particles;
+    particles.reserve(PARTICLE_COUNT);
+    for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
+        particles.emplace_back(makeParticle(static_cast<float>(i % 100)));
+    }
+
+    std::vector<MatrixMeshParticle> matrix_upload(PARTICLE_COUNT);
+    std::vector<MeshGpuParticle> packed_upload(PARTICLE_COUNT, MeshGpuParticle {MeshParticle {}});
+
+    std::printf("%-48s %12zu bytes\n", "matrix particles upload per frame", PARTICLE_COUNT * sizeof(MatrixMeshParticle));
+    std::printf("%-48s %12zu bytes\n", "packed particles upload per frame", PARTICLE_COUNT * sizeof(MeshGpuParticle));
+
+    measure("rebuild matrices", ITERATIONS, [&] () {
+        for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
+            const auto& particle = particles[i];
+
+            auto model = glm::translate(glm::mat4(1.0f), particle.position);
+            model = glm::rotate(model, particle.rotation.x, glm::vec3(1.0f, 0.f, 0.f));
+            model = glm::rotate(model, particle.rotation.y, glm::vec3(0.0f, 1.f, 0.f));
+            model = glm::rotate(model, particle.rotation.z, glm::vec3(0.0f, 0.f, 1.f));
+            model = glm::scale(model, particle.size);
+
+            matrix_upload[i] = {model, particle};
+        }
+        doNotOptimize(matrix_upload.back());
+    });
+
+    measure("pack particles", ITERATIONS, [&] () {
+        for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
+            packed_upload[i] = MeshGpuParticle(particles[i]);
+        }
+        doNotOptimize(packed_upload.back());
+    });
+
+    return 0;
+}
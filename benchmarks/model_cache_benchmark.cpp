@@ -0,0 +1,51 @@
+#include "benchmark.hpp"
+
+#include <limitless/assets.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/loaders/gltf_model_loader.hpp>
+
+using namespace Limitless;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr uint32_t ITERATIONS = 20;
+
+    // models of engine assets, from small rig to large skinned model with many animations
+    const char* const MODELS[] = {
+        "models/gltf/RiggedSimple.gltf",
+        "models/gltf/CesiumMan.gltf",
+        "models/gltf/BrainStem.gltf",
+    };
+}
+
+// loads models from source files against loading them from processed model cache
+int main() {
+    // meshes upload vertex streams, so loading needs context
+    Context context = {"benchmark", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+
+    const fs::path assets_dir {ENGINE_ASSETS_DIR};
+    const auto cache_dir = fs::temp_directory_path() / "limitless_model_cache_benchmark";
+    fs::remove_all(cache_dir);
+
+    for (const auto* model : MODELS) {
+        const auto path = assets_dir / model;
+
+        // every load builds materials with the same names, so each one gets its own assets
+        const auto cold = measure(path.filename().string() + " cold", ITERATIONS, [&] {
+            Assets assets {assets_dir};
+            doNotOptimize(GltfModelLoader::loadModel(assets, path, {}));
+        });
+
+        // warm up run of measure writes cache file
+        const auto warm = measure(path.filename().string() + " warm", ITERATIONS, [&] {
+            Assets assets {assets_dir};
+            doNotOptimize(GltfModelLoader::loadModel(assets, path, ModelLoaderFlags {}.cache(cache_dir)));
+        });
+
+        std::printf("%-48s %12.1fx\n", "speedup", cold / warm);
+    }
+
+    fs::remove_all(cache_dir);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "benchmark.hpp"
+
+#include <limitless/fx/sprite_particle_kernels.hpp>
+
+#include <limits>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+using namespace LimitlessBenchmark;
+
+namespace {
+    constexpr uint32_t PARTICLE_COUNT = 100000;
+    constexpr uint32_t ITERATIONS = 200;
+    constexpr float DT = 0.016f;
+
+    SpriteParticle makeParticle(uint32_t index) {
+        SpriteParticle particle;
+        particle.lifetime = 1000.0f + static_cast<float>(index % 100);
+        particle.position = glm::vec3(static_cast<float>(index), 0.0f, 0.0f);
+        particle.velocity = glm::vec3(0.0f, 1.0f, 0.0f);
+        particle.acceleration = glm::vec3(0.0f, -9.8f, 0.0f);
+        return particle;
+    }
+}
+
+int main() {
+    ConstDistribution<glm::vec3> velocity {glm::vec3(0.0f, 2.0f, 0.0f)};
+    ConstDistribution<glm::vec4> color {glm::vec4(0.0f)};
+    ConstDistribution<glm::vec3> rotation {glm::vec3(0.0f, 0.0f, 1.0f)};
+    ConstDistribution<float> size {1.0f};
+
+    std::vector<SpriteParticle> particles;
+    SpriteParticleStorage storage;
+    for (uint32_t i = 0; i < PARTICLE_COUNT; ++i) {
+        particles.emplace_back(makeParticle(i));
+        storage.push(particles.back());
+    }
+
+    // the same stages run one after another over array of structures, as emitter modules do
+    measure("modules over SpriteParticle array", ITERATIONS, [&] () {
+        Distribution<glm::vec3>& velocity_distribution = velocity;
+        Distribution<glm::vec4>& color_distribution = color;
+        Distribution<glm::vec3>& rotation_distribution = rotation;
+        Distribution<float>& size_distribution = size;
+
+        for (auto& p : particles) {
+            p.velocity += (velocity_distribution.get() - p.velocity) / (p.lifetime / DT);
+        }
+        for (auto& p : particles) {
+            p.color += (color_distribution.get() - p.color) / (p.lifetime / DT);
+            p.color = glm::clamp(p.color, glm::vec4(0.0f), glm::vec4(std::numeric_limits<float>::max()));
+        }
+        for (auto& p : particles) {
+            p.rotation += rotation_distribution.get() * DT;
+        }
+        for (auto& p : particles) {
+            p.size += (size_distribution.get() - p.size) / (p.lifetime / DT);
+        }
+        for (auto& p : particles) {
+            p.time += DT;
+        }
+        for (auto& p : particles) {
+            p.lifetime -= DT;
+        }
+        for (auto& p : particles) {
+            p.position += p.velocity * DT;
+            p.velocity += p.acceleration * DT;
+        }
+        doNotOptimize(particles.back());
+    });
+
+    SpriteKernelModules modules;
+    modules.velocity_by_life = &velocity;
+    modules.color_by_life = &color;
+    modules.rotation_rate = &rotation;
+    modules.size_by_life = &size;
+    modules.time = true;
+    modules.lifetime = true;
+
+    measure("fused kernels over SpriteParticleStorage", ITERATIONS, [&] () {
+        updateSprites(storage, modules, DT);
+        doNotOptimize(storage.position.x.back());
+    });
+
+    std::vector<SpriteParticle> packed;
+    measure("pack for upload", ITERATIONS, [&] () {
+        storage.pack(packed);
+        doNotOptimize(packed.back());
+    });
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 #include <limitless/shader_storage.hpp>
 #include <limitless/util/filesystem.hpp>
 #include <limitless/loaders/texture_loader.hpp>
+#include <limitless/loaders/pack_archives.hpp>
 
 namespace Limitless::ms {
     class Material;
@@ -60,6 +61,11 @@ namespace Limitless {
          */
         ShaderStorage shaders;
 
+        /**
+         * Pack archives that loaders read asset files from before they look for them on disk
+         */
+        PackArchives archives;
+
         explicit Assets(const fs::path& base_dir) noexcept;
         Assets(fs::path base_dir, fs::path shader_dir) noexcept;
 
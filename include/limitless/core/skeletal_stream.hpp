@@ -31,5 +31,6 @@ namespace Limitless {
 
         auto& getBoneWeights() noexcept { return bone_weights; }
         const auto& getBoneWeights() const noexcept { return bone_weights; }
+        const auto& getBoneBuffer() const noexcept { return bone_buffer; }
     };
 }
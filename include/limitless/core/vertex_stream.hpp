@@ -75,6 +75,7 @@ namespace Limitless {
 
         auto& getVertices() noexcept { return stream; }
         const auto& getVertices() const noexcept { return stream; }
+        const auto& getVertexBuffer() const noexcept { return vertex_buffer; }
 
         void map() {
             const auto size = stream.size() * sizeof(Vertex);
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <limitless/fx/particle.hpp>
+
+#include <cstdint>
+
+namespace Limitless {
+    class Camera;
+}
+
+namespace Limitless::fx {
+    /**
+     * Expands derivative lines of beam particles to screen space mitered ribbons
+     *
+     * every segment of line is two triangles; first and last points of line only bend miters of adjacent segments
+     */
+    class BeamRibbon final {
+    public:
+        static constexpr uint32_t SEGMENT_VERTEX_COUNT = 6;
+
+        /**
+         * Camera state that is the same for all vertices
+         */
+        struct View {
+            glm::mat4 VP;
+            glm::mat4 VP_inverse;
+            glm::vec2 resolution;
+        };
+
+        [[nodiscard]] static View makeView(const Camera& camera, glm::vec2 resolution) noexcept;
+
+        [[nodiscard]] static size_t getSegmentCount(const BeamParticle& particle) noexcept;
+
+        /**
+         * Writes SEGMENT_VERTEX_COUNT vertices for every segment of particle line
+         */
+        static void expand(const BeamParticle& particle, const View& view, BeamParticleMapping* vertices) noexcept;
+    };
+
+    /**
+     * Beam particle attributes read by vertex shader that expands ribbons itself
+     */
+    struct BeamGpuParticle {
+        glm::vec4 color;
+        glm::vec4 subUV;
+        glm::vec4 properties;
+        // xyz - acceleration; w - lifetime
+        glm::vec4 acceleration;
+        // xyz - rotation; w - time
+        glm::vec4 rotation;
+        // xyz - velocity; w - size
+        glm::vec4 velocity;
+        // xyz - start; w - length
+        glm::vec4 start;
+        // xyz - end; w - unused
+        glm::vec4 end;
+
+        explicit BeamGpuParticle(const BeamParticle& particle) noexcept;
+    };
+}
@@ -2,7 +2,11 @@
 
 #include <limitless/fx/emitters/unique_emitter.hpp>
 #include <limitless/fx/emitters/emitter_spawn.hpp>
+#include <limitless/fx/emitters/emitter_lod.hpp>
 #include <limitless/fx/modules/distribution.hpp>
+#include <limitless/util/box.hpp>
+
+#include <optional>
 
 namespace Limitless {
     class EffectInstance;
@@ -46,6 +50,8 @@ namespace Limitless::fx {
         EffectBuilder& setMaterial(std::shared_ptr<ms::Material> material);
         EffectBuilder& setMesh(std::shared_ptr<AbstractMesh> mesh);
         EffectBuilder& setDuration(std::chrono::duration<float> duration);
+        EffectBuilder& setFixedBounds(const std::optional<Box>& bounds);
+        EffectBuilder& setLod(const std::optional<EmitterLod>& lod);
         EffectBuilder& setLocalPosition(const glm::vec3& local_position);
         EffectBuilder& setLocalRotation(const glm::quat& local_rotation);
         EffectBuilder& setSpawnMode(EmitterSpawn::Mode mode);
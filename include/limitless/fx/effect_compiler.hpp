@@ -15,6 +15,8 @@ namespace Limitless::fx {
     private:
         template<typename T>
         void compile(ShaderType shader_type, const T& emitter);
+
+        void compileSimulation(const SpriteEmitter& emitter);
     public:
         explicit EffectCompiler(Context& context, Assets& assets, const RendererSettings& settings);
 
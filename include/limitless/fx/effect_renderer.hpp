@@ -2,6 +2,7 @@
 
 #include <limitless/fx/renderers/emitter_renderer.hpp>
 #include <limitless/fx/emitters/unique_emitter.hpp>
+#include <limitless/fx/beam_ribbon.hpp>
 
 #include <map>
 #include <memory>
@@ -11,6 +12,7 @@ namespace Limitless {
     class UniformSetter;
     class Context;
     class Assets;
+    class Camera;
 
     using Instances = std::vector<std::shared_ptr<Instance>>;
 
@@ -26,12 +28,18 @@ namespace Limitless::fx {
     private:
         std::map<UniqueEmitterRenderer, std::unique_ptr<AbstractEmitterRenderer>> renderers;
 
-        void updateRenderers(const Instances& instances) noexcept;
-        static void visitEmitters(const Instances& instances, EmitterVisitor& visitor) noexcept;
+        // starts new frame of particles in every renderer
+        void beginRenderers(const BeamRibbon::View& beam_view, bool gpu_beams);
+        static void visitEmitters(const Instance& instance, EmitterVisitor& visitor) noexcept;
     public:
         ~EffectRenderer() = default;
 
-        void update(const Instances& instances);
+        /**
+         * Collects particles of visible instances
+         *
+         * beams are expanded to ribbons for camera here unless gpu_beams is set
+         */
+        void update(const Instances& instances, const Camera& camera, glm::uvec2 resolution, bool gpu_beams);
         void draw(Context& ctx, const Assets& assets, ShaderType shader, ms::Blending blending, const UniformSetter& setter);
     };
 }
\ No newline at end of file
@@ -14,5 +14,8 @@ namespace Limitless::fx {
         static std::string getEmitterDefines(const AbstractEmitter& emitter) noexcept;
     public:
         static void replaceMaterialDependentDefine(Shader& shader, const ms::Material& material, InstanceType model_shader, const AbstractEmitter& emitter);
+
+        // for emitter shaders that do not depend on material
+        static void replaceEmitterDefine(Shader& shader, const AbstractEmitter& emitter);
     };
 }
\ No newline at end of file
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <limitless/fx/emitters/emitter_lod.hpp>
+#include <limitless/util/random_stream.hpp>
+#include <limitless/util/box.hpp>
+
 #include <glm/glm.hpp>
 #include <chrono>
+#include <optional>
 #include <vector>
 
 namespace Limitless {
     class Context;
     class Camera;
+    class ThreadPool;
 }
 
 namespace Limitless::fx {
@@ -21,6 +27,15 @@ namespace Limitless::fx {
     protected:
         Type type;
 
+        // stream of random numbers drawn by modules while emitter is updated
+        RandomStream::Engine generator;
+
+        // emitter is outside of view and its particles are not drawn
+        bool culled {false};
+
+        // level of detail emitter is simulated with
+        EmitterLodLevel lod_level;
+
         explicit AbstractEmitter(Type type) noexcept;
 
         AbstractEmitter(const AbstractEmitter&) = default;
@@ -46,15 +61,53 @@ namespace Limitless::fx {
         virtual void kill() noexcept = 0;
         virtual void ressurect() noexcept = 0;
 
+        /**
+         * Returns emitter to state it had right after being cloned from effect, keeping allocated memory
+         */
+        virtual void reset() = 0;
+
         [[nodiscard]] virtual AbstractEmitter* clone() const = 0;
         virtual void update(const Camera &camera) = 0;
+
+        /**
+         * Updates emitter, large amount of particles is split across threads of pool
+         */
+        virtual void update(const Camera& camera, [[maybe_unused]] ThreadPool& pool) { update(camera); }
+
+        /**
+         * Restarts random stream of emitter, emitters with the same seed get the same numbers
+         */
+        void setSeed(uint64_t seed) noexcept { generator.seed(RandomStream::seed(seed, 0)); }
         virtual void accept(EmitterVisitor& visitor) noexcept = 0;
 
+        /**
+         * Skips simulation of emitter until it is updated again
+         *
+         * duration of emitter keeps running; on next update up to catch_up of skipped time is simulated
+         * in short steps and the rest of it is dropped, so zero resumes particles where they stopped
+         */
+        virtual void suspend(std::chrono::duration<float> catch_up) noexcept = 0;
+
+        /**
+         * Gets world space box that contains all particles of emitter as of its last update
+         *
+         * returns nothing when bounds are unknown, e.g. particles are simulated on GPU and no fixed bounds are set
+         */
+        [[nodiscard]] virtual const std::optional<Box>& getBounds() const noexcept = 0;
+
+        void setCulled(bool _culled) noexcept { culled = _culled; }
+        [[nodiscard]] bool isCulled() const noexcept { return culled; }
+
+        void setLodLevel(const EmitterLodLevel& level) noexcept { lod_level = level; }
+        [[nodiscard]] const auto& getLodLevel() const noexcept { return lod_level; }
+
         virtual bool& getLocalSpace() noexcept = 0;
         virtual EmitterSpawn& getSpawn() noexcept = 0;
         virtual glm::vec3& getLocalPosition() noexcept = 0;
         virtual glm::quat& getLocalRotation() noexcept = 0;
         virtual std::chrono::duration<float>& getDuration() noexcept = 0;
+        virtual std::optional<Box>& getFixedBounds() noexcept = 0;
+        virtual std::optional<EmitterLod>& getLod() noexcept = 0;
 
         [[nodiscard]] virtual bool isDone() const noexcept = 0;
         [[nodiscard]] virtual bool getLocalSpace() const noexcept = 0;
@@ -62,5 +115,7 @@ namespace Limitless::fx {
         [[nodiscard]] virtual const glm::quat& getLocalRotation() const noexcept = 0;
         [[nodiscard]] virtual const EmitterSpawn& getSpawn() const noexcept  = 0;
         [[nodiscard]] virtual const std::chrono::duration<float>& getDuration() const noexcept = 0;
+        [[nodiscard]] virtual const std::optional<Box>& getFixedBounds() const noexcept = 0;
+        [[nodiscard]] virtual const std::optional<EmitterLod>& getLod() const noexcept = 0;
     };
 }
@@ -27,7 +27,7 @@ namespace Limitless::fx {
 
         [[nodiscard]] UniqueEmitterRenderer getUniqueRendererType() const noexcept override;
 
-        [[nodiscard]] const std::vector<BeamParticleMapping>& getParticles() const noexcept;
+        [[nodiscard]] const auto& getParticles() const noexcept { return particles; }
 
         [[nodiscard]] ms::Material& getMaterial() noexcept { return *material; }
         [[nodiscard]] const ms::Material& getMaterial() const noexcept { return *material; }
@@ -30,6 +30,9 @@ namespace Limitless::fx {
         EmitterModules<Particle> modules;
         std::vector<Particle> particles;
 
+        // indices of particles killed in current update, kept to reuse its memory
+        std::vector<size_t> dead_indices;
+
         // local position of emitter
         glm::vec3 local_position {0.0f};
         glm::quat local_rotation {1.0f, 0.0f, 0.0f, 0.0f};
@@ -47,6 +50,22 @@ namespace Limitless::fx {
         // emitter duration in seconds; 0 for infinity
         std::chrono::duration<float> duration {0.0f};
 
+        // authored box around emitter position that particles never leave; used instead of computed bounds
+        std::optional<Box> fixed_bounds;
+
+        // authored levels of detail; default ones of scene are used without them
+        std::optional<EmitterLod> lod;
+
+        // box of particles as of last update
+        std::optional<Box> bounds;
+
+        // emitter is not simulated until next update, which catches up at most catch_up of skipped time
+        bool suspended {false};
+        std::chrono::duration<float> catch_up {};
+
+        // skipped time is simulated in steps of this length
+        static constexpr std::chrono::duration<float> CATCH_UP_STEP {1.0f / 30.0f};
+
         std::chrono::time_point<std::chrono::steady_clock> start_time {};
         std::chrono::time_point<std::chrono::steady_clock> last_time {};
 
@@ -55,9 +74,30 @@ namespace Limitless::fx {
         UniqueEmitterShader unique_shader;
 
         void emit(uint32_t count) noexcept;
-        void spawnParticles() noexcept;
+        void spawnParticles(std::chrono::time_point<std::chrono::steady_clock> current_time) noexcept;
         void killParticles() noexcept;
 
+        // whether module is skipped on current level of detail
+        [[nodiscard]] bool isDropped(const Module<Particle>& module) const noexcept;
+
+        // kills expired particles, runs module updates and integrates movement
+        virtual void updateParticles(float dt, const Camera& camera, ThreadPool* pool);
+
+        // computes box of current particles
+        virtual void updateBounds() noexcept;
+
+        // particles that count against max count
+        [[nodiscard]] virtual size_t getAliveCount() const noexcept { return particles.size(); }
+
+        // simulates emitter up to current_time
+        void advance(std::chrono::time_point<std::chrono::steady_clock> current_time, const Camera& camera, ThreadPool* pool);
+
+        // simulates time skipped while emitter was suspended
+        void catchUp(std::chrono::time_point<std::chrono::steady_clock> current_time, const Camera& camera, ThreadPool* pool);
+
+        // updates particles and spawns new ones drawing numbers from emitter stream
+        void updateEmitter(const Camera& camera, ThreadPool* pool);
+
         explicit Emitter(Type type);
         ~Emitter() override = default;
 
@@ -74,19 +114,26 @@ namespace Limitless::fx {
 
         void kill() noexcept override;
         void ressurect() noexcept override;
+        void reset() override;
 
         [[nodiscard]] const UniqueEmitterShader& getUniqueShaderType() const noexcept override { return unique_shader; }
         [[nodiscard]] UniqueEmitterRenderer getUniqueRendererType() const noexcept override { return { type, std::nullopt, nullptr }; }
 
         [[nodiscard]] Emitter* clone() const override;
         void update(const Camera &camera) override;
+        void update(const Camera& camera, ThreadPool& pool) override;
         void accept(EmitterVisitor& visitor) noexcept override;
 
+        void suspend(std::chrono::duration<float> catch_up) noexcept override;
+        [[nodiscard]] const std::optional<Box>& getBounds() const noexcept override { return bounds; }
+
         bool& getLocalSpace() noexcept override;
         EmitterSpawn& getSpawn() noexcept override;
         glm::vec3& getLocalPosition() noexcept override;
         glm::quat& getLocalRotation() noexcept override;
         std::chrono::duration<float>& getDuration() noexcept override;
+        std::optional<Box>& getFixedBounds() noexcept override;
+        std::optional<EmitterLod>& getLod() noexcept override;
 
         auto& getModule(ModuleType type) {
             for (const auto& module : modules) {
@@ -104,6 +151,8 @@ namespace Limitless::fx {
         [[nodiscard]] const glm::quat& getLocalRotation() const noexcept override;
         [[nodiscard]] const EmitterSpawn& getSpawn() const noexcept override;
         [[nodiscard]] const std::chrono::duration<float>& getDuration() const noexcept override;
+        [[nodiscard]] const std::optional<Box>& getFixedBounds() const noexcept override;
+        [[nodiscard]] const std::optional<EmitterLod>& getLod() const noexcept override;
         [[nodiscard]] const auto& getModules() const noexcept { return modules; }
     };
 }
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Limitless::fx {
+    enum class ModuleType;
+
+    /**
+     * Level of detail of emitter
+     */
+    class EmitterLodLevel {
+    public:
+        /**
+         * Scales of spawn rate and max count of emitter
+         */
+        float spawn_rate {1.0f};
+        float max_count {1.0f};
+
+        /**
+         * Bit per module type; dropped modules neither initialize nor update particles
+         *
+         * Lifetime and MeshLocationAttachment are never dropped, particles depend on them;
+         * emitters simulated on GPU keep all of their modules
+         */
+        uint64_t dropped_modules {};
+
+        void drop(ModuleType type) noexcept { dropped_modules |= 1ull << static_cast<uint32_t>(type); }
+        [[nodiscard]] bool isDropped(ModuleType type) const noexcept { return (dropped_modules >> static_cast<uint32_t>(type)) & 1ull; }
+    };
+
+    /**
+     * Levels of detail of emitter from the closest one
+     */
+    class EmitterLod {
+    public:
+        static constexpr size_t LEVEL_COUNT = 4;
+
+        std::array<EmitterLodLevel, LEVEL_COUNT> levels {{
+            {1.0f, 1.0f},
+            {0.5f, 0.5f},
+            {0.25f, 0.25f},
+            {0.1f, 0.1f}
+        }};
+
+        /**
+         * Levels that keep emitter at full detail at any screen size
+         */
+        static EmitterLod full() noexcept {
+            EmitterLod lod;
+            lod.levels.fill({});
+            return lod;
+        }
+    };
+}
@@ -21,6 +21,9 @@ namespace Limitless::fx {
 
         MeshEmitter() noexcept;
 
+        // extends particles by bounding sphere of mesh
+        void updateBounds() noexcept override;
+
         friend class EffectBuilder;
         friend class Limitless::EmitterSerializer;
     public:
@@ -39,7 +42,6 @@ namespace Limitless::fx {
 
         [[nodiscard]] MeshEmitter* clone() const override;
 
-        void update(const Camera &camera) override;
         void accept(EmitterVisitor& visitor) noexcept override;
     };
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <limitless/fx/emitters/emitter.hpp>
+#include <limitless/fx/sprite_particle_kernels.hpp>
+#include <limitless/fx/sprite_gpu_simulation.hpp>
+
+#include <optional>
 
 namespace Limitless {
     class EmitterSerializer;
@@ -15,6 +19,35 @@ namespace Limitless::fx {
     protected:
         std::shared_ptr<ms::Material> material;
 
+        // simulated particles when all module updates are run by kernels; particles vector then keeps packed copy for upload
+        SpriteParticleStorage storage;
+        bool kernel_update {false};
+
+        // particles are simulated in compute shader; particles vector then keeps only particles spawned since last simulation
+        std::shared_ptr<SpriteGpuSimulation> gpu_simulation;
+        float gpu_dt {};
+
+        // owner of simulation dispatch; emitter returns to CPU simulation when it is gone
+        std::weak_ptr<const void> gpu_dispatcher;
+
+        /**
+         * Collects update stages of modules
+         *
+         * returns nothing if some module has update stage that kernels do not cover
+         */
+        [[nodiscard]] std::optional<SpriteKernelModules> getKernelModules() const;
+
+        // particles of kernel update are split in chunks of this size to be updated on pool threads
+        static constexpr size_t PARALLEL_CHUNK_SIZE = 4096;
+
+        void updateParticles(float dt, const Camera& camera, ThreadPool* pool) override;
+
+        // particles simulated on GPU are not read back, so their bounds are known only when fixed
+        void updateBounds() noexcept override;
+
+        // particles waiting for upload and ones that may still be alive on GPU
+        [[nodiscard]] size_t getAliveCount() const noexcept override;
+
         SpriteEmitter() noexcept;
 
         friend class EffectBuilder;
@@ -27,8 +60,46 @@ namespace Limitless::fx {
 
         [[nodiscard]] UniqueEmitterRenderer getUniqueRendererType() const noexcept override;
 
+        void setPosition(const glm::vec3& position) noexcept override;
+        void setRotation(const glm::quat& rotation) noexcept override;
+
+        void reset() override;
+
         [[nodiscard]] const auto& getParticles() const noexcept { return particles; }
 
+        /**
+         * Whether every module update stage can be run by simulation shader
+         *
+         * initialization stages are always run on CPU for spawned particles
+         */
+        [[nodiscard]] bool isGpuSimulationSupported() const noexcept;
+
+        /**
+         * Moves simulation to GPU, current particles are handed over as spawned ones
+         *
+         * simulation is dispatched while dispatcher is alive
+         */
+        void enableGpuSimulation(std::weak_ptr<const void> dispatcher);
+
+        /**
+         * Moves simulation back to CPU, simulated particles are read back from GPU
+         *
+         * should be called from thread that owns context
+         */
+        void disableGpuSimulation();
+
+        /**
+         * Whether simulation is on GPU but nothing dispatches it anymore
+         */
+        [[nodiscard]] bool isGpuSimulationOrphaned() const noexcept { return gpu_simulation && gpu_dispatcher.expired(); }
+
+        /**
+         * Uploads spawned particles and simulates all particles for time passed since last simulation
+         */
+        void simulateOnGpu(Context& ctx, ShaderProgram& shader);
+
+        [[nodiscard]] const auto& getGpuSimulation() const noexcept { return gpu_simulation; }
+
         [[nodiscard]] auto& getMaterial() noexcept { return *material; }
         [[nodiscard]] const auto& getMaterial() const noexcept { return *material; }
 
@@ -1,45 +1,60 @@
 #pragma once
 
 #include <limitless/fx/emitters/emitter_visitor.hpp>
+#include <limitless/fx/renderers/sprite_emitter_renderer.hpp>
+#include <limitless/fx/renderers/mesh_emitter_renderer.hpp>
+#include <limitless/fx/renderers/beam_emitter_renderer.hpp>
 #include <limitless/fx/emitters/sprite_emitter.hpp>
 #include <limitless/fx/emitters/mesh_emitter.hpp>
 #include <limitless/fx/emitters/beam_emitter.hpp>
 
+#include <map>
+
 namespace Limitless::fx {
-    template<typename Particle>
+    /**
+     * Appends particles of visited emitters to renderers of their type
+     *
+     * renderer is created when emitter of new type is visited first time
+     */
     class ParticleCollector : public EmitterVisitor {
     private:
-        std::vector<Particle> particles;
-        const UniqueEmitterRenderer& emitter_type;
+        std::map<UniqueEmitterRenderer, std::unique_ptr<AbstractEmitterRenderer>>& renderers;
+        const BeamRibbon::View& beam_view;
+        const bool gpu_beams;
+
+        template<typename Particle, typename Emitter, typename... Args>
+        static auto& getRenderer(decltype(renderers) renderers, const Emitter& emitter, const Args&... begin_args) {
+            auto type = emitter.getUniqueRendererType();
+
+            auto it = renderers.find(type);
+            if (it == renderers.end()) {
+                type.material = std::make_shared<ms::Material>(*type.material);
+
+                auto* renderer = new EmitterRenderer<Particle>(emitter);
+                renderer->begin(begin_args...);
+
+                it = renderers.emplace(type, renderer).first;
+            }
+
+            return static_cast<EmitterRenderer<Particle>&>(*it->second); //NOLINT
+        }
     public:
-        explicit ParticleCollector(const UniqueEmitterRenderer& _emitter_type) noexcept
-            : emitter_type {_emitter_type} {}
+        ParticleCollector(decltype(renderers) renderers, const BeamRibbon::View& beam_view, bool gpu_beams) noexcept
+            : renderers {renderers}
+            , beam_view {beam_view}
+            , gpu_beams {gpu_beams} {}
         ~ParticleCollector() override = default;
 
         void visit(const SpriteEmitter& emitter) noexcept override {
-            if constexpr (std::is_same_v<Particle, SpriteParticle>) {
-                if (emitter_type == emitter.getUniqueRendererType()) {
-                    particles.insert(particles.end(), emitter.getParticles().begin(), emitter.getParticles().end());
-                }
-            }
+            getRenderer<SpriteParticle>(renderers, emitter).append(emitter);
         }
 
         void visit(const MeshEmitter& emitter) noexcept override {
-            if constexpr (std::is_same_v<Particle, MeshParticle>) {
-                if (emitter_type == emitter.getUniqueRendererType()) {
-                    particles.insert(particles.end(), emitter.getParticles().begin(), emitter.getParticles().end());
-                }
-            }
+            getRenderer<MeshParticle>(renderers, emitter).append(emitter);
         }
 
         void visit(const BeamEmitter& emitter) noexcept override {
-            if constexpr (std::is_same_v<Particle, BeamParticleMapping>) {
-                if (emitter_type == emitter.getUniqueRendererType()) {
-                    particles.insert(particles.end(), emitter.getParticles().begin(), emitter.getParticles().end());
-                }
-            }
+            getRenderer<BeamParticle>(renderers, emitter, beam_view, gpu_beams).append(emitter);
         }
-
-        [[nodiscard]] auto&& yield() { return std::move(particles); }
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <limitless/fx/particle.hpp>
+
+namespace Limitless::fx {
+    /**
+     * Mesh particle as it is read by vertex shader
+     *
+     * model matrix is built in shader from position, rotation and size; attributes that tolerate
+     * precision loss are stored as pairs of half floats
+     */
+    struct MeshGpuParticle {
+        // xyz - position; w - time
+        glm::vec4 position;
+        // xyz - rotation; w - lifetime
+        glm::vec4 rotation;
+        // xy - color; zw - subUV
+        glm::uvec4 color;
+        // xy - properties; zw - size
+        glm::uvec4 properties;
+        // xy - velocity; zw - acceleration
+        glm::uvec4 velocity;
+
+        explicit MeshGpuParticle(const MeshParticle& particle) noexcept;
+    };
+
+    static_assert(sizeof(MeshGpuParticle) == 80, "MeshGpuParticle must match std430 layout of shader struct");
+}
@@ -2,120 +2,22 @@
 
 #include <limitless/fx/modules/module.hpp>
 
-#include <limitless/core/context.hpp>
-#include <limitless/camera.hpp>
+#include <limitless/util/random_stream.hpp>
 
 #include <algorithm>
+#include <random>
 
 namespace Limitless::fx {
+    /**
+     * Rebuilds derivative lines of beams
+     *
+     * lines are expanded to ribbons facing camera at render time; see BeamRibbon
+     */
     template<typename Particle>
     class BeamBuilder : public Module<Particle> {
     private:
-        std::vector<BeamParticleMapping> beam_particles;
-
-        void generate(BeamParticle& particle, const Camera& camera) {
-            constexpr auto DOT_PRODUCT_RANGE = glm::vec2(0.2f, 0.8f);
-            auto size = Context::getCurrentContext()->getSize();
-            const auto resolution = glm::vec2(size.x, size.y);
-            const auto& line = particle.derivative_line;
-
-            for (uint32_t i = 0; i < 6 * (line.size() - 2 - 1); ++i) {
-                int line_i = i / 6;
-                int tri_i = i % 6;
-
-                glm::vec4 va[4];
-                const auto VP = camera.getProjection() * camera.getView();
-                for (uint32_t k = 0; k < 4; ++k) {
-                    va[k] = VP * glm::vec4(line.at(line_i + k), 1.0f);
-                    va[k].x /= va[k].w;
-                    va[k].y /= va[k].w;
-                    va[k].z /= va[k].w;
-
-                    va[k].x = ((glm::vec2(va[k]) + 1.0f) * 0.5f * resolution).x;
-                    va[k].y = ((glm::vec2(va[k]) + 1.0f) * 0.5f * resolution).y;
-                }
-
-                glm::vec2 v_line = glm::normalize(glm::vec2(va[2]) - glm::vec2(va[1]));
-                glm::vec2 nv_line = glm::vec2(-v_line.y, v_line.x);
-
-                glm::vec4 pos;
-                if (tri_i == 0 || tri_i == 1 || tri_i == 3) {
-                    glm::vec2 v_pred = glm::normalize(glm::vec2(va[1]) - glm::vec2(va[0]));
-                    glm::vec2 v_miter = glm::normalize(nv_line + glm::vec2(-v_pred.y, v_pred.x));
-
-                    pos = va[1];
-                    auto dot = glm::dot(v_miter, nv_line);
-                    dot = glm::min(dot, DOT_PRODUCT_RANGE.y);
-                    dot = glm::max(dot, DOT_PRODUCT_RANGE.x);
-                    pos.x += (v_miter * particle.size / pos.w * (tri_i == 1 ? -0.5f : 0.5f) / dot).x;
-                    pos.y += (v_miter * particle.size / pos.w * (tri_i == 1 ? -0.5f : 0.5f) / dot).y;
-                } else {
-                    glm::vec2 v_succ = normalize(glm::vec2(va[3]) - glm::vec2(va[2]));
-                    glm::vec2 v_miter = normalize(nv_line + glm::vec2(-v_succ.y, v_succ.x));
-
-                    pos = va[2];
-                    auto dot = glm::dot(v_miter, nv_line);
-                    dot = glm::min(dot, DOT_PRODUCT_RANGE.y);
-                    dot = glm::max(dot, DOT_PRODUCT_RANGE.x);
-                    pos.x += (v_miter * particle.size / pos.w * (tri_i == 5 ? 0.5f : -0.5f) / dot).x;
-                    pos.y += (v_miter * particle.size / pos.w * (tri_i == 5 ? 0.5f : -0.5f) / dot).y;
-                }
-
-                pos.x = (glm::vec2(pos) / resolution * 2.0f - 1.0f).x;
-                pos.y = (glm::vec2(pos) / resolution * 2.0f - 1.0f).y;
-
-                pos.x *= pos.w;
-                pos.y *= pos.w;
-                pos.z *= pos.w;
-
-                pos = glm::inverse(camera.getProjection() * camera.getView()) * pos;
-
-                glm::vec2 uv;
-                switch (tri_i) {
-                    case 0:
-                        uv = {0.0f, 1.0f};
-                        break;
-                    case 1:
-                        uv = {0.0f, 0.0f};
-                        break;
-                    case 2:
-                        uv = {1.0f, 0.0f};
-                        break;
-                    case 3:
-                        uv = {0.0f, 1.0f};
-                        break;
-                    case 4:
-                        uv = {1.0f, 0.0f};
-                        break;
-                    case 5:
-                        uv = {0.0f, 1.0f};
-                        break;
-                }
-
-
-                BeamParticleMapping p;
-                p.position = pos;
-                p.size = particle.size;
-                p.color = particle.color;
-                p.subUV = particle.subUV;
-                p.properties = particle.properties;
-                p.acceleration = particle.acceleration;
-                p.lifetime = particle.lifetime;
-                p.rotation = particle.rotation;
-                p.time = particle.time;
-                p.velocity = particle.velocity;
-                p.uv = uv;
-                p.length = particle.length;
-                p.start = particle.position;
-                p.end = particle.target;
-
-                beam_particles.emplace_back(std::move(p));
-            }
-        }
-
         void generate(std::vector<glm::vec3>& line, BeamParticle& particle, glm::vec3 source, glm::vec3 dest, float distance) {
-            std::random_device rd;
-            std::mt19937 generator(rd());
+            auto& generator = RandomStream::get();
             auto uni = std::uniform_real_distribution<float>(-distance, distance);
 
             if (distance < particle.offset) {
@@ -140,13 +42,7 @@ namespace Limitless::fx {
         BeamBuilder(const BeamBuilder& module)
             : Module<Particle>(module.type) {}
 
-        const auto& getParticles() const noexcept {
-            return beam_particles;
-        }
-
-        void update([[maybe_unused]] AbstractEmitter &emitter, std::vector<Particle> &particles, [[maybe_unused]] float dt, const Camera &camera) noexcept override {
-            beam_particles.clear();
-
+        void update([[maybe_unused]] AbstractEmitter &emitter, std::vector<Particle> &particles, [[maybe_unused]] float dt, [[maybe_unused]] const Camera &camera) noexcept override {
             for (auto& particle : particles) {
                 const auto current = std::chrono::steady_clock::now();
                 const auto delta_time = std::chrono::duration_cast<std::chrono::duration<float>>(current - particle.last_rebuild);
@@ -169,8 +65,6 @@ namespace Limitless::fx {
 
                     particle.last_rebuild = current;
                 }
-
-                generate(particle, camera);
             }
         }
 
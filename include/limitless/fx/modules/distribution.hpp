@@ -1,7 +1,11 @@
 #pragma once
 
+#include <limitless/util/random_stream.hpp>
+
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <random>
+#include <vector>
 
 namespace std {
     template<> struct is_floating_point<glm::vec2> : public true_type {};
@@ -74,6 +78,15 @@ namespace Limitless {
         [[nodiscard]] virtual T get() = 0;
         [[nodiscard]] virtual T get() const = 0;
         [[nodiscard]] virtual Distribution<T>* clone() = 0;
+
+        /**
+         * Writes count values at once
+         */
+        virtual void sample(T* out, size_t count) const {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = get();
+            }
+        }
         [[nodiscard]] const auto& getType() const noexcept { return type; }
     };
 
@@ -88,6 +101,8 @@ namespace Limitless {
         T get() override { return value; }
         T get() const override { return value; }
 
+        void sample(T* out, size_t count) const override { std::fill(out, out + count, value); }
+
         T& getValue() const noexcept { return value; }
         T& getValue() noexcept { return value; }
 
@@ -117,19 +132,27 @@ namespace Limitless {
         template<typename Gen> auto operator()(Gen&& gen) { return distribution(std::forward<Gen>(gen)); }
     };
 
+    /**
+     * Number of float components of T, zero if T is not made of floats only
+     */
+    template<typename T>
+    struct float_components : std::integral_constant<size_t, std::is_same_v<T, float> ? 1 : 0> {};
+
+    template<glm::length_t L, glm::qualifier Q>
+    struct float_components<glm::vec<L, float, Q>> : std::integral_constant<size_t, L> {};
+
+    template<typename T>
+    inline constexpr auto float_components_v = float_components<T>::value;
+
     template<typename T>
     class RangeDistribution : public Distribution<T> {
     private:
         T min, max;
-
-        mutable std::default_random_engine generator;
-        mutable uniform_distribution<T> distribution;
     public:
         RangeDistribution(const T& min, const T& max) noexcept
             : Distribution<T>(DistributionType::Range)
             , min(min)
-            , max(max)
-            , distribution(min, max) {}
+            , max(max) {}
         ~RangeDistribution() override = default;
 
         [[nodiscard]] const T& getMin() const noexcept { return min; }
@@ -137,21 +160,56 @@ namespace Limitless {
         [[nodiscard]] const T& getMax() const noexcept { return max; }
         [[nodiscard]] T& getMax() noexcept { return max; }
 
-        void setMin(const T& _min) noexcept {
-            min = _min;
-            distribution.set(min, max);
+        void setMin(const T& _min) noexcept { min = _min; }
+        void setMax(const T& _max) noexcept { max = _max; }
+
+        /**
+         * Distribution is shared by emitters updated on different threads,
+         * so it keeps no sampling state and draws from stream of calling thread
+         */
+        T get() override { return uniform_distribution<T>{min, max}(RandomStream::get()); }
+        T get() const override { return uniform_distribution<T>{min, max}(RandomStream::get()); }
+
+        /**
+         * Float values are made from whole blocks of uniform floats of stream of calling thread
+         */
+        void sample(T* out, size_t count) const override {
+            // double and its vectors are floating point too, but cannot be filled by floats
+            if constexpr (float_components_v<T> != 0) {
+                constexpr auto components = float_components_v<T>;
+                static_assert(sizeof(T) == components * sizeof(float), "sampled values must be tightly packed float components");
+
+                RandomStream::get().fill(reinterpret_cast<float*>(out), count * components); //NOLINT
+
+                const auto range = max - min;
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = min + out[i] * range;
+                }
+            } else {
+                Distribution<T>::sample(out, count);
+            }
         }
 
-        void setMax(const T& _max) noexcept {
-            max = _max;
-            distribution.set(min, max);
+        [[nodiscard]] Distribution<T>* clone() override {
+            return new RangeDistribution<T>(*this);
         }
+    };
 
-        T get() override { return distribution(generator); }
-        T get() const override { return distribution(generator); }
+    /**
+     * Reusable buffer that spawn batches of distribution values are sampled to
+     */
+    template<typename T>
+    class DistributionBatch {
+    private:
+        std::vector<T> values;
+    public:
+        const T* sample(const Distribution<T>& distribution, size_t count) {
+            if (values.size() < count) {
+                values.resize(count);
+            }
 
-        [[nodiscard]] Distribution<T>* clone() override {
-            return new RangeDistribution<T>(*this);
+            distribution.sample(values.data(), count);
+            return values.data();
         }
     };
 
@@ -7,6 +7,7 @@ namespace Limitless::fx {
     class InitialAcceleration : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<glm::vec3>> distribution;
+        DistributionBatch<glm::vec3> batch;
     public:
         explicit InitialAcceleration(std::unique_ptr<Distribution<glm::vec3>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialAcceleration)
@@ -23,6 +24,14 @@ namespace Limitless::fx {
             particle.acceleration = distribution->get() * rot;
         }
 
+        void initializeBatch(AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto rot = emitter.getRotation() * emitter.getLocalRotation();
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].acceleration = values[i] * rot;
+            }
+        }
+
         [[nodiscard]] InitialAcceleration* clone() const override {
             return new InitialAcceleration(*this);
         }
@@ -7,6 +7,7 @@ namespace Limitless::fx {
     class InitialColor : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<glm::vec4>> distribution;
+        DistributionBatch<glm::vec4> batch;
     public:
         explicit InitialColor(std::unique_ptr<Distribution<glm::vec4>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialColor)
@@ -22,6 +23,13 @@ namespace Limitless::fx {
             particle.color = distribution->get();
         }
 
+        void initializeBatch([[maybe_unused]] AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].color = values[i];
+            }
+        }
+
         [[nodiscard]] InitialColor* clone() const override {
             return new InitialColor(*this);
         }
@@ -8,6 +8,7 @@ namespace Limitless::fx {
     class InitialLocation : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<glm::vec3>> distribution;
+        DistributionBatch<glm::vec3> batch;
     public:
         explicit InitialLocation(std::unique_ptr<Distribution<glm::vec3>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialLocation)
@@ -23,6 +24,13 @@ namespace Limitless::fx {
             particle.position += distribution->get();
         }
 
+        void initializeBatch([[maybe_unused]] AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].position += values[i];
+            }
+        }
+
         [[nodiscard]] InitialLocation* clone() const override {
             return new InitialLocation(*this);
         }
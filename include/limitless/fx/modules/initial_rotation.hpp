@@ -8,6 +8,7 @@ namespace Limitless::fx {
     class InitialRotation : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<glm::vec3>> distribution;
+        DistributionBatch<glm::vec3> batch;
     public:
         explicit InitialRotation(std::unique_ptr<Distribution<glm::vec3>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialRotation)
@@ -24,6 +25,14 @@ namespace Limitless::fx {
             particle.rotation += distribution->get() * rot;
         }
 
+        void initializeBatch(AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto rot = emitter.getRotation() * emitter.getLocalRotation();
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].rotation += values[i] * rot;
+            }
+        }
+
         [[nodiscard]] InitialRotation* clone() const override {
             return new InitialRotation(*this);
         }
@@ -7,6 +7,7 @@ namespace Limitless::fx {
     class InitialSize : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<float>> distribution;
+        DistributionBatch<float> batch;
     public:
         explicit InitialSize(std::unique_ptr<Distribution<float>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialSize)
@@ -21,6 +22,13 @@ namespace Limitless::fx {
             particle.size = distribution->get();
         }
 
+        void initializeBatch([[maybe_unused]] AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].size = values[i];
+            }
+        }
+
         [[nodiscard]] InitialSize* clone() const override {
             return new InitialSize(*this);
         }
@@ -33,6 +41,7 @@ namespace Limitless::fx {
     class InitialSize<MeshParticle> : public Module<MeshParticle> {
     private:
         std::unique_ptr<Distribution<glm::vec3>> distribution;
+        DistributionBatch<glm::vec3> batch;
     public:
         explicit InitialSize(std::unique_ptr<Distribution<glm::vec3>> _distribution) noexcept
         : Module<MeshParticle>(ModuleType::InitialSize)
@@ -47,6 +56,13 @@ namespace Limitless::fx {
             particle.size = distribution->get();
         }
 
+        void initializeBatch([[maybe_unused]] AbstractEmitter& emitter, MeshParticle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].size = values[i];
+            }
+        }
+
         [[nodiscard]] InitialSize* clone() const override {
             return new InitialSize(*this);
         }
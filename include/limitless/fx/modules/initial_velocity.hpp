@@ -7,6 +7,7 @@ namespace Limitless::fx {
     class InitialVelocity : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<glm::vec3>> distribution;
+        DistributionBatch<glm::vec3> batch;
     public:
         explicit InitialVelocity(std::unique_ptr<Distribution<glm::vec3>> _distribution) noexcept
             : Module<Particle>(ModuleType::InitialVelocity)
@@ -22,6 +23,14 @@ namespace Limitless::fx {
             particle.velocity = distribution->get() * rot;
         }
 
+        void initializeBatch(AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto rot = emitter.getRotation() * emitter.getLocalRotation();
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].velocity = values[i] * rot;
+            }
+        }
+
         [[nodiscard]] InitialVelocity* clone() const override {
             return new InitialVelocity(*this);
         }
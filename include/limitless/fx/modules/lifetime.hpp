@@ -7,6 +7,7 @@ namespace Limitless::fx {
     class Lifetime : public Module<Particle> {
     private:
         std::unique_ptr<Distribution<float>> distribution;
+        DistributionBatch<float> batch;
     public:
         explicit Lifetime(std::unique_ptr<Distribution<float>> _distribution) noexcept
             : Module<Particle>(ModuleType::Lifetime)
@@ -22,6 +23,13 @@ namespace Limitless::fx {
             particle.lifetime = distribution->get();
         }
 
+        void initializeBatch([[maybe_unused]] AbstractEmitter& emitter, Particle* particles, [[maybe_unused]] size_t index, size_t count) noexcept override {
+            const auto* values = batch.sample(*distribution, count);
+            for (size_t i = 0; i < count; ++i) {
+                particles[i].lifetime = values[i];
+            }
+        }
+
         void update([[maybe_unused]] AbstractEmitter &emitter, std::vector<Particle> &particles, float dt, [[maybe_unused]] const Camera &camera) noexcept override {
             for (auto& particle : particles) {
                 particle.lifetime -= dt;
@@ -5,6 +5,7 @@
 #include <limitless/instances/skeletal_instance.hpp>
 #include <variant>
 #include <limitless/models/mesh.hpp>
+#include <limitless/util/random_stream.hpp>
 #include <random>
 
 namespace Limitless::fx {
@@ -14,7 +15,6 @@ namespace Limitless::fx {
     class InitialMeshLocation : public Module<Particle> {
     protected:
         std::variant<std::shared_ptr<AbstractMesh>, std::shared_ptr<AbstractModel>> mesh;
-        std::default_random_engine generator;
 
         ModelInstance* instance {};
         glm::vec3 scale {1.0f};
@@ -48,7 +48,8 @@ namespace Limitless::fx {
 
             if (instance) {
                 if (instance->getInstanceType() == InstanceType::Skeletal) {
-                    const auto& skeletal_instance = static_cast<SkeletalInstance&>(*instance);
+                    const auto& skeletal_instance = static_cast<const SkeletalInstance&>(*instance);
+
                     const auto pos1 = skeletal_instance.getSkinnedVertexPosition(_mesh, v_index1);
                     const auto pos2 = skeletal_instance.getSkinnedVertexPosition(_mesh, v_index2);
                     const auto pos3 = skeletal_instance.getSkinnedVertexPosition(_mesh, v_index3);
@@ -70,14 +71,12 @@ namespace Limitless::fx {
 
         InitialMeshLocation(ModuleType type, std::shared_ptr<AbstractMesh> _mesh) noexcept
             : Module<Particle>(type)
-            , mesh {std::move(_mesh)}
-            , generator {std::random_device()()} {
+            , mesh {std::move(_mesh)} {
         }
 
         InitialMeshLocation(ModuleType type, std::shared_ptr<AbstractModel> _mesh) noexcept
             : Module<Particle>(type)
-            , mesh {std::move(_mesh)}
-            , generator {std::random_device()()} {
+            , mesh {std::move(_mesh)} {
         }
 
         auto getSelectedMesh() {
@@ -90,7 +89,7 @@ namespace Limitless::fx {
 
                 using vector_size_type = typename std::remove_reference_t<decltype(meshes)>::size_type;
                 auto int_distribution = std::uniform_int_distribution(static_cast<vector_size_type>(0), meshes.size() - 1);
-                const auto mesh_index = int_distribution(generator);
+                const auto mesh_index = int_distribution(RandomStream::get());
 
                 selected_mesh = meshes[mesh_index];
             }
@@ -103,32 +102,29 @@ namespace Limitless::fx {
             const auto& indices = indexed_mesh.getIndices();
             using vector_size_type = typename std::remove_reference_t<decltype(indices)>::size_type;
             auto int_distribution = std::uniform_int_distribution(static_cast<vector_size_type>(0), indices.size() - 4);
-            return int_distribution(generator);
+            return int_distribution(RandomStream::get());
         }
 
         auto getTrianglePosition() {
             auto triangle_distribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
-            const auto r1 = glm::sqrt(triangle_distribution(generator));
-            const auto r2 = triangle_distribution(generator);
+            const auto r1 = glm::sqrt(triangle_distribution(RandomStream::get()));
+            const auto r2 = triangle_distribution(RandomStream::get());
             return std::pair{r1, r2};
         }
     public:
         explicit InitialMeshLocation(std::shared_ptr<AbstractMesh> _mesh) noexcept
                 : Module<Particle>(ModuleType::InitialMeshLocation)
-                , mesh {std::move(_mesh)}
-                , generator {std::random_device()()} {
+                , mesh {std::move(_mesh)} {
         }
 
         explicit InitialMeshLocation(std::shared_ptr<AbstractModel> _mesh) noexcept
                 : Module<Particle>(ModuleType::InitialMeshLocation)
-                , mesh {std::move(_mesh)}
-                , generator {std::random_device()()}{
+                , mesh {std::move(_mesh)} {
         }
 
         explicit InitialMeshLocation(std::shared_ptr<AbstractMesh> _mesh, const glm::vec3& _scale, const glm::vec3& _rotation) noexcept
             : Module<Particle>(ModuleType::InitialMeshLocation)
             , mesh {std::move(_mesh)}
-            , generator {std::random_device()()}
             , scale {_scale}
             , rotation {_rotation} {
         }
@@ -136,7 +132,6 @@ namespace Limitless::fx {
         explicit InitialMeshLocation(std::shared_ptr<AbstractModel> _mesh, const glm::vec3& _scale, const glm::vec3& _rotation) noexcept
             : Module<Particle>(ModuleType::InitialMeshLocation)
             , mesh {std::move(_mesh)}
-            , generator {std::random_device()()}
             , scale {_scale}
             , rotation {_rotation} {
         }
@@ -146,8 +141,18 @@ namespace Limitless::fx {
         InitialMeshLocation(const InitialMeshLocation&) = default;
         InitialMeshLocation& operator=(const InitialMeshLocation&) noexcept = default;
 
-        void attachModelInstance(ModelInstance* _instance) noexcept {
+        /**
+         * Emits particles from current pose of instance
+         *
+         * should be called from main thread: particles are initialized on pool threads, which only read skinned vertices
+         */
+        void attachModelInstance(ModelInstance* _instance) {
             instance = _instance;
+
+            // compute skinned vertices are read back only for instances particles are emitted from
+            if (instance && instance->getInstanceType() == InstanceType::Skeletal) {
+                static_cast<SkeletalInstance&>(*instance).enableSkinnedReadback(); //NOLINT
+            }
         }
 
         auto& getMesh() noexcept { return mesh; }
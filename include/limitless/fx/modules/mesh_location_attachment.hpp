@@ -13,7 +13,8 @@ namespace Limitless::fx {
             std::pair<float, float> triangle_position;
             glm::vec3 last_position;
         };
-        std::map<size_t, LocationCache> cache;
+        // indexed by particle
+        std::vector<LocationCache> cache;
     public:
         explicit MeshLocationAttachment(std::shared_ptr<AbstractMesh> mesh) noexcept
             : InitialMeshLocation<Particle>(ModuleType::MeshLocationAttachment, std::move(mesh)) {
@@ -35,22 +36,19 @@ namespace Limitless::fx {
             const auto mesh_position = this->getPositionOnMesh(selected_mesh, vertex_index, triangle_pos.first, triangle_pos.second);
             particle.position += mesh_position;
 
+            if (cache.size() <= index) {
+                cache.resize(index + 1);
+            }
+
             cache[index] = { selected_mesh, vertex_index, triangle_pos, mesh_position };
         }
 
         void deinitialize(const std::vector<size_t>& indices) override {
-            for (const auto& index : indices) {
-                cache.erase(index);
-            }
-
-            decltype(cache) new_cache;
-
-            size_t i {};
-            for (const auto& [_, c] : cache) {
-                new_cache.emplace(i++, c);
-            }
+            removeParticles(cache, indices);
+        }
 
-            cache = std::move(new_cache);
+        void reset() override {
+            cache.clear();
         }
 
         MeshLocationAttachment* clone() const noexcept override {
@@ -58,7 +56,7 @@ namespace Limitless::fx {
         }
 
         void update([[maybe_unused]] AbstractEmitter &emitter, std::vector<Particle> &particles, [[maybe_unused]] float dt, [[maybe_unused]] const Camera &camera) noexcept override {
-            for (size_t i = 0; i < particles.size(); ++i) {
+            for (size_t i = 0; i < std::min(particles.size(), cache.size()); ++i) {
                 auto& [selected_mesh, vertex_index, triangle, last_position] = cache[i];
                 const auto mesh_position = this->getPositionOnMesh(selected_mesh, vertex_index, triangle.first, triangle.second);
                 particles[i].position += mesh_position - last_position;
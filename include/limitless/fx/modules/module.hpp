@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <limitless/fx/emitters/abstract_emitter.hpp>
+#include <limitless/fx/particle.hpp>
 
 namespace Limitless {
     class Context;
@@ -56,10 +57,35 @@ namespace Limitless::fx {
 
         [[nodiscard]] const auto& getType() const noexcept { return type; }
 
+        /**
+         * Initializes particle that is going to be appended at specified index
+         */
         virtual void initialize([[maybe_unused]] AbstractEmitter& e, [[maybe_unused]] Particle& p, [[maybe_unused]] size_t index) noexcept {}
 
+        /**
+         * Initializes count particles that are going to be appended starting at specified index
+         *
+         * modules that sample distributions override it to draw values for whole spawn batch at once
+         */
+        virtual void initializeBatch(AbstractEmitter& e, Particle* particles, size_t index, size_t count) noexcept {
+            for (size_t i = 0; i < count; ++i) {
+                initialize(e, particles[i], index + i);
+            }
+        }
+
+        /**
+         * Called after dead particles were removed, only when there were any
+         *
+         * indices are ascending and refer to positions before removal; order of remaining particles is preserved,
+         * so module that keeps per particle data by index removes the same entries with removeParticles
+         */
         virtual void deinitialize([[maybe_unused]] const std::vector<size_t>& indices) {}
 
+        /**
+         * Called when all particles of emitter are dropped at once and emitter starts over
+         */
+        virtual void reset() {}
+
         virtual void update([[maybe_unused]] AbstractEmitter &emitter, [[maybe_unused]] std::vector<Particle> &particles, [[maybe_unused]] float dt, [[maybe_unused]] const Camera &camera) noexcept {}
     };
 }
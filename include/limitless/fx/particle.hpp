@@ -1,9 +1,11 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace Limitless {
     class VertexArray;
@@ -32,8 +34,7 @@ namespace Limitless::fx {
         float _pad {};
     };
 
-    struct alignas(64) MeshParticle {
-        glm::mat4 model;
+    struct MeshParticle {
         // vec4 color
         glm::vec4 color {1.0f};
         // xy - scaling factor; zw - frame uv
@@ -119,6 +120,60 @@ namespace Limitless::fx {
         glm::vec3 end {};
     };
 
+    /**
+     * Removes elements at ascending indices keeping order of the rest
+     *
+     * runs in linear time without allocations; used for particles and per particle data of modules
+     */
+    template<typename T>
+    void removeParticles(std::vector<T>& data, const std::vector<size_t>& indices) {
+        if (indices.empty() || indices.front() >= data.size()) {
+            return;
+        }
+
+        auto write = indices.front();
+        for (size_t i = 0; i < indices.size(); ++i) {
+            const auto begin = indices[i] + 1;
+            const auto end = std::min(i + 1 < indices.size() ? indices[i + 1] : data.size(), data.size());
+
+            for (auto read = begin; read < end; ++read) {
+                data[write++] = std::move(data[read]);
+            }
+        }
+
+        data.erase(data.begin() + static_cast<std::ptrdiff_t>(write), data.end());
+    }
+
+    /**
+     * Gets corners of world space box around particle
+     *
+     * extents are conservative: size of sprite is taken as world size of its side and
+     * mesh particles are assumed to have unit mesh
+     */
+    inline std::pair<glm::vec3, glm::vec3> getParticleBounds(const SpriteParticle& particle) noexcept {
+        const auto extent = glm::vec3{particle.size * 0.5f};
+        return { particle.position - extent, particle.position + extent };
+    }
+
+    inline std::pair<glm::vec3, glm::vec3> getParticleBounds(const MeshParticle& particle) noexcept {
+        const auto extent = particle.size * 0.5f;
+        return { particle.position - extent, particle.position + extent };
+    }
+
+    inline std::pair<glm::vec3, glm::vec3> getParticleBounds(const BeamParticle& particle) noexcept {
+        auto min = glm::min(particle.position, particle.target);
+        auto max = glm::max(particle.position, particle.target);
+
+        // built line already includes displacement
+        for (const auto& point : particle.derivative_line) {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        const auto extent = glm::vec3{particle.size * 0.5f + particle.displacement};
+        return { min - extent, max + extent };
+    }
+
     VertexArray& operator<<(VertexArray& vertex_array, const std::pair<SpriteParticle, const std::shared_ptr<Buffer>&>& attribute) noexcept;
     VertexArray& operator<<(VertexArray& vertex_array, const std::pair<BeamParticleMapping, const std::shared_ptr<Buffer>&>& attribute) noexcept;
 }
@@ -2,22 +2,122 @@
 
 #include <limitless/fx/emitters/abstract_emitter.hpp>
 #include <limitless/fx/emitters/beam_emitter.hpp>
+#include <limitless/fx/renderers/particle_stream.hpp>
+#include <limitless/fx/beam_ribbon.hpp>
 
 namespace Limitless::fx {
+    /**
+     * Draws beams as ribbons facing camera
+     *
+     * ribbons are either expanded on CPU to vertex buffer or, with gpu_beams renderer setting, in vertex shader
+     * from derivative line points, segments and particles in storage buffers
+     */
     template<>
     class EmitterRenderer<BeamParticle> : public AbstractEmitterRenderer {
     private:
-        VertexStream<BeamParticleMapping> stream;
+        // expanded ribbon vertices
+        ParticleStream<BeamParticleMapping> vertices;
+
+        ParticleStream<glm::vec4> points;
+        // first point of segment and particle index
+        ParticleStream<glm::uvec2> segments;
+        ParticleStream<BeamGpuParticle> particles;
+        VertexArray empty_vertex_array;
 
         const UniqueEmitterShader unique_type;
+
+        BeamRibbon::View view {};
+        bool gpu {};
+
+        static constexpr auto SHADER_POINT_BUFFER_NAME = "beam_points";
+        static constexpr auto SHADER_SEGMENT_BUFFER_NAME = "beam_segments";
+        static constexpr auto SHADER_PARTICLE_BUFFER_NAME = "beam_particles";
+
+        void appendVertices(const BeamEmitter& emitter) {
+            for (const auto& particle : emitter.getParticles()) {
+                const auto count = BeamRibbon::getSegmentCount(particle) * BeamRibbon::SEGMENT_VERTEX_COUNT;
+                if (count != 0) {
+                    BeamRibbon::expand(particle, view, vertices.allocate(count));
+                }
+            }
+        }
+
+        void appendLines(const BeamEmitter& emitter) {
+            for (const auto& particle : emitter.getParticles()) {
+                const auto segment_count = BeamRibbon::getSegmentCount(particle);
+                if (segment_count == 0) {
+                    continue;
+                }
+
+                const auto first = static_cast<uint32_t>(points.getCount());
+                const auto index = static_cast<uint32_t>(particles.getCount());
+
+                const auto& line = particle.derivative_line;
+                auto* point = points.allocate(line.size());
+                for (const auto& p : line) {
+                    *point++ = glm::vec4(p, 1.0f);
+                }
+
+                auto* segment = segments.allocate(segment_count);
+                for (uint32_t i = 0; i < segment_count; ++i) {
+                    *segment++ = glm::uvec2(first + i, index);
+                }
+
+                *particles.allocate(1) = BeamGpuParticle(particle);
+            }
+        }
+
+        void bind(Context& ctx) {
+            auto& buffers = ctx.getIndexedBuffers();
+            points.getBuffer()->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, SHADER_POINT_BUFFER_NAME));
+            segments.getBuffer()->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, SHADER_SEGMENT_BUFFER_NAME));
+            particles.getBuffer()->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, SHADER_PARTICLE_BUFFER_NAME));
+        }
     public:
-        EmitterRenderer(const BeamEmitter& emitter)
-            : stream {emitter.getSpawn().max_count * EMITTER_STORAGE_INSTANCE_COUNT, VertexStreamUsage::Dynamic, VertexStreamDraw::Triangles}
+        explicit EmitterRenderer(const BeamEmitter& emitter)
+            : vertices {emitter.getSpawn().max_count, Buffer::Type::Array}
+            , points {emitter.getSpawn().max_count, Buffer::Type::ShaderStorage}
+            , segments {emitter.getSpawn().max_count, Buffer::Type::ShaderStorage}
+            , particles {emitter.getSpawn().max_count, Buffer::Type::ShaderStorage}
             , unique_type {emitter.getUniqueShaderType()} {
         }
 
-        void update(ParticleCollector<BeamParticleMapping>& collector) {
-            stream.update(collector.yield());
+        /**
+         * Starts new frame of beams that are expanded for view on CPU or in vertex shader when gpu is set
+         */
+        void begin(const BeamRibbon::View& _view, bool _gpu) {
+            view = _view;
+            gpu = _gpu;
+
+            if (gpu) {
+                points.begin();
+                segments.begin();
+                particles.begin();
+            } else {
+                vertices.begin();
+            }
+        }
+
+        [[nodiscard]] bool overflowed() const noexcept override {
+            return gpu ? points.overflowed() || segments.overflowed() || particles.overflowed() : vertices.overflowed();
+        }
+
+        void restart() override {
+            if (gpu) {
+                points.restart();
+                segments.restart();
+                particles.restart();
+            } else {
+                vertices.restart();
+            }
+        }
+
+        void append(const BeamEmitter& emitter) {
+            if (gpu) {
+                appendLines(emitter);
+            } else {
+                appendVertices(emitter);
+            }
         }
 
         void draw(Context& ctx,
@@ -26,8 +126,9 @@ namespace Limitless::fx {
                   const ms::Material& material,
                   ms::Blending blending,
                   const UniformSetter& setter) {
+            const auto count = gpu ? segments.getCount() * BeamRibbon::SEGMENT_VERTEX_COUNT : vertices.getCount();
 
-            if (material.getBlending() != blending) {
+            if (count == 0 || material.getBlending() != blending) {
                 return;
             }
 
@@ -45,9 +146,25 @@ namespace Limitless::fx {
 
             setter(shader);
 
+            if (gpu) {
+                bind(ctx);
+            }
+
             shader.use();
 
-            stream.draw();
+            if (gpu) {
+                // vertices are pulled from storage buffers by gl_VertexID
+                empty_vertex_array.bind();
+                glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(count));
+
+                points.fence();
+                segments.fence();
+                particles.fence();
+            } else {
+                vertices.getVertexArray().bind();
+                glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(count));
+                vertices.fence();
+            }
         }
     };
-}
\ No newline at end of file
+}
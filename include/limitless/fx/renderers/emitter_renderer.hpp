@@ -8,7 +8,18 @@ namespace Limitless::fx {
     static constexpr auto EMITTER_STORAGE_INSTANCE_COUNT = 3;
 
     class AbstractEmitterRenderer {
+    public:
+        virtual ~AbstractEmitterRenderer() = default;
 
+        /**
+         * Whether particles of frame did not fit to renderer streams
+         */
+        [[nodiscard]] virtual bool overflowed() const noexcept = 0;
+
+        /**
+         * Drops particles of frame, so they are collected again to grown streams
+         */
+        virtual void restart() = 0;
     };
 
     template<typename Particle>
@@ -1,48 +1,47 @@
 #pragma once
 
 #include <limitless/fx/renderers/emitter_renderer.hpp>
+#include <limitless/fx/renderers/particle_stream.hpp>
+#include <limitless/fx/mesh_gpu_particle.hpp>
 
 namespace Limitless::fx {
     template<>
     class EmitterRenderer<MeshParticle> : public AbstractEmitterRenderer {
     private:
-        std::shared_ptr<Buffer> buffer;
-        uint64_t max_particle_count {};
-
-        uint64_t current_particle_count {};
+        // particles are packed, so shader builds their model matrices
+        ParticleStream<MeshGpuParticle> stream;
 
         const UniqueEmitterShader unique_type;
 
-        void checkStorageSize(uint64_t count) {
-            if (count > max_particle_count) {
-                max_particle_count = count;
-                buffer = Buffer::builder()
-                        .target(Buffer::Type::ShaderStorage)
-                        .usage(Buffer::Usage::DynamicDraw)
-                        .access(Buffer::MutableAccess::WriteOrphaning)
-                        .size(sizeof(MeshParticle) * max_particle_count)
-                        .build();
-            }
-        }
-
         static constexpr auto SHADER_MESH_BUFFER_NAME = "mesh_emitter_particles";
     public:
         explicit EmitterRenderer(const MeshEmitter& emitter)
-            : max_particle_count {emitter.getSpawn().max_count * EMITTER_STORAGE_INSTANCE_COUNT}
+            : stream {emitter.getSpawn().max_count, Buffer::Type::ShaderStorage}
             , unique_type {emitter.getUniqueShaderType()} {
-            buffer = Buffer::builder()
-                    .target(Buffer::Type::ShaderStorage)
-                    .usage(Buffer::Usage::DynamicDraw)
-                    .access(Buffer::MutableAccess::WriteOrphaning)
-                    .size(sizeof(MeshParticle) * max_particle_count)
-                    .build();
         }
 
-        void update(ParticleCollector<MeshParticle>& collector) {
-            const auto& particles = collector.yield();
-            checkStorageSize(particles.size());
-            current_particle_count = particles.size();
-            buffer->mapData(particles.data(), sizeof(MeshParticle) * current_particle_count);
+        void begin() {
+            stream.begin();
+        }
+
+        [[nodiscard]] bool overflowed() const noexcept override {
+            return stream.overflowed();
+        }
+
+        void restart() override {
+            stream.restart();
+        }
+
+        void append(const MeshEmitter& emitter) {
+            const auto& particles = emitter.getParticles();
+            if (particles.empty()) {
+                return;
+            }
+
+            auto* packed = stream.allocate(particles.size());
+            for (const auto& particle : particles) {
+                *packed++ = MeshGpuParticle(particle);
+            }
         }
 
         void draw(Context& ctx,
@@ -51,8 +50,8 @@ namespace Limitless::fx {
                   const std::shared_ptr<AbstractMesh>& mesh,
                   const ms::Material& material,
                   ms::Blending blending,
-                  const UniformSetter& setter) const {
-            if (current_particle_count == 0 || material.getBlending() != blending) {
+                  const UniformSetter& setter) {
+            if (stream.empty() || material.getBlending() != blending) {
                 return;
             }
 
@@ -69,13 +68,13 @@ namespace Limitless::fx {
 
             setter(shader);
 
-            Context::apply([this] (Context& ctx) {
-                buffer->bindBase(ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, SHADER_MESH_BUFFER_NAME));
-            });
+            stream.getBuffer()->bindBase(ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, SHADER_MESH_BUFFER_NAME));
 
             shader.use();
 
-            mesh->draw_instanced(current_particle_count);
+            mesh->draw_instanced(stream.getCount());
+
+            stream.fence();
         }
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <limitless/fx/renderers/emitter_renderer.hpp>
+#include <limitless/fx/particle.hpp>
+#include <limitless/core/vertex_array.hpp>
+#include <limitless/core/buffer/buffer_builder.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Limitless::fx {
+    /**
+     * Whether particles can be read as vertex attributes, i.e. VertexArray knows their layout
+     */
+    template<typename Particle, typename = void>
+    struct HasVertexLayout : std::false_type {};
+
+    template<typename Particle>
+    struct HasVertexLayout<Particle, std::void_t<decltype(std::declval<VertexArray&>() << std::declval<const std::pair<Particle, const std::shared_ptr<Buffer>&>&>())>>
+        : std::true_type {};
+
+    /**
+     * Persistently mapped buffers that particles of emitter renderer are written to
+     *
+     * every frame particles are appended straight to mapped memory of next buffer in ring,
+     * while GPU may still read previous ones; buffer is waited for only when it comes round again
+     *
+     * mappings are write-only, so stream never reads particles back: when frame does not fit, the rest of it
+     * is written to scratch memory, stream grows on restart and particles of frame are collected again
+     */
+    template<typename Particle>
+    class ParticleStream final {
+    private:
+        struct Region {
+            std::shared_ptr<Buffer> buffer;
+            std::unique_ptr<VertexArray> vertex_array;
+        };
+
+        std::array<Region, EMITTER_STORAGE_INSTANCE_COUNT> regions;
+        Buffer::Type target;
+
+        // particle capacity of every buffer
+        size_t capacity;
+
+        // particles requested in frame, exceeds capacity when stream overflows
+        size_t count {};
+        size_t current {};
+        Particle* mapped {};
+
+        // receives particles that do not fit, they are dropped
+        std::vector<std::aligned_storage_t<sizeof(Particle), alignof(Particle)>> scratch;
+
+        void initialize(Region& region) {
+            region.buffer = Buffer::builder()
+                    .target(target)
+                    .usage(Buffer::Storage::DynamicCoherentWrite)
+                    .access(Buffer::ImmutableAccess::WriteCoherent)
+                    .size(capacity * sizeof(Particle))
+                    .build();
+
+            if constexpr (HasVertexLayout<Particle>::value) {
+                region.vertex_array = std::make_unique<VertexArray>();
+                *region.vertex_array << std::pair<Particle, const std::shared_ptr<Buffer>&>(Particle{}, region.buffer);
+            }
+        }
+
+        [[nodiscard]] Particle* map(const Region& region) const {
+            return static_cast<Particle*>(region.buffer->mapBufferRange(0, static_cast<GLsizeiptr>(capacity * sizeof(Particle))));
+        }
+    public:
+        ParticleStream(size_t _capacity, Buffer::Type _target)
+            : target {_target}
+            , capacity {std::max<size_t>(_capacity, 1)} {
+            for (auto& region : regions) {
+                initialize(region);
+            }
+        }
+
+        /**
+         * Switches to next buffer and starts writing particles of frame from its beginning
+         */
+        void begin() {
+            current = (current + 1) % regions.size();
+            count = 0;
+
+            regions[current].buffer->waitFence();
+            mapped = map(regions[current]);
+        }
+
+        /**
+         * Starts writing particles of frame again into the same buffer, grows buffers if frame did not fit
+         */
+        void restart() {
+            if (overflowed()) {
+                // buffers still used by GPU are released by driver when it is done with them
+                capacity = std::max(count, capacity * 2);
+                for (auto& region : regions) {
+                    initialize(region);
+                }
+
+                mapped = map(regions[current]);
+            }
+
+            count = 0;
+        }
+
+        /**
+         * Reserves space for particles at the end of stream and returns memory to write them to
+         */
+        Particle* allocate(size_t particle_count) {
+            const auto first = count;
+            count += particle_count;
+
+            if (count > capacity) {
+                if (scratch.size() < particle_count) {
+                    scratch.resize(particle_count);
+                }
+                return reinterpret_cast<Particle*>(scratch.data());
+            }
+
+            return mapped + first;
+        }
+
+        void append(const Particle* particles, size_t particle_count) {
+            if (particle_count != 0) {
+                std::memcpy(allocate(particle_count), particles, particle_count * sizeof(Particle));
+            }
+        }
+
+        template<typename Particles>
+        void append(const Particles& particles) {
+            append(particles.data(), particles.size());
+        }
+
+        /**
+         * Whether particles of frame did not fit, stream should be restarted and particles collected again
+         */
+        [[nodiscard]] bool overflowed() const noexcept { return count > capacity; }
+
+        /**
+         * Marks buffer of frame as used by GPU commands issued so far
+         */
+        void fence() {
+            regions[current].buffer->fence();
+        }
+
+        [[nodiscard]] auto getCount() const noexcept { return std::min(count, capacity); }
+        [[nodiscard]] bool empty() const noexcept { return count == 0; }
+        [[nodiscard]] const auto& getBuffer() const noexcept { return regions[current].buffer; }
+        [[nodiscard]] auto& getVertexArray() const noexcept { return *regions[current].vertex_array; }
+    };
+}
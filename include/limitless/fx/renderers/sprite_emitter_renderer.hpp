@@ -1,7 +1,7 @@
 #pragma once
 
 #include <limitless/fx/renderers/emitter_renderer.hpp>
-#include <limitless/fx/emitters/visitor_collector.hpp>
+#include <limitless/fx/renderers/particle_stream.hpp>
 #include <limitless/fx/emitters/sprite_emitter.hpp>
 
 #include "limitless/core/shader/shader_program.hpp"
@@ -12,17 +12,37 @@ namespace Limitless::fx {
     template<>
     class EmitterRenderer<SpriteParticle> : public AbstractEmitterRenderer {
     private:
-        VertexStream<SpriteParticle> stream;
+        ParticleStream<SpriteParticle> stream;
+        std::vector<std::shared_ptr<SpriteGpuSimulation>> gpu_simulations;
 
         const UniqueEmitterShader unique_shader;
     public:
         explicit EmitterRenderer(const SpriteEmitter& emitter)
-            : stream {emitter.getSpawn().max_count * EMITTER_STORAGE_INSTANCE_COUNT, VertexStreamUsage::Dynamic, VertexStreamDraw::Points}
+            : stream {emitter.getSpawn().max_count, Buffer::Type::Array}
             , unique_shader {emitter.getUniqueShaderType()} {
         }
 
-        void update(ParticleCollector<SpriteParticle>& collector) {
-            stream.update(collector.yield());
+        void begin() {
+            stream.begin();
+            gpu_simulations.clear();
+        }
+
+        [[nodiscard]] bool overflowed() const noexcept override {
+            return stream.overflowed();
+        }
+
+        void restart() override {
+            stream.restart();
+            gpu_simulations.clear();
+        }
+
+        void append(const SpriteEmitter& emitter) {
+            // simulated particles are drawn straight from simulation buffers
+            if (emitter.getGpuSimulation()) {
+                gpu_simulations.emplace_back(emitter.getGpuSimulation());
+            } else {
+                stream.append(emitter.getParticles());
+            }
         }
 
         void draw(Context& ctx,
@@ -32,7 +52,7 @@ namespace Limitless::fx {
                   ms::Blending blending,
                   const UniformSetter& setter) {
 
-            if (material.getBlending() != blending) {
+            if ((stream.empty() && gpu_simulations.empty()) || material.getBlending() != blending) {
                 return;
             }
 
@@ -52,7 +72,15 @@ namespace Limitless::fx {
 
             shader.use();
 
-            stream.draw();
+            if (!stream.empty()) {
+                stream.getVertexArray().bind();
+                glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(stream.getCount()));
+                stream.fence();
+            }
+
+            for (const auto& simulation : gpu_simulations) {
+                simulation->draw();
+            }
         }
     };
 }
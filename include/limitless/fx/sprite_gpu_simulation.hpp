@@ -0,0 +1,108 @@
+#pragma once
+
+#include <limitless/fx/particle.hpp>
+
+#include <glm/gtx/quaternion.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace Limitless {
+    class Context;
+    class Buffer;
+    class ShaderProgram;
+    class Sync;
+    class VertexArray;
+}
+
+namespace Limitless::fx {
+    class SpriteEmitter;
+
+    /**
+     * Simulates particles of sprite emitter in compute shader
+     *
+     * particles live in two storage buffers that are swapped every update: alive particles of one buffer
+     * and particles spawned on CPU since last update are simulated and appended to another one through
+     * atomic counter, which is vertex count of indirect draw command at the same time
+     */
+    class SpriteGpuSimulation final {
+    public:
+        static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+        // DrawArraysIndirectCommand
+        struct DrawCommand {
+            uint32_t count;
+            uint32_t instance_count;
+            uint32_t first;
+            uint32_t base_instance;
+        };
+    private:
+        std::array<std::shared_ptr<Buffer>, 2> particles;
+        std::array<std::shared_ptr<Buffer>, 2> commands;
+        std::array<std::unique_ptr<VertexArray>, 2> vertex_arrays;
+        std::shared_ptr<Buffer> spawned;
+
+        size_t capacity {};
+        uint32_t current {};
+        uint32_t seed {};
+
+        // time that is not converted to subUV frames yet
+        float subuv_time {};
+
+        /**
+         * Alive count copied after fenced dispatch, read once fence is signaled so it never stalls
+         */
+        std::shared_ptr<Buffer> alive_readback;
+        std::unique_ptr<Sync> alive_sync;
+
+        // spawns uploaded since fenced dispatch, they are not in copied count yet
+        size_t spawned_since_fence {};
+
+        // upper bound of alive particles, deaths are known only once count is read back
+        size_t alive {};
+
+        void initialize(size_t capacity);
+        void fetchAliveCount();
+        void fenceAliveCount(uint32_t output);
+        void setModuleUniforms(ShaderProgram& shader, const SpriteEmitter& emitter, float dt);
+    public:
+        SpriteGpuSimulation() = default;
+        ~SpriteGpuSimulation();
+
+        SpriteGpuSimulation(const SpriteGpuSimulation&) = delete;
+        SpriteGpuSimulation& operator=(const SpriteGpuSimulation&) = delete;
+
+        /**
+         * Appends spawned particles and simulates all of them for dt
+         */
+        void simulate(Context& ctx, ShaderProgram& shader, const SpriteEmitter& emitter, const std::vector<SpriteParticle>& spawned_particles, float dt);
+
+        /**
+         * Appends alive simulated particles to specified vector
+         *
+         * waits for simulation to finish, so it is meant for switching emitter back to CPU only
+         */
+        void readBack(std::vector<SpriteParticle>& out) const;
+
+        /**
+         * Returns upper bound of particles alive on GPU, it lags behind by a few frames but never undercounts
+         */
+        [[nodiscard]] auto getAliveCount() const noexcept { return alive; }
+
+        /**
+         * Drops all simulated particles, buffers are kept
+         */
+        void clear();
+
+        /**
+         * Draws alive particles as points with currently used shader
+         */
+        void draw() const;
+
+        /**
+         * Name of simulation shader for emitter modules
+         */
+        [[nodiscard]] static std::string getShaderName(const SpriteEmitter& emitter);
+    };
+}
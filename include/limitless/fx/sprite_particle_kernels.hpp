@@ -0,0 +1,60 @@
+#pragma once
+
+#include <limitless/fx/sprite_particle_storage.hpp>
+#include <limitless/fx/modules/distribution.hpp>
+
+namespace Limitless::fx::kernels {
+    /**
+     * Per component particle update loops
+     *
+     * loops are branch free over plain float arrays, so compiler emits vector instructions
+     * of target architecture for them
+     */
+
+    // value += (target - value) / (lifetime / dt)
+    void approach(float* value, const float* lifetime, float target, float dt, size_t count) noexcept;
+    void approach(float* value, const float* lifetime, const float* target, float dt, size_t count) noexcept;
+
+    void clampMin(float* value, float min, size_t count) noexcept;
+
+    // value += delta
+    void add(float* value, float delta, size_t count) noexcept;
+
+    // value += rate * scale
+    void addScaled(float* value, const float* rate, float scale, size_t count) noexcept;
+
+    // position += velocity * dt; velocity += acceleration * dt
+    void integrate(float* position, float* velocity, const float* acceleration, float dt, size_t count) noexcept;
+}
+
+namespace Limitless::fx {
+    /**
+     * Update stages of sprite emitter modules that are run by kernels
+     *
+     * null distribution means module is not present
+     */
+    class SpriteKernelModules {
+    public:
+        Distribution<glm::vec3>* velocity_by_life {};
+        Distribution<glm::vec4>* color_by_life {};
+        Distribution<glm::vec3>* rotation_rate {};
+        Distribution<float>* size_by_life {};
+        bool time {};
+        bool lifetime {};
+
+        // emitter rotation with local rotation
+        glm::quat rotation {1.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    /**
+     * Runs update stages of modules and integration for all particles in one pass
+     *
+     * particles are processed in blocks small enough to stay in cache while every stage is applied to them
+     */
+    void updateSprites(SpriteParticleStorage& storage, const SpriteKernelModules& modules, float dt);
+
+    /**
+     * Runs update for particles in [begin, end), disjoint ranges may be updated from different threads
+     */
+    void updateSprites(SpriteParticleStorage& storage, const SpriteKernelModules& modules, float dt, size_t begin, size_t end);
+}
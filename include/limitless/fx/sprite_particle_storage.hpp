@@ -0,0 +1,61 @@
+#pragma once
+
+#include <limitless/fx/particle.hpp>
+
+#include <glm/gtx/quaternion.hpp>
+
+#include <vector>
+
+namespace Limitless::fx {
+    /**
+     * Structure of arrays storage of sprite particles
+     *
+     * every component of particle attributes is kept in its own tightly packed array,
+     * so update kernels process consecutive particles with vector instructions;
+     * SpriteParticle layout is produced only when particles are packed for upload
+     */
+    class SpriteParticleStorage final {
+    public:
+        struct Vec3Stream {
+            std::vector<float> x, y, z;
+        };
+
+        struct Vec4Stream {
+            std::vector<float> x, y, z, w;
+        };
+
+        Vec4Stream color;
+        Vec4Stream subUV;
+        Vec4Stream properties;
+        Vec3Stream acceleration;
+        Vec3Stream position;
+        Vec3Stream rotation;
+        Vec3Stream velocity;
+        std::vector<float> lifetime;
+        std::vector<float> size;
+        std::vector<float> time;
+
+        [[nodiscard]] size_t count() const noexcept { return lifetime.size(); }
+        [[nodiscard]] bool empty() const noexcept { return lifetime.empty(); }
+
+        void push(const SpriteParticle& particle);
+        [[nodiscard]] SpriteParticle get(size_t index) const noexcept;
+
+        /**
+         * Removes particles with expired lifetime keeping order of others
+         *
+         * specified vector is refilled with ascending indices of removed particles
+         */
+        void removeDead(std::vector<size_t>& indices);
+
+        /**
+         * Writes particles in GPU layout
+         */
+        void pack(std::vector<SpriteParticle>& particles) const;
+
+        void translate(const glm::vec3& offset) noexcept;
+        void rotate(const glm::quat& rotation) noexcept;
+
+        void clear() noexcept;
+    };
+}
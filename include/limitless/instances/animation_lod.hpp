@@ -0,0 +1,95 @@
+#pragma once
+
+#include <limitless/util/frustum.hpp>
+#include <limitless/util/screen_size.hpp>
+#include <array>
+#include <optional>
+#include <cstdint>
+
+namespace Limitless {
+    /**
+     * Animation level of detail thresholds
+     *
+     * level is selected by screen size of instance, radius of its bounding sphere
+     * divided by half height of view at instance distance
+     */
+    class AnimationLodSettings {
+    public:
+        static constexpr size_t LEVEL_COUNT = 4;
+
+        bool enabled {true};
+
+        /**
+         * Minimal screen size of levels 0, 1 and 2, smaller instances get the last level
+         */
+        std::array<float, LEVEL_COUNT - 1> screen_size {0.25f, 0.1f, 0.04f};
+
+        /**
+         * Frames between pose evaluations for each level, poses in between are interpolated
+         */
+        std::array<uint32_t, LEVEL_COUNT> update_interval {1, 2, 4, 4};
+
+        /**
+         * First level on which leaf bones keep their bind transform
+         */
+        uint32_t skip_leaf_bones_level {2};
+
+        /**
+         * Whether instances outside of view frustum are not evaluated unless something is attached to their bones
+         */
+        bool skip_culled {true};
+    };
+
+    /**
+     * Selects animation LOD of skeletal instances and counts evaluation work for current frame
+     */
+    class AnimationLod final {
+    public:
+        /**
+         * Level of instances that are not evaluated at all
+         */
+        static constexpr uint32_t CULLED = ~0u;
+
+        class Stats {
+        public:
+            uint64_t evaluated_instances {};
+            uint64_t interpolated_instances {};
+            uint64_t skipped_instances {};
+
+            /**
+             * Sampled animated bones of evaluated instances
+             */
+            uint64_t evaluated_bones {};
+        };
+    private:
+        AnimationLodSettings settings;
+        Stats stats;
+
+        std::optional<Frustum> frustum;
+        ScreenSize screen_size;
+    public:
+        AnimationLod() = default;
+        explicit AnimationLod(const AnimationLodSettings& settings) noexcept;
+
+        /**
+         * Prepares selection for camera and resets frame counters
+         */
+        void beginFrame(const Camera& camera);
+
+        /**
+         * Selects level for instance bounding box
+         */
+        [[nodiscard]] uint32_t select(const Box& box, bool has_sockets) const;
+
+        [[nodiscard]] uint32_t getUpdateInterval(uint32_t level) const noexcept;
+        [[nodiscard]] bool shouldSkipLeaves(uint32_t level) const noexcept;
+
+        void onEvaluated(size_t bones) noexcept { ++stats.evaluated_instances; stats.evaluated_bones += bones; }
+        void onInterpolated() noexcept { ++stats.interpolated_instances; }
+        void onSkipped() noexcept { ++stats.skipped_instances; }
+
+        void setSettings(const AnimationLodSettings& settings) noexcept;
+        [[nodiscard]] const auto& getSettings() const noexcept { return settings; }
+        [[nodiscard]] const auto& getStats() const noexcept { return stats; }
+    };
+}
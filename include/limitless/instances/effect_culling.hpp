@@ -0,0 +1,78 @@
+#pragma once
+
+#include <limitless/util/frustum.hpp>
+#include <chrono>
+#include <optional>
+#include <cstdint>
+
+namespace Limitless::fx {
+    class AbstractEmitter;
+}
+
+namespace Limitless {
+    /**
+     * Culling of effect emitters by their bounds
+     */
+    class EffectCullingSettings {
+    public:
+        bool enabled {true};
+
+        /**
+         * Emitters outside of view frustum that are farther than this from camera are not simulated
+         *
+         * closer ones are still simulated, so they look right when camera turns to them
+         */
+        float distance {25.0f};
+
+        /**
+         * Longest skipped time that is simulated when emitter is updated again, zero resumes emitter where it stopped
+         */
+        std::chrono::duration<float> catch_up {1.0f};
+    };
+
+    /**
+     * Decides which emitters of effects are drawn and simulated in current frame
+     */
+    class EffectCulling final {
+    public:
+        class Stats {
+        public:
+            uint64_t visible_emitters {};
+
+            /**
+             * Emitters that are simulated but not drawn
+             */
+            uint64_t culled_emitters {};
+
+            /**
+             * Emitters that are neither simulated nor drawn
+             */
+            uint64_t suspended_emitters {};
+        };
+    private:
+        EffectCullingSettings settings;
+        Stats stats;
+
+        std::optional<Frustum> frustum;
+        glm::vec3 camera_position {0.0f};
+    public:
+        EffectCulling() = default;
+        explicit EffectCulling(const EffectCullingSettings& settings) noexcept;
+
+        /**
+         * Prepares culling for camera and resets frame counters
+         */
+        void beginFrame(const Camera& camera);
+
+        /**
+         * Marks emitter culled when it is out of view and suspends it when it is also far away
+         *
+         * returns whether emitter should be simulated; emitters without known bounds are always visible
+         */
+        bool select(fx::AbstractEmitter& emitter);
+
+        void setSettings(const EffectCullingSettings& settings) noexcept;
+        [[nodiscard]] const auto& getSettings() const noexcept { return settings; }
+        [[nodiscard]] const auto& getStats() const noexcept { return stats; }
+    };
+}
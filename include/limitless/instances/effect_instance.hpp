@@ -39,12 +39,21 @@ namespace Limitless {
          */
         std::string name;
 
+        /**
+         * Whether bounding box contains all particles, it is not when some emitter does not know its bounds
+         */
+        bool bounded {false};
+
         /**
          * Checks if effect is finished
          */
         bool isDone() const noexcept;
 
-        void updateEmitters(const Camera& camera) const noexcept;
+        // sets instance transformation to emitters
+        void placeEmitters() const noexcept;
+
+        // merges bounds of emitters unless custom box is set
+        void updateBoundingBox() noexcept override;
 
         friend class fx::EffectBuilder;
         friend class EffectSerializer;
@@ -72,6 +81,34 @@ namespace Limitless {
          */
         void update(const Camera &camera) override;
 
+        /**
+         * Updates instance and places emitters without updating them
+         *
+         * emitters are then updated by caller, so emitters of many effects can be updated in parallel;
+         * finishUpdate should be called after that
+         */
+        void prepareUpdate(const Camera& camera);
+        void finishUpdate() noexcept;
+
+        /**
+         * Restarts random streams of emitters
+         *
+         * effects with the same seed produce the same particles; instance id is used by default
+         */
+        void setSeed(uint64_t seed) noexcept;
+
+        /**
+         * Starts effect over at position as if it was just created from its effect
+         *
+         * emitters drop their particles but keep modules and allocated memory; instance gets new id and seed
+         */
+        void reset(const glm::vec3& position);
+
+        /**
+         * Whether effect can be culled by its bounding box
+         */
+        [[nodiscard]] bool isBounded() const noexcept { return bounded; }
+
         const auto& getEmitters() const noexcept { return emitters; }
         auto& getEmitters() noexcept { return emitters; }
         const auto& getName() const noexcept { return name; }
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Limitless {
+    class EffectInstance;
+
+    /**
+     * Recycles effect instances created from the same effect
+     *
+     * new instance of effect clones all of its emitters and modules and allocates instance buffer;
+     * pool hands out killed instances of effect instead, reset to their initial state. Instance is recycled
+     * once it is killed and nobody but pool holds it anymore, i.e. after scene removed it
+     */
+    class EffectPool final {
+    public:
+        struct Stats {
+            // instances constructed by pool, including prewarmed ones
+            size_t created {};
+            // acquisitions served by recycled instances
+            size_t reused {};
+            // instances handed out and not recycled yet
+            size_t active {};
+            // instances waiting to be handed out
+            size_t idle {};
+
+            Stats& operator+=(const Stats& rhs) noexcept;
+        };
+    private:
+        struct Entry {
+            // keeps effect alive while its instances are pooled
+            std::shared_ptr<EffectInstance> effect;
+            std::vector<std::shared_ptr<EffectInstance>> active;
+            std::vector<std::shared_ptr<EffectInstance>> idle;
+            Stats stats;
+        };
+
+        std::unordered_map<const EffectInstance*, Entry> entries;
+
+        Entry& getEntry(const std::shared_ptr<EffectInstance>& effect);
+
+        // moves instances that are done with to idle ones
+        static void collect(Entry& entry);
+    public:
+        EffectPool() = default;
+        ~EffectPool() = default;
+
+        EffectPool(const EffectPool&) = delete;
+        EffectPool& operator=(const EffectPool&) = delete;
+
+        /**
+         * Creates idle instances of effect up to count, so first acquisitions do not allocate
+         */
+        void prewarm(const std::shared_ptr<EffectInstance>& effect, size_t count);
+
+        /**
+         * Gets instance of effect at position, recycled one if there is any
+         */
+        std::shared_ptr<EffectInstance> acquire(const std::shared_ptr<EffectInstance>& effect, const glm::vec3& position);
+
+        /**
+         * Recycles instances of all effects that are done with
+         *
+         * it is done by acquire on its own when there are no idle instances of effect
+         */
+        void collect();
+
+        /**
+         * Drops idle instances of effect, active ones are not tracked anymore
+         */
+        void clear(const std::shared_ptr<EffectInstance>& effect);
+        void clear();
+
+        [[nodiscard]] Stats getStats(const std::shared_ptr<EffectInstance>& effect) const;
+        [[nodiscard]] Stats getStats() const;
+    };
+}
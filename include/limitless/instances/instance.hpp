@@ -105,6 +105,13 @@ namespace Limitless {
          */
 		bool shadow_cast {true};
 
+        /**
+         * Whether instance geometry does not move
+         *
+         * Static instances are rendered into cached shadow map layers only when cache gets invalidated
+         */
+        bool static_geometry {};
+
         /**
          * Does instance outlined
          */
@@ -167,6 +174,13 @@ namespace Limitless {
         void updateInstanceBuffer() noexcept;
 
         Instance(InstanceType shader_type, const glm::vec3& position) noexcept;
+
+        /**
+         * Returns instance to state of newly constructed one at position, keeping its instance buffer
+         *
+         * instance gets new id, so it is not mistaken for the one it was before
+         */
+        void reset(const glm::vec3& position) noexcept;
     public:
         ~Instance() override = default;
 
@@ -216,6 +230,18 @@ namespace Limitless {
          */
 		void removeShadow() noexcept;
 
+        /**
+         * Marks instance as static shadow caster
+         *
+         * note: moving static instance does not invalidate shadow cache automatically
+         */
+        void makeStatic() noexcept;
+
+        /**
+         * Marks instance as dynamic shadow caster
+         */
+        void makeDynamic() noexcept;
+
         /**
          * Instance does not get rendered
          */
@@ -242,6 +268,7 @@ namespace Limitless {
         void removePicking() noexcept;
 
 		[[nodiscard]] bool doesCastShadow() const noexcept;
+		[[nodiscard]] bool isStatic() const noexcept;
 		[[nodiscard]] bool isOutlined() const noexcept;
 		[[nodiscard]] bool isHidden() const noexcept;
 		[[nodiscard]] bool isKilled() const noexcept;
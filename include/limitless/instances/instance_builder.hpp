@@ -25,6 +25,7 @@ namespace Limitless {
         glm::vec3 position_ {0.0f};
         glm::vec3 scale_ {1.0f};
         bool cast_shadow_ {true};
+        bool static_ {false};
         std::optional<Box> bounding_box_ {};
         uint8_t decal_mask {0xFF};
 
@@ -122,6 +123,11 @@ namespace Limitless {
          */
         Builder& cast_shadow(bool cast_shadow);
 
+        /**
+         *  Sets whether instance is static geometry (used for cached shadows)
+         */
+        Builder& static_geometry(bool static_geometry);
+
         /**
          *  Sets custom bounding box
          *
@@ -18,7 +18,9 @@ namespace Limitless {
 
         std::vector<Data> current_instance_data;
 
-        void updateInstanceBuffer();
+        virtual void updateInstanceBuffer();
+
+        explicit InstancedInstance(InstanceType type);
     public:
         InstancedInstance();
         ~InstancedInstance() override = default;
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <limitless/fx/emitters/emitter_lod.hpp>
+#include <limitless/util/screen_size.hpp>
+#include <array>
+#include <optional>
+#include <vector>
+#include <cstdint>
+
+namespace Limitless::fx {
+    class AbstractEmitter;
+}
+
+namespace Limitless {
+    class Camera;
+
+    /**
+     * Particle level of detail thresholds and budget
+     *
+     * level is selected by screen size of emitter, radius of its bounds
+     * divided by half height of view at their distance
+     */
+    class ParticleLodSettings {
+    public:
+        bool enabled {true};
+
+        /**
+         * Minimal screen size of levels 0, 1 and 2, smaller emitters get the last level
+         */
+        std::array<float, fx::EmitterLod::LEVEL_COUNT - 1> screen_size {0.2f, 0.08f, 0.03f};
+
+        /**
+         * Levels of emitters that do not have their own
+         *
+         * full detail by default, so only emitters with their own levels are reduced;
+         * set it to e.g. fx::EmitterLod {} to reduce every effect with distance
+         */
+        fx::EmitterLod default_lod {fx::EmitterLod::full()};
+
+        /**
+         * Particles that simulated emitters may have together, 0 for no limit
+         *
+         * max counts of emitters on their levels are summed; when they exceed budget,
+         * emitters with the smallest screen size are throttled first
+         */
+        uint64_t particle_budget {0};
+    };
+
+    /**
+     * Selects level of detail of effect emitters and fits them into particle budget
+     */
+    class ParticleLod final {
+    public:
+        class Stats {
+        public:
+            std::array<uint64_t, fx::EmitterLod::LEVEL_COUNT> emitters {};
+
+            /**
+             * Sum of max counts of emitters after budget is applied
+             */
+            uint64_t budgeted_particles {};
+
+            /**
+             * Emitters that got fewer particles than their level allows
+             */
+            uint64_t throttled_emitters {};
+        };
+    private:
+        struct Selected {
+            fx::AbstractEmitter* emitter;
+            float screen_size;
+            uint64_t particles;
+        };
+
+        ParticleLodSettings settings;
+        Stats stats;
+
+        std::vector<Selected> selected;
+
+        ScreenSize screen_size;
+
+        [[nodiscard]] float getScreenSize(const std::optional<Box>& bounds) const noexcept;
+    public:
+        ParticleLod() = default;
+        explicit ParticleLod(const ParticleLodSettings& settings) noexcept;
+
+        /**
+         * Prepares selection for camera and resets frame counters
+         */
+        void beginFrame(const Camera& camera);
+
+        /**
+         * Gets level for emitter bounds, emitters without known bounds get the first level
+         */
+        [[nodiscard]] uint32_t getLevel(const std::optional<Box>& bounds) const noexcept;
+
+        /**
+         * Sets level to emitter that is going to be simulated in current frame
+         */
+        void select(fx::AbstractEmitter& emitter);
+
+        /**
+         * Throttles least important selected emitters until they fit particle budget
+         */
+        void applyBudget();
+
+        void setSettings(const ParticleLodSettings& settings) noexcept;
+        [[nodiscard]] const auto& getSettings() const noexcept { return settings; }
+        [[nodiscard]] const auto& getStats() const noexcept { return stats; }
+    };
+}
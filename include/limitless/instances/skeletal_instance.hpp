@@ -3,10 +3,13 @@
 #include <limitless/instances/model_instance.hpp>
 #include <limitless/instances/socket_attachment.hpp>
 #include <limitless/models/skeletal_model.hpp>
+#include <limitless/models/animation_blender.hpp>
+#include <limitless/instances/skinned_vertices.hpp>
 #include <chrono>
 
 namespace Limitless {
     class Buffer;
+    class AnimationLod;
 
     class no_such_animation : public std::runtime_error {
     public:
@@ -25,6 +28,11 @@ namespace Limitless {
          */
         std::vector<glm::mat4> bone_transform;
 
+        /**
+         * Global transformations of flattened skeleton nodes
+         */
+        std::vector<glm::mat4> global_transform;
+
         /**
          * OpenGL buffer for bone transformations
          */
@@ -35,6 +43,11 @@ namespace Limitless {
          */
         const Animation* animation {};
 
+        /**
+         * Keyframe cursors for each node of current animation
+         */
+        std::vector<AnimationNode::Cursor> cursors;
+
         /**
          * Is animation paused
          */
@@ -50,13 +63,81 @@ namespace Limitless {
          */
         std::chrono::duration<double> animation_duration {};
 
+        /**
+         * Pose shared through model PoseCache, overrides own bone transformations when set
+         */
+        std::shared_ptr<PoseCache::Pose> shared_pose;
+        const Animation* shared_animation {};
+        uint64_t shared_frame {};
+
+        /**
+         * Whether animation time is quantized and pose is shared with other instances
+         */
+        bool pose_sharing {};
+
+        /**
+         * Layered playback, when not empty overrides single animation
+         */
+        AnimationBlender blender;
+
+        /**
+         * Vertices skinned by SkinningPass, created on first dispatch when compute skinning is enabled
+         */
+        std::unique_ptr<SkinnedVertices> skinned_vertices;
+
+        /**
+         * Animation LOD level selected for current frame
+         */
+        uint32_t lod_level {};
+        uint32_t frames_since_evaluation {};
+
+        /**
+         * Decomposed bone transformation, interpolated component-wise so rotations do not shrink the mesh
+         */
+        class BonePose {
+        public:
+            glm::vec3 translation;
+            glm::quat rotation;
+            glm::vec3 scale;
+        };
+
+        /**
+         * Bone transformations interpolated between evaluations on throttled levels
+         */
+        std::vector<BonePose> lod_from;
+        std::vector<BonePose> lod_to;
+
         void initializeBuffer();
 
+        [[nodiscard]] const Animation& findAnimation(const std::string& name) const;
+
+        /**
+         * Moves current animation into blender as the first layer
+         */
+        void beginBlending();
+
+        /**
+         * Evaluates bone transformations of current animation at specified time
+         *
+         * returns count of sampled bones
+         */
+        size_t evaluatePose(double animation_time, bool skip_leaves = false);
+
+        /**
+         * Interpolates throttled pose instead of evaluation when LOD allows it
+         *
+         * returns whether evaluation should be skipped for current frame
+         */
+        bool skipEvaluation(AnimationLod* lod);
+        void storePose(std::vector<BonePose>& pose) const;
+        void interpolatePose(float factor);
+        void beginEvaluation(const AnimationLod* lod);
+        void finishEvaluation(AnimationLod* lod, size_t bones);
+
         /**
          * Updates bone transformation for current animation frame
          */
-        void updateAnimationFrame();
-        [[nodiscard]] const AnimationNode* findAnimationNode(const Bone& bone) const noexcept;
+        void updateAnimationFrame(AnimationLod* lod);
     public:
         /**
          * Creates instance with SkeletalModel
@@ -77,6 +158,11 @@ namespace Limitless {
          */
         void update(const Camera &camera) override;
 
+        /**
+         * Updates instance with animation evaluated according to LOD
+         */
+        void update(const Camera& camera, AnimationLod& lod);
+
         /**
          * Plays animation with name
          *
@@ -85,6 +171,25 @@ namespace Limitless {
         SkeletalInstance& play(const std::string& name);
         SkeletalInstance& play(uint32_t index);
 
+        /**
+         * Smoothly switches to animation with name during duration in seconds
+         *
+         * throws no_such_animation if not found
+         */
+        SkeletalInstance& crossfade(const std::string& name, double duration);
+
+        /**
+         * Adds weighted layer on top of current animation, optionally limited by mask
+         *
+         * throws no_such_animation if not found
+         */
+        SkeletalInstance& addLayer(const std::string& name, float weight, std::shared_ptr<const BoneMask> mask = {}, bool additive = false);
+
+        /**
+         * Changes weight of blender layer during duration in seconds
+         */
+        SkeletalInstance& fadeLayer(size_t index, float weight, double duration);
+
         /**
          * Pauses current animation
          */
@@ -100,17 +205,42 @@ namespace Limitless {
          */
         SkeletalInstance& stop() noexcept;
 
+        /**
+         * Quantizes animation time and shares evaluated pose with other instances of the same model
+         *
+         * on throttled LOD levels shared frames are sampled less often instead of interpolated
+         */
+        SkeletalInstance& enablePoseSharing() noexcept;
+        SkeletalInstance& disablePoseSharing() noexcept;
+
+        /**
+         * Keeps CPU copy of compute skinned vertices, used by getSkinnedVertexPosition
+         */
+        SkeletalInstance& enableSkinnedReadback();
+        SkeletalInstance& disableSkinnedReadback() noexcept;
+
         [[nodiscard]] auto isPaused() const noexcept { return paused; }
+        [[nodiscard]] auto isPoseShared() const noexcept { return pose_sharing; }
+        [[nodiscard]] auto getAnimationLevel() const noexcept { return lod_level; }
         [[nodiscard]] const auto& getCurrentAnimation() const noexcept { return animation; }
+        [[nodiscard]] const auto& getBlender() const noexcept { return blender; }
         [[nodiscard]] const std::vector<Animation>& getAllAnimations() const noexcept;
         const std::vector<Bone>& getAllBones() const noexcept;
-        const auto& getBoneBuffer() const noexcept { return bone_buffer; }
+        const std::shared_ptr<Buffer>& getBoneBuffer() const noexcept;
+
+        /**
+         * Returns compute skinning output, creates it on first call
+         */
+        SkinnedVertices& getSkinnedVertices();
+        [[nodiscard]] const SkinnedVertices* findSkinnedVertices() const noexcept { return skinned_vertices.get(); }
 
         /**
          * Calculates transformed vertex position on specified instance mesh for specified vertex
+         *
+         * uses read back compute skinning result when available, skins on CPU otherwise
          */
         [[nodiscard]] glm::vec3 getSkinnedVertexPosition(const std::shared_ptr<AbstractMesh>& mesh, size_t vertex_index) const;
 
-        const auto& getBoneTransform() const noexcept { return bone_transform; }
+        const std::vector<glm::mat4>& getBoneTransform() const noexcept;
     };
 }
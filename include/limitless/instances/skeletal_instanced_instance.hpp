@@ -0,0 +1,100 @@
+#pragma once
+
+#include <limitless/instances/instanced_instance.hpp>
+#include <limitless/models/baked_animations.hpp>
+#include <unordered_map>
+#include <chrono>
+
+namespace Limitless {
+    /**
+     * SkeletalInstancedInstance draws crowds of SkeletalModel instances in single instanced draw call
+     *
+     * animations are baked into BakedAnimations, each instance only supplies (animation, time)
+     * and vertex shader fetches and blends bone palette, so there is no per-instance hierarchy evaluation
+     *
+     * materials of model should be compiled for InstanceType::SkeletalInstanced
+     */
+    class SkeletalInstancedInstance final : public InstancedInstance {
+    public:
+        /**
+         * Animation state of single instance
+         */
+        class AnimationState {
+        public:
+            uint32_t animation {};
+            double time {};
+            float speed {1.0f};
+            bool paused {};
+        };
+    private:
+        /**
+         * Animation data mapped to GPU for each visible instance, mirrors InstanceAnimation in shader
+         */
+        class AnimationData {
+        public:
+            uint32_t animation;
+            float time;
+        };
+
+        std::shared_ptr<BakedAnimations> baked;
+
+        /**
+         * Animation states by instance id
+         */
+        std::unordered_map<uint64_t, AnimationState> states;
+
+        std::shared_ptr<Buffer> animation_buffer;
+        std::vector<AnimationData> animation_data;
+
+        /**
+         * Ids of instances animation buffer is uploaded for and whether their states changed since
+         *
+         * render passes of one frame set the same visible subset, so buffer is uploaded once per frame
+         */
+        std::vector<uint64_t> uploaded_ids;
+        bool animation_dirty {true};
+
+        std::chrono::time_point<std::chrono::steady_clock> last_time;
+
+        void advance();
+        void updateAnimationBuffer();
+        [[nodiscard]] bool isAnimationBufferUpToDate() const noexcept;
+        void updateInstanceBuffer() override;
+    public:
+        explicit SkeletalInstancedInstance(std::shared_ptr<BakedAnimations> baked);
+        ~SkeletalInstancedInstance() override = default;
+
+        SkeletalInstancedInstance(const SkeletalInstancedInstance& rhs);
+        SkeletalInstancedInstance(SkeletalInstancedInstance&&) noexcept = default;
+
+        std::unique_ptr<Instance> clone() noexcept override;
+
+        /**
+         * Adds instance playing specified animation
+         */
+        void add(const std::shared_ptr<ModelInstance>& instance, uint32_t animation = 0);
+        void remove(uint64_t id);
+
+        /**
+         * Plays animation on instance from the beginning
+         *
+         * throws no_such_animation if not found
+         */
+        void play(uint64_t id, uint32_t animation);
+        void play(uint64_t id, const std::string& name);
+
+        void pause(uint64_t id);
+        void resume(uint64_t id);
+        void setSpeed(uint64_t id, float speed);
+
+        void update(const Camera &camera) override;
+
+        /**
+         * Binds baked palettes and per-instance animation data
+         */
+        void bind(Context& ctx) const;
+
+        [[nodiscard]] const auto& getBakedAnimations() const noexcept { return baked; }
+        [[nodiscard]] const AnimationState& getAnimationState(uint64_t id) const { return states.at(id); }
+    };
+}
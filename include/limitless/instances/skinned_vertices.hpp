@@ -0,0 +1,86 @@
+#pragma once
+
+#include <limitless/core/sync.hpp>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+
+namespace Limitless {
+    class Buffer;
+    class AbstractMesh;
+
+    /**
+     * Vertex written by skinning compute shader in std430 layout
+     */
+    struct SkinnedVertex {
+        glm::vec4 position;
+        glm::vec4 normal;
+        glm::vec4 tangent;
+    };
+
+    /**
+     * Output of compute skinning for meshes of single SkeletalInstance
+     *
+     * vertices are skinned once per frame and consumed by every pass that draws instance;
+     * optional CPU copy is read back when GPU is done with it, so it lags at least one frame behind
+     */
+    class SkinnedVertices final {
+    private:
+        class Output {
+        public:
+            std::shared_ptr<Buffer> buffer;
+            std::vector<SkinnedVertex> cpu_copy;
+            std::unique_ptr<Sync> sync;
+        };
+
+        std::unordered_map<const AbstractMesh*, Output> outputs;
+
+        /**
+         * Whether CPU copy is maintained
+         */
+        bool readback {};
+
+        /**
+         * Whether outputs were skinned for current frame
+         */
+        bool current {};
+    public:
+        /**
+         * Returns output buffer for mesh, creates it on first use
+         */
+        const std::shared_ptr<Buffer>& getOutput(const AbstractMesh& mesh, size_t vertex_count);
+
+        /**
+         * Returns output buffer for mesh or nullptr if mesh has not been skinned yet
+         */
+        [[nodiscard]] std::shared_ptr<Buffer> findOutput(const AbstractMesh& mesh) const noexcept;
+
+        /**
+         * Copies finished outputs to CPU, does not wait for GPU
+         */
+        void fetch();
+
+        /**
+         * Places fences after skinning dispatch for outputs that should be read back
+         */
+        void fence();
+
+        /**
+         * Marks outputs as up to date or stale for current frame
+         *
+         * stale outputs are not read by vertex shaders, they skin vertices themselves
+         */
+        void setCurrent(bool value) noexcept { current = value; }
+        [[nodiscard]] auto isCurrent() const noexcept { return current; }
+
+        void enableReadback() noexcept { readback = true; }
+        void disableReadback() noexcept;
+        [[nodiscard]] auto isReadbackEnabled() const noexcept { return readback; }
+
+        /**
+         * Returns last read back vertex or nullptr if there is no CPU copy yet
+         */
+        [[nodiscard]] const SkinnedVertex* findVertex(const AbstractMesh& mesh, size_t vertex_index) const noexcept;
+    };
+}
@@ -25,6 +25,22 @@ namespace Limitless {
         float far_distance {};
         float fov {};
         float ratio {};
+
+        /**
+         * Texel-snapped bounding sphere of frustum in light view space
+         */
+        glm::vec3 center {};
+        float radius {};
+
+        /**
+         * State of static casters layer
+         *
+         * static layer is valid while light direction is the same and cascade center stays in margin
+         */
+        glm::mat4 static_crop {1.0f};
+        glm::vec3 static_center {};
+        float static_radius {};
+        bool static_valid {};
     };
 
     class CascadeShadows final {
@@ -36,20 +52,40 @@ namespace Limitless {
 
         std::unique_ptr<Framebuffer> framebuffer;
 
+        /**
+         * Static casters cache
+         *
+         * contains only static instances, copied to framebuffer each frame before dynamic casters are drawn
+         */
+        std::unique_ptr<Framebuffer> static_framebuffer;
+        bool static_cache;
+        float static_cache_margin;
+        glm::vec3 static_light_direction {0.0f};
+
         std::vector<ShadowFrustum> frustums;
         std::vector<float> far_bounds {};
         std::shared_ptr<Buffer> light_buffer;
         std::vector<glm::mat4> light_space;
 
+        std::unique_ptr<Framebuffer> makeDepthFramebuffer() const;
         void initBuffers();
         void updateFrustums(Context& ctx, const Camera& camera);
         void updateLightMatrices(const Light& light);
+        bool isStaticLayerValid(const ShadowFrustum& frustum, const Light& light) const noexcept;
+        void updateStaticLayers(Scene& scene, Context& ctx, const Assets& assets, const Light& light);
     public:
         explicit CascadeShadows(const RendererSettings& settings);
         ~CascadeShadows();
 
         void update(const RendererSettings& settings);
 
+        /**
+         * Forces static casters to be redrawn in next frame
+         *
+         * should be called when static instances are added, removed or moved
+         */
+        void invalidateStaticCache() noexcept;
+
         void draw(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera);
 
         void setUniform(ShaderProgram& sh) const;
@@ -29,6 +29,16 @@ namespace Limitless {
         bool removed;
         bool hidden;
 
+        /**
+         * Whether Point or Spot light casts shadow
+         */
+        bool shadow_cast {};
+
+        /**
+         * Slot in local shadows buffer assigned by renderer, -1 if none
+         */
+        int32_t shadow_index {-1};
+
         Light(const glm::vec4& color, const glm::vec3& position, float radius) noexcept;
         Light(const glm::vec4& color, const glm::vec3& position, const glm::vec3& direction, const glm::vec2& inner_outer_angles, float radius) noexcept;
         Light(const glm::vec4& color, const glm::vec3& direction) noexcept;
@@ -73,6 +83,13 @@ namespace Limitless {
         void hide() noexcept;
         void reveal() noexcept;
 
+        [[nodiscard]] bool doesCastShadow() const noexcept;
+        void castShadow() noexcept;
+        void removeShadow() noexcept;
+
+        [[nodiscard]] int32_t getShadowIndex() const noexcept;
+        void setShadowIndex(int32_t index) noexcept;
+
         class Builder {
         private:
             glm::vec4 color_ {0.0f};
@@ -81,6 +98,7 @@ namespace Limitless {
             float inner_angle_ {0.0f};
             glm::vec3 direction_ {0.0f};
             float radius_ {0.0f};
+            bool cast_shadow_ {false};
 
             bool isSpot();
             bool isPoint();
@@ -91,6 +109,7 @@ namespace Limitless {
             Builder& direction(const glm::vec3& direction) noexcept;
             Builder& cone(float outer_angle, float inner_angle) noexcept;
             Builder& radius(float radius) noexcept;
+            Builder& cast_shadow(bool cast_shadow) noexcept;
 
             Light build();
             Light buildDefaultDirectional();
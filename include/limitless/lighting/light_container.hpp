@@ -17,7 +17,7 @@ namespace Limitless {
         class InternalLight {
         private:
             glm::vec4 color;
-            glm::vec4 position;
+            glm::vec4 position; // w - local shadow index, negative if none
             glm::vec4 direction;
             glm::vec2 scale_offset;
             float falloff;
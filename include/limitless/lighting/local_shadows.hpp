@@ -0,0 +1,167 @@
+#pragma once
+
+#include <limitless/core/framebuffer.hpp>
+#include <limitless/lighting/shadow_atlas.hpp>
+#include <limitless/renderer/renderer_settings.hpp>
+
+#include <unordered_map>
+#include <array>
+
+namespace Limitless {
+    class Light;
+    class Lighting;
+    class ShaderProgram;
+    class Camera;
+    class Assets;
+    class Scene;
+    class InstanceRenderer;
+    class Buffer;
+
+    /**
+     * LocalShadows implements shadow maps for Point and Spot lights
+     *
+     * every shadow view (one for Spot, six cube faces for Point) occupies a region of single depth atlas
+     * resolution of the view is chosen by light screen-space size, update period by distance to camera
+     *
+     * total atlas area never exceeds texel budget and no more than update budget views are rendered per frame
+     */
+    class LocalShadows final {
+    public:
+        /**
+         * Last frame statistics
+         */
+        class Stats {
+        public:
+            uint32_t shadowed_lights {};
+            uint32_t rendered_views {};
+            uint64_t used_texels {};
+
+            /**
+             * Views that got new atlas regions, these have to be rendered again
+             */
+            uint32_t allocated_views {};
+        };
+    private:
+        static constexpr uint32_t MAX_VIEWS {6};
+        static constexpr uint32_t MAX_SHADOWED_LIGHTS {256};
+
+        class ShadowView {
+        public:
+            glm::mat4 light_space {1.0f};
+            std::optional<ShadowAtlas::Region> region;
+            uint64_t last_update {};
+            bool valid {};
+            bool dirty {};
+        };
+
+        class ShadowState {
+        public:
+            std::array<ShadowView, MAX_VIEWS> views;
+
+            /**
+             * Light parameters at the moment of last update
+             */
+            glm::vec3 position {};
+            glm::vec3 direction {};
+            glm::vec2 cone {};
+            float radius {};
+
+            float importance {};
+
+            /**
+             * Resolution assigned within texel budget and resolution of allocated regions,
+             * the latter is smaller when atlas has no room for requested one
+             */
+            uint32_t requested_resolution {};
+            uint32_t resolution {};
+            uint32_t period {1};
+            uint32_t view_count {};
+            int32_t slot {-1};
+            bool seen {};
+        };
+
+        /**
+         * Shadow data mapped to GPU for each slot
+         *
+         * regions: xy - uv offset, zw - uv size, zero size means view is not rendered yet
+         */
+        class ShadowData {
+        public:
+            glm::mat4 light_space[MAX_VIEWS];
+            glm::vec4 regions[MAX_VIEWS];
+        };
+
+        class Candidate {
+        public:
+            Light* light;
+            ShadowState* state;
+            float pixels;
+            float distance;
+            uint32_t resolution;
+        };
+
+        class ViewRequest {
+        public:
+            Light* light;
+            ShadowState* state;
+            uint32_t view;
+            float priority;
+        };
+
+        ShadowAtlas atlas;
+        std::unique_ptr<Framebuffer> framebuffer;
+        std::shared_ptr<Buffer> buffer;
+
+        std::unordered_map<uint64_t, ShadowState> states;
+        std::vector<ShadowData> data;
+        std::vector<int32_t> free_slots;
+
+        /**
+         * Per-frame scratch storage, kept to avoid reallocations
+         */
+        std::vector<Candidate> candidates;
+        std::vector<ViewRequest> requests;
+
+        uint64_t texel_budget;
+        uint32_t update_budget;
+        uint32_t min_resolution;
+        uint32_t max_resolution;
+
+        uint64_t frame {};
+        Stats stats {};
+
+        void initBuffers(uint32_t atlas_resolution);
+
+        void releaseRegions(ShadowState& state);
+        bool allocateRegions(ShadowState& state, uint32_t resolution);
+        int32_t acquireSlot();
+        void releaseSlot(ShadowState& state);
+
+        void updateStates(Lighting& lighting, const Camera& camera, glm::uvec2 screen);
+        void scheduleUpdates();
+        void renderView(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Light& light, ShadowState& state, uint32_t view);
+
+        static uint32_t getUpdatePeriod(float distance, float radius) noexcept;
+        static glm::mat4 getLightSpace(const Light& light, uint32_t view) noexcept;
+    public:
+        explicit LocalShadows(const RendererSettings& settings);
+        ~LocalShadows();
+
+        void update(const RendererSettings& settings);
+
+        /**
+         * Assigns atlas regions to shadow casting lights and schedules views to render this frame
+         *
+         * called by draw
+         */
+        void prepare(Lighting& lighting, const Camera& camera, glm::uvec2 screen);
+
+        void draw(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera);
+
+        void setUniform(ShaderProgram& shader) const;
+        void mapData() const;
+
+        [[nodiscard]] const auto& getStats() const noexcept { return stats; }
+        [[nodiscard]] const auto& getAtlas() const noexcept { return atlas; }
+    };
+}
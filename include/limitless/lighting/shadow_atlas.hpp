@@ -0,0 +1,88 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <optional>
+#include <vector>
+#include <cstdint>
+
+namespace Limitless {
+    /**
+     * ShadowAtlas is a quadtree allocator of square power-of-two regions in single shadow map texture
+     *
+     * each node is either free, split into four children or occupied by allocated region
+     * freed regions are merged back with their siblings
+     */
+    class ShadowAtlas final {
+    public:
+        class Region {
+        public:
+            glm::uvec2 origin;
+            uint32_t size;
+            uint32_t level;
+
+            bool operator==(const Region& rhs) const noexcept {
+                return origin == rhs.origin && size == rhs.size && level == rhs.level;
+            }
+
+            bool operator!=(const Region& rhs) const noexcept {
+                return !(*this == rhs);
+            }
+        };
+    private:
+        enum class NodeState : uint8_t {
+            Free,
+            Split,
+            Occupied
+        };
+
+        /**
+         * Node states by levels
+         *
+         * level L contains 4^L nodes laid out in row-major order
+         */
+        std::vector<std::vector<NodeState>> levels;
+
+        uint32_t size;
+        uint32_t min_size;
+        uint64_t allocated_texels {};
+
+        [[nodiscard]] uint32_t getNodeSize(uint32_t level) const noexcept;
+        [[nodiscard]] static uint32_t getNodeIndex(uint32_t level, uint32_t x, uint32_t y) noexcept;
+
+        std::optional<Region> allocate(uint32_t level, uint32_t x, uint32_t y, uint32_t target);
+    public:
+        /**
+         * Creates atlas of [size x size] texels with smallest region of [min_size x min_size]
+         *
+         * both sizes should be power of two
+         */
+        ShadowAtlas(uint32_t size, uint32_t min_size);
+
+        /**
+         * Allocates square region
+         *
+         * size is rounded up to power of two and clamped to [min_size; size]
+         * returns nothing if there is no free space
+         */
+        std::optional<Region> allocate(uint32_t size);
+
+        /**
+         * Frees previously allocated region
+         */
+        void free(const Region& region);
+
+        /**
+         * Frees all regions
+         */
+        void clear();
+
+        [[nodiscard]] auto getSize() const noexcept { return size; }
+        [[nodiscard]] auto getMinSize() const noexcept { return min_size; }
+        [[nodiscard]] auto getAllocatedTexels() const noexcept { return allocated_texels; }
+
+        /**
+         * Rounds size up to power of two
+         */
+        static uint32_t roundToPowerOfTwo(uint32_t size) noexcept;
+    };
+}
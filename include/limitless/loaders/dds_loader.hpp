@@ -13,7 +13,7 @@ namespace Limitless {
     class DDSLoader {
         static std::size_t getDXTByteCount(glm::uvec2 size, std::size_t block_size) noexcept;
 
-        static void loadLevel(std::shared_ptr<Texture>& texture, std::ifstream& fs, uint32_t level, int channels);
+        static void loadLevel(std::shared_ptr<Texture>& texture, ByteReader& reader, uint32_t level, int channels);
     public:
         static std::shared_ptr<Texture> load(Assets& assets, const fs::path& path, const TextureLoaderFlags& flags);
     };
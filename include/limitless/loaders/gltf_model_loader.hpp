@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <limitless/models/model.hpp>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 
@@ -28,6 +29,9 @@ namespace Limitless {
 		float scale_factor {1.0f};
 		InstanceTypes additional_instance_types;
 
+		// Directory of processed model cache, models are processed from source on every load if it is not set.
+		std::optional<fs::path> cache_directory;
+
 		auto isPresent(ModelLoaderOption option) const { return options.count(option) != 0; }
 
 		ModelLoaderFlags& additionalInstanceTypes(InstanceTypes _additional_instance_types) {
@@ -39,12 +43,19 @@ namespace Limitless {
 			additional_instance_types.emplace(InstanceType::Instanced);
 			return *this;
 		}
+
+		ModelLoaderFlags& cache(fs::path directory) {
+			cache_directory = std::move(directory);
+			return *this;
+		}
 	};
 
 	class GltfModelLoader {
 	public:
 		// Load a 3D model from given file.
 		// Will also attempt to load materials referenced in model definition.
+		// Processed model is stored to cache directory of flags and
+		// is loaded from there while source files and flags stay the same.
 		// Returns a shared pointer to resulting model on success.
 		// Provided assets are modified.
 		// On failure, a ModelLoadError exception is thrown.
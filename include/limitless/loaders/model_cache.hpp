@@ -0,0 +1,148 @@
+#pragma once
+
+#include <limitless/core/vertex.hpp>
+#include <limitless/loaders/texture_loader.hpp>
+#include <limitless/ms/blending.hpp>
+#include <limitless/models/bones.hpp>
+#include <limitless/models/skeletal_model.hpp>
+#include <limitless/util/filesystem.hpp>
+#include <limitless/util/tree.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Limitless {
+    /**
+     * Model as it is produced by model loader before any GPU object is created
+     *
+     * vertex and index arrays are final, so they go to vertex streams as they are;
+     * materials are described by everything they are built from, so model is created without source file
+     */
+    struct ModelData {
+        static constexpr uint32_t NO_MATERIAL = UINT32_MAX;
+
+        struct Texture {
+            // path relative to model directory; empty for image embedded in model
+            std::string path;
+
+            // asset name and contents of embedded image
+            std::string name;
+            std::vector<uint8_t> bytes;
+
+            TextureLoaderFlags flags;
+        };
+
+        struct Material {
+            std::string name;
+            ms::Blending blending {ms::Blending::Opaque};
+            std::optional<float> alpha_cutoff;
+            bool unlit {};
+            bool two_sided {};
+
+            glm::vec4 color {1.0f};
+            glm::vec3 emissive_color {0.0f};
+            std::optional<float> ior;
+
+            std::optional<Texture> diffuse;
+            std::optional<Texture> normal;
+            std::optional<Texture> emissive_mask;
+        };
+
+        struct Mesh {
+            std::string name;
+            std::vector<VertexNormalTangent> vertices;
+            std::vector<uint32_t> indices;
+
+            // empty for meshes that are not skinned
+            std::vector<VertexBoneWeight> bone_weights;
+            bool skinned {};
+
+            // index of material in source file or NO_MATERIAL
+            uint32_t material {NO_MATERIAL};
+        };
+
+        struct AnimationNode {
+            uint32_t bone {};
+            std::vector<KeyFrame<glm::vec3>> positions;
+            std::vector<KeyFrame<glm::fquat>> rotations;
+            std::vector<KeyFrame<glm::vec3>> scales;
+        };
+
+        struct Animation {
+            std::string name;
+            double duration {};
+            double tps {};
+            std::vector<AnimationNode> nodes;
+        };
+
+        std::vector<Mesh> meshes;
+        std::vector<Material> materials;
+
+        // skeletal models only
+        std::vector<Bone> bones;
+        std::vector<Tree<uint32_t>> skeletons;
+        std::vector<Animation> animations;
+        bool skeletal {};
+    };
+
+    /**
+     * Binary cache of processed models
+     *
+     * cache file is keyed by model path, loader flags and version of cache format; it records stamps of source files
+     * and hash of their contents: while stamps are the same, cached model is used without reading sources at all,
+     * changed stamps fall back to comparing contents hash, so touched but unchanged sources still hit the cache
+     *
+     * arrays of vertices, indices, bone weights and keyframes are stored as blocks of bytes, loading maps the file
+     * and copies every block at once without parsing of source format
+     */
+    class ModelCache final {
+    public:
+        static constexpr uint32_t MAGIC = 0x444D4C4C; // "LLMD"
+        static constexpr uint32_t VERSION = 2;
+
+        /**
+         * Cheap stamp of source file
+         */
+        struct Source {
+            std::string path;
+            uint64_t size {};
+
+            // modification time of file on disk; content hash of file in mounted archive, which has no time
+            int64_t stamp {};
+
+            bool operator==(const Source& rhs) const noexcept {
+                return path == rhs.path && size == rhs.size && stamp == rhs.stamp;
+            }
+        };
+
+        struct Entry {
+            // hash of source contents model is processed from
+            uint64_t content_key {};
+            std::vector<Source> sources;
+            ModelData model;
+        };
+
+        /**
+         * Fast 64-bit hash of source bytes, chained through seed
+         */
+        static uint64_t hash(std::string_view bytes, uint64_t seed = 0) noexcept;
+
+        /**
+         * Gets path of cache file for key in cache directory
+         */
+        static fs::path getPath(const fs::path& directory, uint64_t key);
+
+        /**
+         * Loads cache entry; returns nullopt if file is missing, written for another key or damaged
+         */
+        static std::optional<Entry> load(const fs::path& path, uint64_t key);
+
+        /**
+         * Saves entry to cache file; file appears at once when it is complete, so concurrent loads never see it partially written
+         */
+        static void save(const fs::path& path, uint64_t key, const Entry& entry);
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <limitless/util/filesystem.hpp>
+#include <limitless/util/mapped_file.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Limitless {
+    class pack_archive_exception : public std::runtime_error {
+    public:
+        explicit pack_archive_exception(const std::string& msg) : std::runtime_error(msg) {}
+    };
+
+    /**
+     * Single file that holds many asset files
+     *
+     * layout of archive, numbers are in byte order of machine that wrote it as in ByteBuffer:
+     *      Header
+     *      Entry[entry_count] sorted by hash of name
+     *      names of entries
+     *      blobs of entries, each one starts at BLOB_ALIGNMENT
+     *
+     * archive is mapped to memory, so lookup is binary search over table of contents
+     * and found file is view into mapped memory
+     */
+    class PackArchive final {
+    public:
+        static constexpr uint32_t MAGIC = 0x4B41504C; // "LPAK"
+        static constexpr uint32_t VERSION = 1;
+        static constexpr uint64_t BLOB_ALIGNMENT = 64;
+
+        // no codec is shipped with engine yet, field keeps format open for it
+        enum class Compression : uint32_t { None };
+
+        struct Header {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t entry_count;
+        };
+
+        struct Entry {
+            uint64_t hash;
+            uint64_t name_offset;
+            uint64_t name_size;
+            uint64_t offset;
+            uint64_t size;
+            Compression compression;
+            uint32_t reserved;
+        };
+
+        /**
+         * FNV-1a hash of entry name
+         */
+        static uint64_t hash(std::string_view name) noexcept;
+
+        /**
+         * Gets name that path is stored with, i.e. normal path with '/' separators
+         */
+        static std::string getName(const fs::path& path);
+    private:
+        MappedFile file;
+
+        const Entry* entries {};
+        uint64_t entry_count {};
+
+        [[nodiscard]] std::string_view view(uint64_t offset, uint64_t size) const noexcept;
+    public:
+        /**
+         * Opens archive; throws pack_archive_exception if file is not valid archive
+         */
+        explicit PackArchive(const fs::path& path);
+
+        /**
+         * Finds contents of file stored with name
+         */
+        [[nodiscard]] std::optional<std::string_view> find(std::string_view name) const;
+
+        /**
+         * Whether memory belongs to archive
+         */
+        [[nodiscard]] bool contains(const void* data) const noexcept;
+
+        [[nodiscard]] auto size() const noexcept { return entry_count; }
+    };
+
+    /**
+     * Writes files to pack archive
+     *
+     * files are only listed until archive is written, so writer does not hold their contents
+     */
+    class PackWriter final {
+    private:
+        struct Source {
+            std::string name;
+            fs::path path;
+            uint64_t size;
+            uint64_t hash;
+        };
+
+        std::vector<Source> sources;
+    public:
+        /**
+         * Adds file that is stored with name of path
+         */
+        void add(const fs::path& name, const fs::path& path);
+
+        /**
+         * Adds all regular files of directory recursively, names are relative to directory
+         */
+        void addDirectory(const fs::path& directory);
+
+        /**
+         * Writes archive; throws pack_archive_exception if two files have the same name
+         */
+        void write(const fs::path& path);
+    };
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <limitless/loaders/pack_archive.hpp>
+
+#include <memory>
+#include <shared_mutex>
+
+namespace Limitless {
+    /**
+     * Contents of asset file that is either stored in mounted archive or mapped from disk
+     */
+    class AssetFile final {
+    private:
+        std::unique_ptr<MappedFile> file;
+        std::string_view bytes;
+    public:
+        explicit AssetFile(std::string_view archived) noexcept
+            : bytes {archived} {
+        }
+
+        explicit AssetFile(const fs::path& path)
+            : file {std::make_unique<MappedFile>(path)}
+            , bytes {reinterpret_cast<const char*>(file->data()), file->size()} {
+        }
+
+        [[nodiscard]] auto data() const noexcept { return reinterpret_cast<const std::byte*>(bytes.data()); }
+        [[nodiscard]] auto size() const noexcept { return bytes.size(); }
+        [[nodiscard]] bool isArchived() const noexcept { return !file; }
+
+        [[nodiscard]] ByteReader reader() const noexcept {
+            return {data(), size()};
+        }
+    };
+
+    /**
+     * Pack archives mounted to asset directories
+     *
+     * loaders resolve paths through mounted archives first and fall back to files on disk; path belongs to archive
+     * if it starts with its mount point and the rest of it is name of entry, mount points are compared to paths
+     * as they are passed to loaders; archive mounted later shadows entries of earlier ones
+     *
+     * archives stay mounted for the lifetime of Assets, so found contents are never invalidated
+     */
+    class PackArchives final {
+    private:
+        struct Mount {
+            std::string point;
+            std::unique_ptr<PackArchive> archive;
+        };
+
+        std::vector<Mount> mounts;
+        mutable std::shared_mutex mutex;
+    public:
+        /**
+         * Mounts archive to directory; throws pack_archive_exception if archive cannot be opened
+         */
+        void mount(const fs::path& archive, const fs::path& point = {});
+
+        /**
+         * Finds contents of file in mounted archives
+         */
+        [[nodiscard]] std::optional<std::string_view> find(const fs::path& path) const;
+
+        /**
+         * Gets contents of file from mounted archives or from disk
+         */
+        [[nodiscard]] AssetFile open(const fs::path& path) const;
+
+        /**
+         * Whether memory belongs to one of mounted archives
+         */
+        [[nodiscard]] bool contains(const void* data) const;
+
+        [[nodiscard]] bool empty() const;
+    };
+}
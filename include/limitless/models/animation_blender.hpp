@@ -0,0 +1,146 @@
+#pragma once
+
+#include <limitless/models/skeletal_model.hpp>
+#include <memory>
+
+namespace Limitless {
+    /**
+     * Local transformations of skeleton nodes in structure-of-arrays layout
+     *
+     * indexed by flattened skeleton node
+     */
+    class LocalPose {
+    public:
+        std::vector<glm::vec3> translations;
+        std::vector<glm::fquat> rotations;
+        std::vector<glm::vec3> scales;
+
+        void resize(size_t count);
+        [[nodiscard]] auto size() const noexcept { return translations.size(); }
+    };
+
+    /**
+     * Per-node weights limiting layer influence to part of skeleton
+     */
+    class BoneMask final {
+    private:
+        std::vector<float> weights;
+    public:
+        BoneMask() = default;
+        explicit BoneMask(size_t count, float weight = 0.0f);
+
+        /**
+         * Creates mask covering bone with its whole subtree
+         *
+         * throws bone_not_found if there is no bone with such name
+         */
+        static BoneMask subtree(const SkeletalModel& model, const std::string& bone, float weight = 1.0f);
+
+        BoneMask& set(size_t node, float weight);
+
+        [[nodiscard]] float operator[](size_t node) const noexcept { return node < weights.size() ? weights[node] : 0.0f; }
+        [[nodiscard]] auto size() const noexcept { return weights.size(); }
+    };
+
+    class bone_not_found : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Single weighted clip of blend
+     */
+    class AnimationLayer {
+    public:
+        const Animation* animation {};
+        std::vector<AnimationNode::Cursor> cursors;
+        std::shared_ptr<const BoneMask> mask;
+
+        /**
+         * Layer playback time in seconds
+         */
+        double time {};
+        float speed {1.0f};
+
+        float weight {1.0f};
+        float target_weight {1.0f};
+
+        /**
+         * Weight change per second towards target weight
+         */
+        float fade_rate {};
+
+        /**
+         * Additive layers apply difference between clip and bind pose on top of blended result
+         */
+        bool additive {};
+    };
+
+    /**
+     * AnimationBlender evaluates N weighted animation layers into bone transformations
+     *
+     * override layers are accumulated by weight, remaining weight up to one goes to bind pose,
+     * then additive layers are applied; rotations are blended with normalized lerp
+     *
+     * scratch poses are sized once by initialize, evaluation does not allocate
+     */
+    class AnimationBlender final {
+    private:
+        std::vector<AnimationLayer> layers;
+
+        LocalPose bind_pose;
+        LocalPose pose;
+        std::vector<float> weight_sum;
+
+        /**
+         * Whether node is driven by any layer, otherwise node transform of bone is used as is
+         */
+        std::vector<uint8_t> animated;
+
+        void accumulate(const SkeletalModel& model, AnimationLayer& layer);
+        void normalize();
+        void applyAdditive(const SkeletalModel& model, AnimationLayer& layer);
+        void compose(const SkeletalModel& model, std::vector<glm::mat4>& global_transform, std::vector<glm::mat4>& bone_transform) const;
+    public:
+        /**
+         * Sizes scratch poses and computes bind pose for model
+         */
+        void initialize(const SkeletalModel& model);
+
+        /**
+         * Adds layer and returns its index
+         */
+        size_t add(const Animation& animation, float weight = 1.0f, std::shared_ptr<const BoneMask> mask = {}, bool additive = false);
+        void remove(size_t index);
+        void clear() noexcept;
+
+        /**
+         * Changes layer weight to target during duration in seconds
+         */
+        void fade(size_t index, float target, double duration);
+
+        /**
+         * Fades in new layer while fading out all other override layers
+         */
+        size_t crossfade(const Animation& animation, double duration);
+
+        /**
+         * Advances layer times and weights, removes faded out layers
+         */
+        void advance(double delta);
+
+        /**
+         * Writes blended global transformations of flattened skeleton and bone palette
+         */
+        void evaluate(const SkeletalModel& model, std::vector<glm::mat4>& global_transform, std::vector<glm::mat4>& bone_transform);
+
+        /**
+         * Whether blend consists of single full-weight layer that could be played without blending
+         */
+        [[nodiscard]] bool isSingleClip() const noexcept;
+
+        [[nodiscard]] bool empty() const noexcept { return layers.empty(); }
+        [[nodiscard]] const auto& getLayers() const noexcept { return layers; }
+        [[nodiscard]] auto& getLayers() noexcept { return layers; }
+    };
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace Limitless {
+    class SkeletalModel;
+    class Buffer;
+    class Context;
+
+    /**
+     * BakedAnimations contains bone palettes of all SkeletalModel animations sampled at fixed rate
+     *
+     * palettes of all frames are stored sequentially in single storage buffer,
+     * so instances only supply (animation, time) and vertex shader fetches and blends two nearest frames
+     */
+    class BakedAnimations final {
+    public:
+        /**
+         * Baked clip description, mirrors BakedClip in shader
+         */
+        class Clip {
+        public:
+            uint32_t first_frame;
+            uint32_t frame_count;
+            uint32_t joint_count;
+            float frame_rate;
+        };
+
+        static constexpr double DEFAULT_SAMPLE_RATE {30.0};
+    private:
+        std::vector<glm::mat4> palettes;
+        std::vector<Clip> clips;
+
+        /**
+         * Clip durations in seconds
+         */
+        std::vector<double> durations;
+        std::vector<std::string> names;
+
+        std::shared_ptr<Buffer> palette_buffer;
+        std::shared_ptr<Buffer> clip_buffer;
+
+        uint32_t joint_count {};
+        double sample_rate;
+
+        void bake(const SkeletalModel& model);
+    public:
+        /**
+         * Samples every animation of model at sample rate frames per second
+         */
+        explicit BakedAnimations(const SkeletalModel& model, double sample_rate = DEFAULT_SAMPLE_RATE);
+
+        /**
+         * Uploads baked palettes to GPU, requires current context
+         */
+        void initializeBuffers();
+
+        /**
+         * Binds palette and clip buffers to their binding points
+         */
+        void bind(Context& ctx) const;
+
+        /**
+         * Returns animation index by name
+         *
+         * throws no_such_animation if not found
+         */
+        [[nodiscard]] uint32_t getAnimationIndex(const std::string& name) const;
+
+        /**
+         * Returns animation duration in seconds
+         */
+        [[nodiscard]] double getDuration(uint32_t animation) const { return durations.at(animation); }
+
+        [[nodiscard]] bool isUploaded() const noexcept { return palette_buffer != nullptr; }
+        [[nodiscard]] const auto& getPalettes() const noexcept { return palettes; }
+        [[nodiscard]] const auto& getClips() const noexcept { return clips; }
+        [[nodiscard]] auto getJointCount() const noexcept { return joint_count; }
+        [[nodiscard]] auto getSampleRate() const noexcept { return sample_rate; }
+    };
+}
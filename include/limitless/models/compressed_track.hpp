@@ -0,0 +1,90 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <optional>
+#include <vector>
+#include <array>
+#include <cstdint>
+
+namespace Limitless {
+    template <typename T>
+    struct KeyFrame;
+
+    /**
+     * Maximum allowed sampling error of compressed tracks
+     */
+    class CompressionSettings {
+    public:
+        /**
+         * Translation error in model units
+         */
+        float position_error {0.0005f};
+
+        /**
+         * Rotation error in radians
+         */
+        float rotation_error {0.0005f};
+
+        float scale_error {0.0005f};
+    };
+
+    /**
+     * Unit quaternion packed into 48 bits using smallest-three encoding
+     *
+     * 2 bits store index of the largest component, three other components are 15 bits each,
+     * largest one is restored from unit length
+     */
+    class QuantizedQuat {
+    public:
+        std::array<uint16_t, 3> data;
+
+        static QuantizedQuat encode(const glm::fquat& q) noexcept;
+        [[nodiscard]] glm::fquat decode() const noexcept;
+    };
+
+    /**
+     * Uniformly sampled track with float time
+     *
+     * sample rate is chosen per track as the lowest one that keeps error within threshold,
+     * constant tracks are stored as single sample
+     *
+     * compress returns nullopt when no sample rate keeps error within threshold
+     */
+    class CompressedVec3Track {
+    private:
+        /**
+         * Components quantized to 16 bits inside track bounds
+         */
+        std::vector<std::array<uint16_t, 3>> samples;
+        glm::vec3 min {0.0f};
+        glm::vec3 extent {0.0f};
+        float start {};
+        float inv_step {};
+
+        [[nodiscard]] glm::vec3 decode(size_t index) const noexcept;
+    public:
+        static std::optional<CompressedVec3Track> compress(const std::vector<KeyFrame<glm::vec3>>& keys, float error);
+
+        [[nodiscard]] glm::vec3 sample(double time) const noexcept;
+
+        [[nodiscard]] bool empty() const noexcept { return samples.empty(); }
+        [[nodiscard]] auto getSampleCount() const noexcept { return samples.size(); }
+        [[nodiscard]] size_t getMemoryUsage() const noexcept;
+    };
+
+    class CompressedQuatTrack {
+    private:
+        std::vector<QuantizedQuat> samples;
+        float start {};
+        float inv_step {};
+    public:
+        static std::optional<CompressedQuatTrack> compress(const std::vector<KeyFrame<glm::fquat>>& keys, float error);
+
+        [[nodiscard]] glm::fquat sample(double time) const noexcept;
+
+        [[nodiscard]] bool empty() const noexcept { return samples.empty(); }
+        [[nodiscard]] auto getSampleCount() const noexcept { return samples.size(); }
+        [[nodiscard]] size_t getMemoryUsage() const noexcept;
+    };
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace Limitless {
+    struct Animation;
+    class Buffer;
+
+    /**
+     * PoseCache shares evaluated bone palettes between instances of the same SkeletalModel
+     *
+     * animation time is quantized to sample rate, instances sampling the same (animation, frame) key
+     * reuse single bone palette and its GPU buffer instead of evaluating hierarchy and uploading their own
+     *
+     * cache keeps weak references, pose lives while at least one instance uses it;
+     * released poses are kept with their buffers and handed out again by acquire, so misses do not create GPU objects
+     */
+    class PoseCache final {
+    public:
+        /**
+         * Evaluated pose of animation frame
+         */
+        class Pose {
+        public:
+            std::vector<glm::mat4> bone_transform;
+            std::shared_ptr<Buffer> buffer;
+        };
+
+        class Stats {
+        public:
+            uint64_t hits {};
+            uint64_t misses {};
+
+            // poses created because no released one was available
+            uint64_t allocations {};
+        };
+
+        static constexpr double DEFAULT_SAMPLE_RATE {30.0};
+    private:
+        class Key {
+        public:
+            const Animation* animation;
+            uint64_t frame;
+
+            bool operator==(const Key& rhs) const noexcept {
+                return animation == rhs.animation && frame == rhs.frame;
+            }
+        };
+
+        class KeyHash {
+        public:
+            size_t operator()(const Key& key) const noexcept {
+                const auto h = std::hash<const Animation*>{}(key.animation);
+                return h ^ (std::hash<uint64_t>{}(key.frame) + 0x9e3779b9 + (h << 6) + (h >> 2));
+            }
+        };
+
+        std::unordered_map<Key, std::weak_ptr<Pose>, KeyHash> poses;
+
+        /**
+         * Poses that are not used by any instance, shared with deleters of acquired poses
+         */
+        std::shared_ptr<std::vector<std::unique_ptr<Pose>>> released;
+
+        /**
+         * Frames per second of animation time
+         */
+        double sample_rate;
+
+        Stats stats {};
+
+        /**
+         * Removes expired entries once map doubles since last cleanup
+         */
+        size_t cleanup_threshold {64};
+        void removeExpired();
+    public:
+        explicit PoseCache(double sample_rate = DEFAULT_SAMPLE_RATE) noexcept;
+
+        /**
+         * Returns quantized frame for animation time in ticks
+         */
+        [[nodiscard]] uint64_t getFrame(const Animation& animation, double time) const noexcept;
+
+        /**
+         * Returns animation time in ticks of quantized frame
+         */
+        [[nodiscard]] double getFrameTime(const Animation& animation, uint64_t frame) const noexcept;
+
+        /**
+         * Returns cached pose or nullptr, counts hit or miss
+         */
+        std::shared_ptr<Pose> find(const Animation& animation, uint64_t frame);
+
+        /**
+         * Returns released pose to be filled, it keeps previous contents and buffer; new pose if there is none
+         */
+        std::shared_ptr<Pose> acquire();
+
+        /**
+         * Stores evaluated pose for key
+         */
+        void insert(const Animation& animation, uint64_t frame, const std::shared_ptr<Pose>& pose);
+
+        void setSampleRate(double rate) noexcept;
+        [[nodiscard]] auto getSampleRate() const noexcept { return sample_rate; }
+
+        void clear() noexcept;
+        void resetStats() noexcept { stats = {}; }
+
+        [[nodiscard]] const auto& getStats() const noexcept { return stats; }
+
+        /**
+         * Number of entries including expired ones
+         */
+        [[nodiscard]] auto size() const noexcept { return poses.size(); }
+
+        /**
+         * Number of released poses ready for reuse
+         */
+        [[nodiscard]] auto getReleasedCount() const noexcept { return released->size(); }
+    };
+}
@@ -3,6 +3,8 @@
 #include <limitless/models/model.hpp>
 #include <limitless/util/tree.hpp>
 #include <limitless/models/bones.hpp>
+#include <limitless/models/pose_cache.hpp>
+#include <limitless/models/compressed_track.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <unordered_map>
 #include <optional>
@@ -13,25 +15,71 @@ namespace Limitless {
         T data;
         double time;
 
+        KeyFrame() noexcept = default;
+
         KeyFrame(T data, double time) noexcept
             : data{std::move(data)}
             , time(time) {}
     };
 
     struct AnimationNode {
+        /**
+         * Playback position in keyframe tracks, owned by whoever samples the node
+         *
+         * while time moves forward the keyframe is the cached one or the next one,
+         * on seeks and loops it falls back to binary search
+         */
+        struct Cursor {
+            size_t position {};
+            size_t rotation {};
+            size_t scaling {};
+        };
+
         std::vector<KeyFrame<glm::fquat>> rotations;
         std::vector<KeyFrame<glm::vec3>> positions;
         std::vector<KeyFrame<glm::vec3>> scales;
         Bone &bone;
 
+        /**
+         * Compressed tracks replace keyframes after compress, lerp functions sample them directly
+         *
+         * tracks that cannot be compressed within error keep their keyframes;
+         * find*Keyframe functions throw std::logic_error for released keyframes of compressed nodes
+         */
+        CompressedQuatTrack compressed_rotations;
+        CompressedVec3Track compressed_positions;
+        CompressedVec3Track compressed_scales;
+        bool compressed {};
+
         AnimationNode(decltype(positions) positions, decltype(rotations) rotations, decltype(scales) scales, Bone &bone) noexcept;
 
         [[nodiscard]] size_t findPositionKeyframe(double anim_time) const;
         [[nodiscard]] size_t findRotationKeyframe(double anim_time) const;
         [[nodiscard]] size_t findScalingKeyframe(double anim_time) const;
+
+        /**
+         * Samples track at time; time outside of track gets its first or last value, whether node is compressed or not
+         */
         [[nodiscard]] std::optional<glm::vec3> positionLerp(double anim_time) const;
         [[nodiscard]] std::optional<glm::fquat> rotationLerp(double anim_time) const;
         [[nodiscard]] std::optional<glm::vec3> scalingLerp(double anim_time) const;
+
+        [[nodiscard]] size_t findPositionKeyframe(double anim_time, size_t& cursor) const;
+        [[nodiscard]] size_t findRotationKeyframe(double anim_time, size_t& cursor) const;
+        [[nodiscard]] size_t findScalingKeyframe(double anim_time, size_t& cursor) const;
+        [[nodiscard]] std::optional<glm::vec3> positionLerp(double anim_time, Cursor& cursor) const;
+        [[nodiscard]] std::optional<glm::fquat> rotationLerp(double anim_time, Cursor& cursor) const;
+        [[nodiscard]] std::optional<glm::vec3> scalingLerp(double anim_time, Cursor& cursor) const;
+
+        /**
+         * Replaces keyframes with compressed tracks and releases keyframe memory
+         */
+        void compress(const CompressionSettings& settings);
+
+        /**
+         * Returns memory used by keyframes or compressed tracks in bytes
+         */
+        [[nodiscard]] size_t getMemoryUsage() const noexcept;
     };
 
     struct Animation {
@@ -40,6 +88,16 @@ namespace Limitless {
         double duration;
         double tps;
 
+        /**
+         * Index of animation node for each bone of the model, -1 if bone is not animated
+         *
+         * filled by SkeletalModel
+         */
+        std::vector<int32_t> bone_channels;
+
+        void compress(const CompressionSettings& settings);
+        [[nodiscard]] size_t getMemoryUsage() const noexcept;
+
         Animation(std::string name, double duration, double tps, decltype(nodes) nodes) noexcept
             : nodes(std::move(nodes))
             , name(std::move(name))
@@ -48,12 +106,39 @@ namespace Limitless {
         }
     };
 
+    /**
+     * Skeleton bone in flattened hierarchy
+     *
+     * parent always precedes its children, -1 for roots
+     */
+    struct SkeletonNode {
+        uint32_t bone;
+        int32_t parent;
+
+        /**
+         * Node without children, its animation may be skipped on low animation LOD
+         */
+        bool leaf;
+    };
+
     class SkeletalModel : public Model {
     protected:
         std::unordered_map<std::string, uint32_t> bone_map;
         std::vector<Animation> animations;
         std::vector<Bone> bones;
         std::vector<Tree<uint32_t>> skeletons;
+
+        /**
+         * Skeleton trees flattened in depth-first order
+         */
+        std::vector<SkeletonNode> flat_skeleton;
+
+        /**
+         * Poses shared between instances of this model
+         */
+        PoseCache pose_cache;
+
+        void initializeSkeleton();
     public:
         SkeletalModel(
             decltype(meshes)&& meshes,
@@ -70,12 +155,39 @@ namespace Limitless {
         SkeletalModel(const SkeletalModel&) = delete;
         SkeletalModel& operator=(const SkeletalModel&) = delete;
 
+        /**
+         * Evaluates bone transformations of animation at specified time in ticks
+         *
+         * cursors should be sized to animation nodes, global_transform to flattened skeleton
+         *
+         * when skip_leaves is set leaf nodes keep their bind transform without sampling animation;
+         * returns count of sampled nodes
+         */
+        size_t evaluatePose(
+            const Animation& animation,
+            double time,
+            std::vector<AnimationNode::Cursor>& cursors,
+            std::vector<glm::mat4>& global_transform,
+            std::vector<glm::mat4>& bone_transform,
+            bool skip_leaves = false
+        ) const;
+
         [[nodiscard]] const auto& getAnimations() const noexcept { return animations; }
         [[nodiscard]] const auto& getSkeletonTrees() const noexcept { return skeletons; }
         [[nodiscard]] const auto& getBones() const noexcept { return bones; }
+        [[nodiscard]] const auto& getFlatSkeleton() const noexcept { return flat_skeleton; }
+        [[nodiscard]] const auto& getPoseCache() const noexcept { return pose_cache; }
 
         auto& getSkeletonTrees() noexcept { return skeletons; }
         auto& getAnimations() noexcept { return animations; }
+        auto& getPoseCache() noexcept { return pose_cache; }
+
+        /**
+         * Compresses keyframes of all animations
+         *
+         * should be done before instances start playing, sampling results change within error thresholds
+         */
+        void compressAnimations(const CompressionSettings& settings = {});
         auto& getBoneMap() noexcept { return bone_map; }
         const auto& getBoneMap() const noexcept { return bone_map; }
         auto& getBones() noexcept { return bones; }
@@ -3,14 +3,28 @@
 #include <limitless/renderer/shader_type.hpp>
 
 #include <limitless/instances/instanced_instance.hpp>
+#include <limitless/instances/skeletal_instanced_instance.hpp>
 #include <limitless/scene.hpp>
 #include <limitless/assets.hpp>
 #include <limitless/core/shader/shader_program.hpp>
 #include <limitless/instances/terrain_instance.hpp>
 #include <limitless/fx/effect_renderer.hpp>
 #include <limitless/util/frustum_culling.hpp>
+#include <limitless/util/frustum.hpp>
+#include <limitless/renderer/renderer_settings.hpp>
 
 namespace Limitless {
+    /**
+     * Selects which instances are rendered by their static/dynamic state
+     *
+     * used by cached shadow maps to draw static and dynamic casters separately
+     */
+    enum class GeometryFilter {
+        All,
+        Static,
+        Dynamic
+    };
+
     class DrawParameters {
     public:
         Context& ctx;
@@ -19,6 +33,7 @@ namespace Limitless {
         ms::Blending blending;
         UniformSetter setter {};
         UniformInstanceSetter isetter {};
+        GeometryFilter filter {GeometryFilter::All};
     };
 
     class InstanceRenderer {
@@ -46,8 +61,13 @@ namespace Limitless {
         void renderVisibleTerrain(TerrainInstance& instance, const DrawParameters& drawp);
         void renderVisible(Instance& instance, const DrawParameters& drawp);
 
+        /**
+         * Renders subset of InstancedInstance instances that intersect frustum
+         */
+        static void renderIntersectingInstancedInstance(InstancedInstance& instance, const Frustum& frustum, const DrawParameters& drawp);
+
     public:
-        void update(Scene& scene, Camera& camera);
+        void update(Scene& scene, Camera& camera, glm::uvec2 resolution, const RendererSettings& settings);
 
         /**
          * Renders instances from prepared scene in [update] method
@@ -61,6 +81,20 @@ namespace Limitless {
          */
         void renderDecals(const DrawParameters& drawp);
 
+        /**
+         * Renders effect instances prepared in [update] method
+         */
+        void renderEffects(const DrawParameters& drawp);
+
+        /**
+         * Renders scene instances of parameters filter that intersect frustum, regardless of camera visibility
+         *
+         * used by shadow views, which must contain casters outside of camera view too
+         *
+         * EffectInstances and DecalInstances are not rendered here
+         */
+        static void renderIntersecting(Scene& scene, const Frustum& frustum, const DrawParameters& drawp);
+
         /**
          * Static methods to 'just' render instances as it is
          *
@@ -72,6 +106,7 @@ namespace Limitless {
         static void render(ModelInstance& instance, const DrawParameters& drawp);
         static void render(SkeletalInstance& instance, const DrawParameters& drawp);
         static void render(InstancedInstance& instance, const DrawParameters& drawp);
+        static void render(SkeletalInstancedInstance& instance, const DrawParameters& drawp);
         static void render(TerrainInstance& instance, const DrawParameters& drawp);
         static void render(DecalInstance& instance, const DrawParameters& drawp);
 
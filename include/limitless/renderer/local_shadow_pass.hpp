@@ -0,0 +1,37 @@
+#pragma once
+
+#include <limitless/renderer/renderer_pass.hpp>
+#include <limitless/lighting/local_shadows.hpp>
+#include <limitless/renderer/instance_renderer.hpp>
+
+namespace Limitless {
+    /**
+     * LocalShadowPass renders shadow casters of Point and Spot lights into shadow atlas
+     */
+    class LocalShadowPass final : public RendererPass {
+    private:
+        /**
+         * Atlas-based local shadows implementation
+         */
+        LocalShadows shadows;
+    public:
+        explicit LocalShadowPass(Renderer& renderer);
+
+        /**
+         * Adds shadow atlas and shadow data to setter
+         */
+        void addUniformSetter(UniformSetter& setter) override;
+
+        /**
+         * Applies atlas layout and budgets of settings
+         */
+        void update(const RendererSettings& settings) override;
+
+        /**
+         * Draws scheduled shadow views
+         */
+        void render(InstanceRenderer &renderer, Scene& scene, Context &ctx, const Assets &assets, const Camera &camera, UniformSetter &setter) override;
+
+        [[nodiscard]] const auto& getStats() const noexcept { return shadows.getStats(); }
+    };
+}
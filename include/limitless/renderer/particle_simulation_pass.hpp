@@ -0,0 +1,27 @@
+#pragma once
+
+#include <limitless/renderer/renderer_pass.hpp>
+
+namespace Limitless {
+    class Instance;
+
+    /**
+     * Simulates particles of sprite emitters in compute shader once per frame
+     *
+     * emitters that can be simulated on GPU are switched to it when their simulation shader is compiled,
+     * others keep updating on CPU; enabled by gpu_particles renderer setting
+     *
+     * when pass is removed, emitters it simulated return to CPU on their next update
+     */
+    class ParticleSimulationPass final : public RendererPass {
+    private:
+        // emitters keep weak reference to it as long as they are simulated by this pass
+        std::shared_ptr<const void> dispatcher;
+
+        void simulate(Instance& instance, Context& ctx, const Assets& assets);
+    public:
+        explicit ParticleSimulationPass(Renderer& renderer);
+
+        void render(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera, UniformSetter& setter) override;
+    };
+}
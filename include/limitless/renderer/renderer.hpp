@@ -45,6 +45,7 @@ namespace Limitless {
         [[nodiscard]] const RendererSettings& getSettings() const noexcept { return settings; }
         [[nodiscard]] const glm::uvec2& getResolution() const noexcept { return resolution; }
         [[nodiscard]] const InstanceRenderer& getInstanceRenderer() const noexcept { return instance_renderer; }
+        [[nodiscard]] const auto& getPasses() const noexcept { return passes; }
 
         /**
          * Sets of methods to handle RendererPasses
@@ -111,7 +112,10 @@ namespace Limitless {
              * Adds RenderPass to the end of pipeline
              */
             Builder& addSceneUpdatePass();
+            Builder& addSkinningPass();
+            Builder& addParticleSimulationPass();
             Builder& addDirectionalShadowPass();
+            Builder& addLocalShadowPass();
             Builder& addDeferredFramebufferPass();
             Builder& addDepthPass();
             Builder& addColorPicker();
@@ -170,7 +174,7 @@ namespace Limitless {
 
                 if (it != renderer->passes.end()) {
                     auto pass = std::make_unique<RenderPass>(*renderer, std::forward<Args>(args)...);
-                    renderer->passes.insert(it++, std::move(pass));
+                    renderer->passes.insert(std::next(it), std::move(pass));
                 } else {
                     throw render_pass_not_found {"Cannot add RenderPass after specified element, does not exist"};
                 }
@@ -178,6 +182,28 @@ namespace Limitless {
                 return *this;
             }
 
+            /**
+             * Constructs RenderPass right after the last present of specified Passes
+             *
+             * passes that may be toggled at runtime list their predecessors, so they keep order of pipeline whatever order they are enabled in
+             */
+            template<typename RenderPass, typename... After>
+            Builder& addAfterLast() {
+                auto last = renderer->passes.end();
+                for (auto it = renderer->passes.begin(); it != renderer->passes.end(); ++it) {
+                    if ((dynamic_cast<After*>(it->get()) || ...)) {
+                        last = it;
+                    }
+                }
+
+                if (last == renderer->passes.end()) {
+                    throw render_pass_not_found {"Cannot add RenderPass after specified elements, none exists"};
+                }
+
+                renderer->passes.insert(std::next(last), std::make_unique<RenderPass>(*renderer));
+                return *this;
+            }
+
             /**
              * Removes RendererPass if present
              */
@@ -56,6 +56,27 @@ namespace Limitless {
          */
         bool csm_micro_shadowing = true;
 
+        /**
+         * Static shadow casters cache for CSM
+         *
+         * static instances are redrawn only when light direction changes or cascade moves past margin
+         */
+        bool csm_static_cache = false;
+        float csm_static_cache_margin = 0.1f; // fraction of cascade radius
+
+        /**
+         * Shadow maps for Point and Spot lights
+         *
+         * all local shadows share single depth atlas
+         * texel budget limits total atlas area used, update budget limits shadow views rendered per frame
+         */
+        bool local_shadow_maps = false;
+        uint32_t local_shadows_atlas_resolution = 1024 * 8;
+        uint32_t local_shadows_min_resolution = 128;
+        uint32_t local_shadows_max_resolution = 1024;
+        uint64_t local_shadows_texel_budget = 1024 * 1024 * 32;
+        uint32_t local_shadows_update_budget = 12;
+
         /**
          *
          */
@@ -71,6 +92,21 @@ namespace Limitless {
          float specular_aa_threshold {0.1f};
          float specular_aa_variance {0.2f};
 
+        /**
+         * Skins skeletal meshes once per frame in compute shader instead of every pass vertex shader
+         */
+        bool compute_skinning {false};
+
+        /**
+         * Simulates particles of supported sprite emitters in compute shader
+         */
+        bool gpu_particles {false};
+
+        /**
+         * Expands beam ribbons in vertex shader instead of on CPU every frame
+         */
+        bool gpu_beams {false};
+
         /**
          * Debug settings
          */
@@ -131,6 +167,22 @@ namespace Limitless {
              */
             bool csm_micro_shadowing = true;
 
+            /**
+             * Static shadow casters cache for CSM
+             */
+            bool csm_static_cache = false;
+            float csm_cache_margin = 0.1f;
+
+            /**
+             * Shadow maps for Point and Spot lights
+             */
+            bool local_shadow_maps = false;
+            uint32_t local_atlas_resolution = 1024 * 8;
+            uint32_t local_min_resolution = 128;
+            uint32_t local_max_resolution = 1024;
+            uint64_t local_texel_budget = 1024 * 1024 * 32;
+            uint32_t local_update_budget = 12;
+
             /**
              *
              */
@@ -146,6 +198,21 @@ namespace Limitless {
             float specular_threshold {0.1f};
             float specular_variance {0.2f};
 
+            /**
+             * Compute skinning
+             */
+            bool compute_skinning {false};
+
+            /**
+             * GPU particles
+             */
+            bool gpu_particles {false};
+
+            /**
+             * GPU beams
+             */
+            bool gpu_beams {false};
+
             /**
              * Debug settings
              */
@@ -191,6 +258,16 @@ namespace Limitless {
             Builder& csm_disable_pcf();
             Builder& csm_enable_micro_shadowing();
             Builder& csm_disable_micro_shadowing();
+            Builder& csm_enable_static_cache();
+            Builder& csm_disable_static_cache();
+            Builder& csm_static_cache_margin(float margin);
+
+            Builder& enable_local_shadows();
+            Builder& disable_local_shadows();
+            Builder& local_shadows_atlas_resolution(uint32_t resolution);
+            Builder& local_shadows_resolution(uint32_t min, uint32_t max);
+            Builder& local_shadows_texel_budget(uint64_t texels);
+            Builder& local_shadows_update_budget(uint32_t views);
 
             Builder& enable_bloom();
             Builder& disable_bloom();
@@ -203,6 +280,15 @@ namespace Limitless {
             Builder& specular_aa_threshold(float threshold);
             Builder& specular_aa_variance(float variance);
 
+            Builder& enable_compute_skinning();
+            Builder& disable_compute_skinning();
+
+            Builder& enable_gpu_particles();
+            Builder& disable_gpu_particles();
+
+            Builder& enable_gpu_beams();
+            Builder& disable_gpu_beams();
+
             Builder& debug_light_radius();
             Builder& debug_coordinate_system_axes();
             Builder& debug_bounding_box();
@@ -24,6 +24,11 @@ namespace Limitless {
          */
         void addUniformSetter(UniformSetter& setter) override;
 
+        /**
+         * Forces static shadow casters to be redrawn
+         */
+        void invalidateStaticCache() noexcept { shadows.invalidateStaticCache(); }
+
         /**
          * Draws shadow
          */
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <limitless/renderer/renderer_pass.hpp>
+
+namespace Limitless {
+    class SkeletalInstance;
+
+    /**
+     * Skins vertices of skeletal instances in compute shader once per frame
+     *
+     * results are written to per-instance output buffers that are read by every following pass
+     * instead of skinning in vertex shader; enabled by compute_skinning renderer setting
+     */
+    class SkinningPass final : public RendererPass {
+    private:
+        static constexpr uint32_t WORKGROUP_SIZE = 64;
+
+        static void skin(SkeletalInstance& instance, Context& ctx, ShaderProgram& shader);
+    public:
+        explicit SkinningPass(Renderer& renderer);
+
+        void render(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera, UniformSetter& setter) override;
+    };
+}
@@ -2,10 +2,14 @@
 
 #include <limitless/lighting/lighting.hpp>
 #include <limitless/instances/skeletal_instance.hpp>
+#include <limitless/instances/animation_lod.hpp>
+#include <limitless/instances/effect_culling.hpp>
+#include <limitless/instances/particle_lod.hpp>
 #include <limitless/instances/effect_instance.hpp>
 #include <limitless/instances/instance_builder.hpp>
 #include <limitless/skybox/skybox.hpp>
 #include <limitless/camera.hpp>
+#include <limitless/util/thread_pool.hpp>
 #include <stdexcept>
 #include <unordered_map>
 #include <memory>
@@ -26,7 +30,31 @@ namespace Limitless {
         Lighting lighting;
         std::unordered_map<uint64_t, std::shared_ptr<Instance>> instances;
         std::shared_ptr<Skybox> skybox;
+
+        /**
+         * Animation LOD of skeletal instances
+         */
+        AnimationLod animation_lod;
+
+        /**
+         * Culling of effect emitters
+         */
+        EffectCulling effect_culling;
+
+        /**
+         * Particle LOD of simulated emitters
+         */
+        ParticleLod particle_lod;
+
+        /**
+         * Threads that update emitters of effects; effects are updated serially when there is no pool
+         */
+        std::unique_ptr<ThreadPool> effect_pool;
+        std::vector<EffectInstance*> updated_effects;
+        std::vector<fx::AbstractEmitter*> updated_emitters;
+
         void removeDeadInstances() noexcept;
+        void updateEffects(const Camera& camera);
     public:
         explicit Scene(Context& context);
 
@@ -53,6 +81,22 @@ namespace Limitless {
         std::shared_ptr<Skybox>& getSkybox() noexcept;
         void setSkybox(const std::shared_ptr<Skybox>& skybox);
 
+        const AnimationLod& getAnimationLod() const noexcept { return animation_lod; }
+        AnimationLod& getAnimationLod() noexcept { return animation_lod; }
+
+        const EffectCulling& getEffectCulling() const noexcept { return effect_culling; }
+        EffectCulling& getEffectCulling() noexcept { return effect_culling; }
+
+        const ParticleLod& getParticleLod() const noexcept { return particle_lod; }
+        ParticleLod& getParticleLod() noexcept { return particle_lod; }
+
+        /**
+         * Sets number of pool threads that update emitters of effects together with calling thread, 0 disables pool
+         *
+         * particles do not depend on it, every emitter draws random numbers from its own stream
+         */
+        void setEffectUpdateThreads(uint32_t count);
+
         /**
          * Return visible scene instances.
          */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limitless/util/bytebuffer.hpp>
+#include <limitless/util/bytereader.hpp>
 
 #include <set>
 
@@ -16,7 +17,7 @@ namespace Limitless {
     };
 
     template<typename K, typename C>
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<std::set<K, C>>& asset_map) {
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<std::set<K, C>>& asset_map) {
         auto& [assets, asset] = asset_map;
         size_t size{};
         buffer >> size;
@@ -29,7 +30,7 @@ namespace Limitless {
     }
 
     template<typename K, typename V, template<typename...> class M>
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<M<K, V>>& asset_map) {
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<M<K, V>>& asset_map) {
         auto& [assets, asset] = asset_map;
         size_t size{};
         buffer >> size;
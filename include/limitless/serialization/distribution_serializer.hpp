@@ -6,6 +6,7 @@
 namespace Limitless {
     template<typename T> class Distribution;
     class ByteBuffer;
+    class ByteReader;
 
     class DistributionSerializer {
     private:
@@ -15,12 +16,12 @@ namespace Limitless {
         ByteBuffer serialize(const Distribution<T>& distr);
 
         template<typename T>
-        std::unique_ptr<Distribution<T>> deserialize(ByteBuffer& buffer);
+        std::unique_ptr<Distribution<T>> deserialize(ByteReader& buffer);
     };
 
     template<typename T>
     ByteBuffer& operator<<(ByteBuffer& buffer, const Distribution<T>& distr);
 
     template<typename T>
-    ByteBuffer& operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<T>>& distr);
+    ByteReader& operator>>(ByteReader& buffer, std::unique_ptr<Distribution<T>>& distr);
 }
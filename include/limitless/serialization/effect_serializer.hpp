@@ -7,6 +7,7 @@
 namespace Limitless {
     class EffectInstance;
     class ByteBuffer;
+    class ByteReader;
     class Assets;
     class Context;
 }
@@ -17,9 +18,9 @@ namespace Limitless {
         static constexpr uint8_t VERSION = 0x1;
     public:
         ByteBuffer serialize(const EffectInstance& instance);
-        std::shared_ptr<EffectInstance> deserialize(Assets& assets, ByteBuffer& buffer);
+        std::shared_ptr<EffectInstance> deserialize(Assets& assets, ByteReader& buffer);
     };
 
     ByteBuffer& operator<<(ByteBuffer& buffer, const EffectInstance& effect);
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<std::shared_ptr<EffectInstance>>& asset);
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<std::shared_ptr<EffectInstance>>& asset);
 }
\ No newline at end of file
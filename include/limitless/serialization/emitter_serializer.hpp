@@ -6,6 +6,7 @@
 
 namespace Limitless {
     class ByteBuffer;
+    class ByteReader;
     class Assets;
     class Context;
     class RendererSettings;
@@ -20,14 +21,18 @@ namespace Limitless {
 namespace Limitless {
     class EmitterSerializer {
     private:
-        static constexpr uint8_t VERSION = 0x1;
+        static constexpr uint8_t VERSION = 0x3;
+
+        // first versions that store fixed bounds and levels of detail
+        static constexpr uint8_t FIXED_BOUNDS_VERSION = 0x2;
+        static constexpr uint8_t LOD_VERSION = 0x3;
     public:
         ByteBuffer serialize(const fx::AbstractEmitter& emitter);
-        void deserialize(Assets& ctx, ByteBuffer& buffer, fx::EffectBuilder& builder);
+        void deserialize(Assets& ctx, ByteReader& buffer, fx::EffectBuilder& builder);
     };
 
     ByteBuffer& operator<<(ByteBuffer& buffer, const fx::EmitterSpawn& spawn);
-    ByteBuffer& operator>>(ByteBuffer& buffer, fx::EmitterSpawn& pair);
+    ByteReader& operator>>(ByteReader& buffer, fx::EmitterSpawn& pair);
 
     ByteBuffer& operator<<(ByteBuffer& buffer, const fx::AbstractEmitter& emitter);
 }
\ No newline at end of file
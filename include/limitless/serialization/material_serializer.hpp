@@ -9,6 +9,7 @@ namespace Limitless {
     class Context;
     class Assets;
     class ByteBuffer;
+    class ByteReader;
 }
 
 namespace Limitless {
@@ -16,12 +17,12 @@ namespace Limitless {
     private:
         static constexpr uint8_t VERSION = 0x2;
 
-        void deserialize(ByteBuffer& buffer, Assets& assets, ms::Material::Builder& builder);
+        void deserialize(ByteReader& buffer, Assets& assets, ms::Material::Builder& builder);
     public:
         ByteBuffer serialize(const ms::Material& material);
-        std::shared_ptr<ms::Material> deserialize(Assets& assets, ByteBuffer& buffer);
+        std::shared_ptr<ms::Material> deserialize(Assets& assets, ByteReader& buffer);
     };
 
     ByteBuffer& operator<<(ByteBuffer& buffer, const ms::Material& material);
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<std::shared_ptr<ms::Material>>& material);
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<std::shared_ptr<ms::Material>>& material);
 }
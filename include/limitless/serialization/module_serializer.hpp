@@ -170,7 +170,7 @@ namespace Limitless {
             return buffer;
         }
 
-        std::unique_ptr<fx::Module<Particle>> deserialize(ByteBuffer& buffer, [[maybe_unused]] Assets& assets) {
+        std::unique_ptr<fx::Module<Particle>> deserialize(ByteReader& buffer, [[maybe_unused]] Assets& assets) {
             uint8_t version {};
 
             buffer >> version;
@@ -382,7 +382,7 @@ namespace Limitless {
     }
 
     template<typename Particle>
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<std::unique_ptr<fx::Module<Particle>>>& asset) {
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<std::unique_ptr<fx::Module<Particle>>>& asset) {
         ModuleSerializer<Particle> serializer;
         auto& [assets, module] = asset;
         module = serializer.deserialize(buffer, assets);
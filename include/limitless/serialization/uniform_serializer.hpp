@@ -7,6 +7,7 @@
 namespace Limitless {
     class Uniform;
     class ByteBuffer;
+    class ByteReader;
     class Assets;
     enum class UniformValueType;
 
@@ -20,16 +21,16 @@ namespace Limitless {
         template<typename T>
         void serializeUniformValue(const Uniform& uniform, ByteBuffer& buffer);
 
-        Uniform* deserializeUniformValue(ByteBuffer& buffer, std::string&& name, UniformValueType value_type);
-        Uniform* deserializeUniformSampler(ByteBuffer& buffer, Assets& assets, std::string&& name);
-        Uniform* deserializeUniformTime(ByteBuffer& buffer, std::string&& name);
+        Uniform* deserializeUniformValue(ByteReader& buffer, std::string&& name, UniformValueType value_type);
+        Uniform* deserializeUniformSampler(ByteReader& buffer, Assets& assets, std::string&& name);
+        Uniform* deserializeUniformTime(ByteReader& buffer, std::string&& name);
         template<typename T>
-        Uniform* deserializeUniformValue(ByteBuffer& buffer, std::string&& name);
+        Uniform* deserializeUniformValue(ByteReader& buffer, std::string&& name);
     public:
         ByteBuffer serialize(const Uniform& uniform);
-        std::unique_ptr<Uniform> deserialize(ByteBuffer& buffer, Assets& assets);
+        std::unique_ptr<Uniform> deserialize(ByteReader& buffer, Assets& assets);
     };
 
     ByteBuffer& operator<<(ByteBuffer& buffer, const Uniform& uniform);
-    ByteBuffer& operator>>(ByteBuffer& buffer, const AssetDeserializer<std::unique_ptr<Uniform>>& asset);
+    ByteReader& operator>>(ByteReader& buffer, const AssetDeserializer<std::unique_ptr<Uniform>>& asset);
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limitless/util/bytereader.hpp>
+
 #include <algorithm>
 #include <string>
 #include <memory>
@@ -15,14 +17,12 @@ namespace Limitless {
     private:
         std::vector<std::byte> buffer;
 
+        // offset of bytes that are not read yet
+        size_t read_offset {};
+
         void write(const std::byte& bytes, size_t size) {
             buffer.insert(buffer.end(), &bytes, &bytes + size);
         }
-
-        void read(std::byte& bytes, size_t size) {
-            std::copy(buffer.begin(), buffer.begin() + size, &bytes);
-            buffer.erase(buffer.begin(), buffer.begin() + size);
-        }
     public:
         ByteBuffer() = default;
 
@@ -54,39 +54,43 @@ namespace Limitless {
             write(reinterpret_cast<const std::byte&>(*str.c_str()), str.size());
         }
 
-        void read(std::string& str) {
-            size_t size{};
-            read(size);
-            str.resize(size);
-            read(reinterpret_cast<std::byte&>(*str.data()), size);
-        }
-
         template<typename T, std::enable_if_t<std::is_trivially_copyable_v<std::remove_reference_t<T>>, bool> = true>
         void write(T&& value) {
             write(reinterpret_cast<const std::byte&>(value), sizeof(T));
         }
 
-        template<typename T, std::enable_if_t<std::is_trivially_copyable_v<T>, bool> = true>
-        void read(T& value) {
-            read(reinterpret_cast<std::byte&>(value), sizeof(T));
+        /**
+         * Writes elements as single block of bytes, it is read back by ByteReader::readBlock
+         */
+        template<typename T>
+        void writeBlock(const std::vector<T>& v) {
+            static_assert(std::is_trivially_copyable_v<T>, "block elements should be trivially copyable");
+
+            write(v.size());
+            if (!v.empty()) {
+                write(reinterpret_cast<const std::byte&>(*v.data()), v.size() * sizeof(T));
+            }
         }
 
         void flip() {
             std::reverse(buffer.begin(), buffer.end());
         }
 
-        template<typename T, std::enable_if_t<std::is_copy_constructible_v<T>, bool> = true>
-        T erase() {
-            std::array<std::byte, sizeof(T)> value{};
-            std::copy(buffer.begin(), buffer.begin() + sizeof(T), value.begin());
-            buffer.erase(buffer.begin(), buffer.begin() + sizeof(T));
-
-            return reinterpret_cast<T&>(value);
+        /**
+         * Gets reader of bytes that are not read yet
+         */
+        [[nodiscard]] ByteReader reader() const noexcept {
+            return {buffer.data() + read_offset, buffer.size() - read_offset};
         }
 
+        /**
+         * Reads value from where previous read stopped
+         */
         template<typename T>
-        ByteBuffer& operator>>(T& value) {
-            read(value);
+        ByteBuffer& operator>>(T&& value) {
+            auto bytes = reader();
+            bytes >> std::forward<T>(value);
+            read_offset += bytes.tell();
             return *this;
         }
 
@@ -95,11 +99,6 @@ namespace Limitless {
             return *this;
         }
 
-        ByteBuffer& operator>>(std::string& str) {
-            read(str);
-            return *this;
-        }
-
         template<typename T>
         ByteBuffer& operator<<(const std::vector<T>& v) {
             *this << v.size();
@@ -113,29 +112,6 @@ namespace Limitless {
             return *this;
         }
 
-        template<typename T, size_t size>
-        ByteBuffer& operator>>(std::array<T, size>& array) {
-            for (size_t i = 0; i < size; ++i) {
-                T value{};
-                *this >> value;
-                array[i] = std::move(value);
-            }
-            return *this;
-        }
-
-        template<typename T>
-        ByteBuffer& operator>>(std::vector<T>& v) {
-            size_t size{};
-            *this >> size;
-            v.reserve(size);
-            for (size_t i = 0; i < size; ++i) {
-                T value{};
-                *this >> value;
-                v.emplace_back(std::move(value));
-            }
-            return *this;
-        }
-
         template<typename T>
         ByteBuffer& operator<<(const std::unique_ptr<T>& ptr) {
             *this << *ptr;
@@ -176,56 +152,6 @@ namespace Limitless {
             return *this;
         }
 
-        template<typename K, typename V>
-        ByteBuffer& operator>>(std::unordered_map<K, V>& m) {
-            size_t size{};
-            *this >> size;
-            for (size_t i = 0; i < size; ++i) {
-                K key{};
-                V value{};
-                *this >> key >> value;
-                m.emplace(std::move(key), std::move(value));
-            }
-            return *this;
-        }
-
-        template<typename K, typename V>
-        ByteBuffer& operator>>(std::map<K, V>& m) {
-            size_t size{};
-            *this >> size;
-            for (size_t i = 0; i < size; ++i) {
-                K key{};
-                V value{};
-                *this >> key >> value;
-                m.emplace(std::move(key), std::move(value));
-            }
-            return *this;
-        }
-
-        template<typename K>
-        ByteBuffer& operator>>(std::set<K>& s) {
-            size_t size {};
-            *this >> size;
-            for (size_t i = 0; i < size; ++i) {
-                K key {};
-                *this >> key;
-                s.emplace(std::move(key));
-            }
-            return *this;
-        }
-
-        template<typename K, typename Comp>
-        ByteBuffer& operator>>(std::set<K, Comp>& s) {
-            size_t size {};
-            *this >> size;
-            for (size_t i = 0; i < size; ++i) {
-                K key {};
-                *this >> key;
-                s.emplace(std::move(key));
-            }
-            return *this;
-        }
-
         [[nodiscard]] auto begin() const { return buffer.cbegin(); }
         [[nodiscard]] auto end() const { return buffer.cend(); }
 
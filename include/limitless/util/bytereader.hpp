@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace Limitless {
+    /**
+     * Reads values written by ByteBuffer from memory it does not own
+     *
+     * reading moves cursor forward and never touches the rest of memory, so parsing of whole file
+     * is linear in its size; strings and blobs can be taken as views into that memory without copying,
+     * views stay valid as long as memory itself
+     */
+    class ByteReader final {
+    private:
+        const std::byte* first;
+        const std::byte* last;
+        const std::byte* cursor;
+
+        const std::byte* advance(size_t size) {
+            if (size > remaining()) {
+                throw std::out_of_range {"ByteReader: read past the end of buffer"};
+            }
+
+            const auto* bytes = cursor;
+            cursor += size;
+            return bytes;
+        }
+    public:
+        ByteReader(const std::byte* data, size_t size) noexcept
+            : first {data}
+            , last {data + size}
+            , cursor {data} {
+        }
+
+        [[nodiscard]] auto data() const noexcept { return first; }
+        [[nodiscard]] size_t size() const noexcept { return last - first; }
+        [[nodiscard]] size_t tell() const noexcept { return cursor - first; }
+        [[nodiscard]] size_t remaining() const noexcept { return last - cursor; }
+        [[nodiscard]] bool empty() const noexcept { return cursor == last; }
+
+        void seek(size_t offset) {
+            if (offset > size()) {
+                throw std::out_of_range {"ByteReader: seek past the end of buffer"};
+            }
+            cursor = first + offset;
+        }
+
+        /**
+         * Gets next size bytes without copying them
+         */
+        std::string_view view(size_t size) {
+            return {reinterpret_cast<const char*>(advance(size)), size};
+        }
+
+        /**
+         * Gets next string written by ByteBuffer without copying it
+         */
+        std::string_view viewString() {
+            size_t size {};
+            read(size);
+            return view(size);
+        }
+
+        void read(std::string& str) {
+            str.assign(viewString());
+        }
+
+        template<typename T, std::enable_if_t<std::is_trivially_copyable_v<T>, bool> = true>
+        void read(T& value) {
+            std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+        }
+
+        /**
+         * Reads elements written by ByteBuffer::writeBlock with single copy
+         */
+        template<typename T>
+        void readBlock(std::vector<T>& v) {
+            static_assert(std::is_trivially_copyable_v<T>, "block elements should be trivially copyable");
+
+            size_t count {};
+            read(count);
+            if (count > remaining() / sizeof(T)) {
+                throw std::out_of_range {"ByteReader: read past the end of buffer"};
+            }
+
+            const auto* bytes = advance(count * sizeof(T));
+            v.resize(count);
+            if (count != 0) {
+                std::memcpy(v.data(), bytes, count * sizeof(T));
+            }
+        }
+
+        template<typename T>
+        ByteReader& operator>>(T& value) {
+            read(value);
+            return *this;
+        }
+
+        ByteReader& operator>>(std::string& str) {
+            read(str);
+            return *this;
+        }
+
+        template<typename T, size_t size>
+        ByteReader& operator>>(std::array<T, size>& array) {
+            for (size_t i = 0; i < size; ++i) {
+                T value{};
+                *this >> value;
+                array[i] = std::move(value);
+            }
+            return *this;
+        }
+
+        template<typename T>
+        ByteReader& operator>>(std::vector<T>& v) {
+            size_t size{};
+            *this >> size;
+            // corrupted size should fail on reading instead of allocation
+            v.reserve(std::min(size, remaining()));
+            for (size_t i = 0; i < size; ++i) {
+                T value{};
+                *this >> value;
+                v.emplace_back(std::move(value));
+            }
+            return *this;
+        }
+
+        template<typename K, typename V>
+        ByteReader& operator>>(std::unordered_map<K, V>& m) {
+            size_t size{};
+            *this >> size;
+            for (size_t i = 0; i < size; ++i) {
+                K key{};
+                V value{};
+                *this >> key >> value;
+                m.emplace(std::move(key), std::move(value));
+            }
+            return *this;
+        }
+
+        template<typename K, typename V>
+        ByteReader& operator>>(std::map<K, V>& m) {
+            size_t size{};
+            *this >> size;
+            for (size_t i = 0; i < size; ++i) {
+                K key{};
+                V value{};
+                *this >> key >> value;
+                m.emplace(std::move(key), std::move(value));
+            }
+            return *this;
+        }
+
+        template<typename K, typename Comp>
+        ByteReader& operator>>(std::set<K, Comp>& s) {
+            size_t size {};
+            *this >> size;
+            for (size_t i = 0; i < size; ++i) {
+                K key {};
+                *this >> key;
+                s.emplace(std::move(key));
+            }
+            return *this;
+        }
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limitless/instances/model_instance.hpp>
+#include <limitless/instances/effect_instance.hpp>
 #include <iostream>
 
 namespace Limitless {
@@ -23,7 +24,7 @@ namespace Limitless {
             const auto frustum = Frustum::fromCamera(camera);
 
             for (auto& instance : scene.getInstances()) {
-                if (instance->getInstanceType() == InstanceType::Instanced) {
+                if (instance->getInstanceType() == InstanceType::Instanced || instance->getInstanceType() == InstanceType::SkeletalInstanced) {
                     auto& instanced = static_cast<InstancedInstance&>(*instance); //NOLINT
 
                     for (auto& i: instanced.getInstances()) {
@@ -75,6 +76,11 @@ namespace Limitless {
 //                    ) {
                         visible.emplace_back(instance);
 //                    }
+                } else if (instance->getInstanceType() == InstanceType::Effect) {
+                    // box of effect is merged from its emitters, effects without known bounds are always visible
+                    if (!static_cast<EffectInstance&>(*instance).isBounded() || frustum.intersects(*instance)) { //NOLINT
+                        visible.emplace_back(instance);
+                    }
                 } else {
                     if (frustum.intersects(*instance)) {
                         visible.emplace_back(instance);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <limitless/util/bytereader.hpp>
+#include <limitless/util/filesystem.hpp>
+
+#include <memory>
+
+namespace Limitless {
+    /**
+     * Read-only contents of file that deserializers parse in place
+     *
+     * file is mapped to memory, so its pages are read by OS on first access and no copy of it is made;
+     * when file cannot be mapped (platform without mmap or file system that does not support it),
+     * it is read once into uninitialized memory instead
+     */
+    class MappedFile final {
+    private:
+        const std::byte* bytes {};
+        size_t length {};
+
+        // whether bytes are mapped or point to storage
+        bool mapped {};
+        std::unique_ptr<std::byte[]> storage;
+    public:
+        /**
+         * Opens file; throws std::runtime_error if it cannot be read
+         */
+        explicit MappedFile(const fs::path& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&&) = delete;
+        MappedFile& operator=(MappedFile&&) = delete;
+
+        [[nodiscard]] auto data() const noexcept { return bytes; }
+        [[nodiscard]] auto size() const noexcept { return length; }
+        [[nodiscard]] bool isMapped() const noexcept { return mapped; }
+
+        /**
+         * Gets reader of whole file; it is valid as long as file is
+         */
+        [[nodiscard]] ByteReader reader() const noexcept {
+            return {bytes, length};
+        }
+    };
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <limitless/util/xoshiro128.hpp>
+
+#include <cstdint>
+
+namespace Limitless {
+    /**
+     * Random number streams of threads
+     *
+     * distributions draw numbers from stream of calling thread, so they can be sampled from several threads at once;
+     * owner of some state (e.g. emitter) installs its own engine for the duration of its update with Scope,
+     * which keeps sequence of numbers it gets independent of thread that runs it and of other updates
+     */
+    class RandomStream final {
+    public:
+        using Engine = Xoshiro128;
+    private:
+        static inline thread_local Engine* current {};
+    public:
+        /**
+         * Installs engine as stream of current thread until scope ends
+         */
+        class Scope final {
+        private:
+            Engine* previous;
+        public:
+            explicit Scope(Engine& engine) noexcept
+                : previous {current} {
+                current = &engine;
+            }
+
+            ~Scope() {
+                current = previous;
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+        /**
+         * Gets stream of current thread
+         *
+         * when no engine is installed, default seeded engine of thread is used
+         */
+        static Engine& get() noexcept {
+            if (current) {
+                return *current;
+            }
+
+            static thread_local Engine fallback;
+            return fallback;
+        }
+
+        /**
+         * Derives seed of independent stream from base seed and stream index
+         */
+        static constexpr uint64_t seed(uint64_t base, uint64_t index) noexcept {
+            // splitmix64 finalizer
+            auto x = base + (index + 1) * 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30u)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27u)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31u);
+        }
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <limitless/util/box.hpp>
+#include <array>
+#include <cstdint>
+
+namespace Limitless {
+    class Camera;
+
+    /**
+     * Projected size of boxes for camera, used to select levels of detail
+     *
+     * screen size is radius of bounding sphere of box divided by half height of view at box distance
+     */
+    class ScreenSize final {
+    private:
+        glm::vec3 camera_position {0.0f};
+        float view_scale {1.0f};
+    public:
+        ScreenSize() = default;
+        explicit ScreenSize(const Camera& camera);
+
+        /**
+         * Returns screen size of box, boxes that contain camera are of infinite size
+         */
+        [[nodiscard]] float get(const Box& box) const noexcept;
+
+        /**
+         * Returns index of the first threshold that screen size reaches, count of thresholds if none
+         */
+        template<size_t N>
+        [[nodiscard]] static uint32_t getLevel(float screen_size, const std::array<float, N>& thresholds) noexcept {
+            uint32_t level = 0;
+            while (level < N && screen_size < thresholds[level]) {
+                ++level;
+            }
+            return level;
+        }
+    };
+}
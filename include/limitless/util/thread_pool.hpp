@@ -46,6 +46,16 @@ namespace Limitless {
             return future;
         }
 
+        /**
+         * Calls task for every index in [0, count) on pool threads and waits for all of them
+         *
+         * calling thread takes indices too, so it may be called from task of this pool
+         * without waiting for free threads; exception thrown by task is rethrown to caller
+         */
+        void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+        [[nodiscard]] auto getThreadCount() const noexcept { return threads.size(); }
+
         void joinAll();
     };
 }
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Limitless {
+    /**
+     * xoshiro128++ generator running several independent lanes in lockstep
+     *
+     * state word of every lane is stored next to the same word of other lanes, so one step of all lanes
+     * is plain loop over arrays that compiler turns into vector instructions; numbers are handed out
+     * one at a time from last generated block or written in whole blocks with fill
+     *
+     * satisfies UniformRandomBitGenerator
+     */
+    class Xoshiro128 final {
+    public:
+        using result_type = uint32_t;
+
+        static constexpr size_t LANES = 8;
+    private:
+        uint32_t s0[LANES] {};
+        uint32_t s1[LANES] {};
+        uint32_t s2[LANES] {};
+        uint32_t s3[LANES] {};
+
+        uint32_t block[LANES] {};
+        size_t next {LANES};
+
+        static constexpr uint32_t rotl(uint32_t x, uint32_t k) noexcept {
+            return (x << k) | (x >> (32u - k));
+        }
+
+        static constexpr uint64_t splitmix64(uint64_t& x) noexcept {
+            auto z = (x += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27u)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31u);
+        }
+
+        // advances all lanes by one step and writes their outputs to block
+        void step() noexcept {
+            for (size_t i = 0; i < LANES; ++i) {
+                block[i] = rotl(s0[i] + s3[i], 7) + s0[i];
+
+                const auto t = s1[i] << 9u;
+
+                s2[i] ^= s0[i];
+                s3[i] ^= s1[i];
+                s1[i] ^= s2[i];
+                s0[i] ^= s3[i];
+
+                s2[i] ^= t;
+                s3[i] = rotl(s3[i], 11);
+            }
+        }
+
+        // upper 24 bits are mapped to [0, 1) exactly
+        static constexpr float toFloat(uint32_t x) noexcept {
+            return static_cast<float>(x >> 8u) * (1.0f / 16777216.0f);
+        }
+    public:
+        explicit Xoshiro128(uint64_t value = 1) noexcept {
+            seed(value);
+        }
+
+        /**
+         * Restarts generator; lanes are seeded from splitmix64 sequence of value
+         */
+        void seed(uint64_t value) noexcept {
+            for (size_t i = 0; i < LANES; ++i) {
+                const auto a = splitmix64(value);
+                const auto b = splitmix64(value);
+
+                s0[i] = static_cast<uint32_t>(a);
+                s1[i] = static_cast<uint32_t>(a >> 32u);
+                s2[i] = static_cast<uint32_t>(b);
+                s3[i] = static_cast<uint32_t>(b >> 32u);
+            }
+
+            next = LANES;
+        }
+
+        result_type operator()() noexcept {
+            if (next == LANES) {
+                step();
+                next = 0;
+            }
+
+            return block[next++];
+        }
+
+        /**
+         * Writes count uniform floats in [0, 1)
+         */
+        void fill(float* out, size_t count) noexcept {
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES) {
+                step();
+                for (size_t k = 0; k < LANES; ++k) {
+                    out[i + k] = toFloat(block[k]);
+                }
+            }
+
+            if (i != count) {
+                step();
+                for (size_t k = 0; i + k < count; ++k) {
+                    out[i + k] = toFloat(block[k]);
+                }
+            }
+
+            // block was consumed here
+            next = LANES;
+        }
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+    };
+}
@@ -38,7 +38,7 @@ struct InstanceData {
 //
 
 // INSTANCED MODEL
-#if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+#if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
     layout (std430) buffer model_buffer {
         InstanceData _instances[];
     };
@@ -72,6 +72,13 @@ layout (std430) buffer bone_buffer {
 };
 
 mat4 getBoneMatrix() {
+    // vertex attributes are already skinned
+    #if defined (ENGINE_SETTINGS_COMPUTE_SKINNING)
+        if (_compute_skinned != 0u) {
+            return mat4(1.0);
+        }
+    #endif
+
     ivec4 bone_id = getVertexBoneID();
     vec4 bone_weight = getVertexBoneWeight();
 
@@ -85,6 +92,65 @@ mat4 getBoneMatrix() {
 #endif
 //
 
+// SKELETAL INSTANCED MODEL
+// bone palettes are baked for each animation frame, instance supplies only animation and time
+#if defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
+struct BakedClip {
+    uint first_frame;
+    uint frame_count;
+    uint joint_count;
+    float frame_rate;
+};
+
+struct InstanceAnimation {
+    uint animation;
+    float time;
+};
+
+layout (std430) buffer baked_palette_buffer {
+    mat4 _baked_palettes[];
+};
+
+layout (std430) buffer baked_clip_buffer {
+    BakedClip _baked_clips[];
+};
+
+layout (std430) buffer animation_buffer {
+    InstanceAnimation _instance_animations[];
+};
+
+mat4 getBakedBoneMatrix(uint frame, ivec4 bone_id, vec4 bone_weight, uint joint_count) {
+    uint base = frame * joint_count;
+
+    mat4 bone_transform = _baked_palettes[base + uint(bone_id[0])] * bone_weight[0];
+    bone_transform     += _baked_palettes[base + uint(bone_id[1])] * bone_weight[1];
+    bone_transform     += _baked_palettes[base + uint(bone_id[2])] * bone_weight[2];
+    bone_transform     += _baked_palettes[base + uint(bone_id[3])] * bone_weight[3];
+
+    return bone_transform;
+}
+
+mat4 getBoneMatrix() {
+    InstanceAnimation state = _instance_animations[gl_InstanceID];
+    BakedClip clip = _baked_clips[state.animation];
+
+    float frame = state.time * clip.frame_rate;
+    uint last = clip.frame_count - 1u;
+    uint frame0 = min(uint(frame), last);
+    uint frame1 = min(frame0 + 1u, last);
+    float factor = fract(frame);
+
+    ivec4 bone_id = getVertexBoneID();
+    vec4 bone_weight = getVertexBoneWeight();
+
+    mat4 pose0 = getBakedBoneMatrix(clip.first_frame + frame0, bone_id, bone_weight, clip.joint_count);
+    mat4 pose1 = getBakedBoneMatrix(clip.first_frame + frame1, bone_id, bone_weight, clip.joint_count);
+
+    return pose0 * (1.0 - factor) + pose1 * factor;
+}
+#endif
+//
+
 // EFFECT MODEL
 #if defined (ENGINE_MATERIAL_EFFECT_MODEL) && !defined (MeshEmitter)
     mat4 getModelMatrix() {
@@ -93,7 +159,7 @@ mat4 getBoneMatrix() {
 #endif
 
 mat4 getModelTransform() {
-    #if defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+    #if defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
         return getModelMatrix() * getBoneMatrix();
     #else
         return getModelMatrix();
@@ -101,7 +167,7 @@ mat4 getModelTransform() {
 }
 
 // TBN matrix only for meshes
-#if (defined (MeshEmitter) || defined (ENGINE_MATERIAL_REGULAR_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_DECAL_MODEL) || defined (ENGINE_MATERIAL_TERRAIN_MODEL)) && defined (ENGINE_MATERIAL_NORMAL_TEXTURE) && defined (ENGINE_SETTINGS_NORMAL_MAPPING)
+#if (defined (MeshEmitter) || defined (ENGINE_MATERIAL_REGULAR_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_DECAL_MODEL) || defined (ENGINE_MATERIAL_TERRAIN_MODEL)) && defined (ENGINE_MATERIAL_NORMAL_TEXTURE) && defined (ENGINE_SETTINGS_NORMAL_MAPPING)
     mat3 getModelTBN(mat4 model_transform) {
         //TODO: pass through uniform instance buffer ? bone transform ?
         mat3 normal_matrix = transpose(inverse(mat3(model_transform)));
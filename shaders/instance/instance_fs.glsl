@@ -36,7 +36,7 @@ struct InstanceData {
 //
 
 // INSTANCED MODEL
-#if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+#if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
     layout (std430) buffer model_buffer {
         InstanceData _instances[];
     };
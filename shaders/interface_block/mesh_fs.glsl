@@ -8,7 +8,7 @@ in _vertex_data {
     vec3 world_position;
     vec2 uv;
 
-    #if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+    #if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
         flat int instance_id;
     #endif
 } _in_data;
@@ -31,7 +31,7 @@ vec2 getVertexUV() {
     }
 #endif
 
-#if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+#if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
     int getInstanceId() {
         return _in_data.instance_id;
     }
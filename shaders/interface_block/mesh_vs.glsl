@@ -8,7 +8,7 @@ out _vertex_data {
     vec3 world_position;
     vec2 uv;
 
-    #if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+    #if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
         flat int instance_id;
     #endif
 } _out_data;
@@ -80,7 +80,7 @@ void InterfaceBlockPassThrough(vec3 world_position, vec2 uv, mat4 model_transfor
         _out_data.world_position = world_position;
         _out_data.uv = uv;
 
-        #if defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+        #if defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
            _out_data.instance_id = gl_InstanceID;
         #endif
     #endif
@@ -6,6 +6,7 @@
 
 #include "./scene_lighting.glsl"
 #include "./shadows.glsl"
+#include "./local_shadows.glsl"
 
 vec3 computeLight(const ShadingContext sctx, const LightingContext lctx, const Light light) {
     /* [forward pipeline] */
@@ -69,6 +70,14 @@ vec3 computeLights(const ShadingContext sctx) {
             continue;
         }
 
+        #if defined (ENGINE_SETTINGS_LOCAL_SHADOWS)
+            lctx.visibility *= (1.0 - getLocalShadow(light, sctx.N, sctx.worldPos));
+
+            if (lctx.visibility <= 0.0) {
+                continue;
+            }
+        #endif
+
         color += computeLight(sctx, lctx, light);
     }
 
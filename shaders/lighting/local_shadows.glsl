@@ -0,0 +1,88 @@
+#if defined (ENGINE_SETTINGS_LOCAL_SHADOWS)
+    #include "./light.glsl"
+
+    /*
+        light.position.w contains index of shadow data, negative if light does not cast shadow
+
+        Spot light uses view 0, Point light uses 6 cube faces in +X, -X, +Y, -Y, +Z, -Z order
+        region.xy is uv offset in atlas, region.zw is uv size, zero size means view is not rendered yet
+    */
+    struct LocalShadow {
+        mat4 light_space[6];
+        vec4 regions[6];
+    };
+
+    layout (std140) buffer local_shadows {
+        LocalShadow _local_shadows[];
+    };
+
+    uniform sampler2D _local_shadow_atlas;
+
+    uint getLocalShadowView(const Light light, vec3 world_pos) {
+        if (light.type != LIGHT_TYPE_POINT) {
+            return 0u;
+        }
+
+        vec3 d = world_pos - light.position.xyz;
+        vec3 a = abs(d);
+
+        if (a.x >= a.y && a.x >= a.z) {
+            return d.x > 0.0 ? 0u : 1u;
+        }
+
+        if (a.y >= a.z) {
+            return d.y > 0.0 ? 2u : 3u;
+        }
+
+        return d.z > 0.0 ? 4u : 5u;
+    }
+
+    float getLocalShadow(const Light light, vec3 normal, vec3 world_pos) {
+        int index = int(light.position.w);
+        if (index < 0) {
+            return 0.0;
+        }
+
+        uint view = getLocalShadowView(light, world_pos);
+        vec4 region = _local_shadows[index].regions[view];
+        if (region.z <= 0.0) {
+            return 0.0;
+        }
+
+        const float NORMAL_BIAS = 0.02;
+        const float DEPTH_BIAS = 0.0002;
+        world_pos += normal * NORMAL_BIAS;
+
+        vec4 light_pos_space = _local_shadows[index].light_space[view] * vec4(world_pos, 1.0);
+        vec3 ndc = light_pos_space.xyz / light_pos_space.w;
+        ndc = ndc * 0.5 + 0.5;
+
+        if (ndc.z > 1.0 || any(lessThan(ndc.xy, vec2(0.0))) || any(greaterThan(ndc.xy, vec2(1.0)))) {
+            return 0.0;
+        }
+
+        // samples are clamped inside region to not bleed into neighbours
+        vec2 texelSize = 1.0 / vec2(textureSize(_local_shadow_atlas, 0));
+        vec2 min_uv = region.xy + texelSize * 1.5;
+        vec2 max_uv = region.xy + region.zw - texelSize * 1.5;
+        vec2 uv = region.xy + ndc.xy * region.zw;
+        float currentDepth = ndc.z - DEPTH_BIAS;
+
+        float shadow = 0.0;
+
+        #if defined (ENGINE_SETTINGS_LOCAL_SHADOWS_PCF)
+            for (int x = -1; x <= 1; ++x) {
+                for (int y = -1; y <= 1; ++y) {
+                    float pcfDepth = texture(_local_shadow_atlas, clamp(uv + vec2(x, y) * texelSize, min_uv, max_uv)).r;
+                    shadow += currentDepth > pcfDepth ? 1.0 : 0.0;
+                }
+            }
+            shadow /= 9.0;
+        #else
+            float closestDepth = texture(_local_shadow_atlas, clamp(uv, min_uv, max_uv)).r;
+            shadow = currentDepth > closestDepth ? 1.0 : 0.0;
+        #endif
+
+        return shadow;
+    }
+#endif
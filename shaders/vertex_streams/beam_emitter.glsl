@@ -1,88 +1,230 @@
-layout (location = 0) in vec4 vertex_position;
+#if defined (ENGINE_SETTINGS_GPU_BEAMS)
+    // ribbons are expanded here from derivative line points, six vertices per segment; see BeamRibbon
+    struct BeamParticle {
+        vec4 color;
+        vec4 subUV;
+        vec4 properties;
+        vec4 acceleration_lifetime;
+        vec4 rotation_time;
+        vec4 velocity_size;
+        vec4 start_length;
+        vec4 end;
+    };
+
+    layout (std430) readonly buffer beam_points {
+        vec4 _beam_points[];
+    };
+
+    // x - first of four points of segment, y - particle index
+    layout (std430) readonly buffer beam_segments {
+        uvec2 _beam_segments[];
+    };
+
+    layout (std430) readonly buffer beam_particles {
+        BeamParticle _beam_particles[];
+    };
+
+    uvec2 getBeamSegment() {
+        return _beam_segments[gl_VertexID / 6];
+    }
 
-vec3 getVertexPosition() {
-    return vertex_position.xyz;
-}
+    BeamParticle getBeamParticle() {
+        return _beam_particles[getBeamSegment().y];
+    }
 
-#if defined(InitialColor_MODULE)
-    layout (location = 1) in vec4 vertex_color;
+    int getBeamCorner() {
+        return gl_VertexID % 6;
+    }
 
-    vec4 getParticleColor() {
-        return vertex_color;
+    // xy - screen position in pixels, z - ndc depth, w - clip w
+    vec4 projectBeamPoint(uint index) {
+        vec4 clip = getViewProjection() * vec4(_beam_points[index].xyz, 1.0);
+        return vec4((clip.xy / clip.w + 1.0) * 0.5 * getResolution(), clip.z / clip.w, clip.w);
     }
-#endif
 
-#if defined(SubUV_MODULE)
-    layout(location = 2) in vec4 vertex_subUV;
+    vec3 getVertexPosition() {
+        const vec2 DOT_PRODUCT_RANGE = vec2(0.2, 0.8);
 
-    vec4 getParticleSubUV() {
-        return vertex_subUV;
-    }
-#endif
+        uint first = getBeamSegment().x;
+        int corner = getBeamCorner();
+        bool start = corner == 0 || corner == 1 || corner == 3;
 
-#if defined(CustomMaterial_MODULE)
-    layout(location = 3) in vec4 vertex_properties;
+        vec4 a = projectBeamPoint(first + 1u);
+        vec4 b = projectBeamPoint(first + 2u);
 
-    vec4 getParticleProperties() {
-        return vertex_properties;
-    }
-#endif
+        vec2 v_line = normalize(b.xy - a.xy);
+        vec2 nv_line = vec2(-v_line.y, v_line.x);
 
-#if defined(Lifetime_MODULE) || defined(Acceleration_MODULE)
-    layout(location = 4) in vec4 vertex_acceleration_lifetime;
+        vec2 v_adjacent = start
+            ? normalize(a.xy - projectBeamPoint(first).xy)
+            : normalize(projectBeamPoint(first + 3u).xy - b.xy);
+        vec2 v_miter = normalize(nv_line + vec2(-v_adjacent.y, v_adjacent.x));
+        float d = clamp(dot(v_miter, nv_line), DOT_PRODUCT_RANGE.x, DOT_PRODUCT_RANGE.y);
 
-    vec3 getParticleAcceleration() {
-        return vertex_acceleration_lifetime.xyz;
-    }
+        float side = (corner == 1 || corner == 2 || corner == 4) ? -0.5 : 0.5;
 
-    float getParticleLifetime() {
-        return vertex_acceleration_lifetime.w;
-    }
-#endif
+        vec4 pos = start ? a : b;
+        pos.xy += v_miter * getBeamParticle().velocity_size.w / pos.w * side / d;
 
-#if defined(InitialRotation_MODULE) || defined(Time_MODULE)
-    layout(location = 5) in vec4 vertex_rotation_time;
+        pos.xy = pos.xy / getResolution() * 2.0 - 1.0;
+        pos.xyz *= pos.w;
 
-    vec3 getParticleRotation() {
-        return vertex_rotation_time.xyz;
+        return (getViewProjectionInverse() * pos).xyz;
     }
 
-    float getParticleTime() {
-        return vertex_rotation_time.w;
+    vec2 getVertexUV() {
+        int corner = getBeamCorner();
+        return (corner == 1 || corner == 2 || corner == 4) ? vec2(float(corner != 1), 0.0) : vec2(0.0, 1.0);
     }
-#endif
 
-#if defined(InitialVelocity_MODULE) || defined(InitialSize_MODULE)
-    layout(location = 6) in vec4 vertex_velocity_size;
-
-    vec3 getParticleVelocity() {
-        return vertex_velocity_size.xyz;
+    float getParticleLength() {
+        return getBeamParticle().start_length.w;
     }
 
-    float getParticleSize() {
-        return vertex_velocity_size.w;
+    #if defined(InitialColor_MODULE)
+        vec4 getParticleColor() {
+            return getBeamParticle().color;
+        }
+    #endif
+
+    #if defined(SubUV_MODULE)
+        vec4 getParticleSubUV() {
+            return getBeamParticle().subUV;
+        }
+    #endif
+
+    #if defined(CustomMaterial_MODULE)
+        vec4 getParticleProperties() {
+            return getBeamParticle().properties;
+        }
+    #endif
+
+    #if defined(Lifetime_MODULE) || defined(Acceleration_MODULE)
+        vec3 getParticleAcceleration() {
+            return getBeamParticle().acceleration_lifetime.xyz;
+        }
+
+        float getParticleLifetime() {
+            return getBeamParticle().acceleration_lifetime.w;
+        }
+    #endif
+
+    #if defined(InitialRotation_MODULE) || defined(Time_MODULE)
+        vec3 getParticleRotation() {
+            return getBeamParticle().rotation_time.xyz;
+        }
+
+        float getParticleTime() {
+            return getBeamParticle().rotation_time.w;
+        }
+    #endif
+
+    #if defined(InitialVelocity_MODULE) || defined(InitialSize_MODULE)
+        vec3 getParticleVelocity() {
+            return getBeamParticle().velocity_size.xyz;
+        }
+
+        float getParticleSize() {
+            return getBeamParticle().velocity_size.w;
+        }
+    #endif
+
+    #if defined(BeamSpeed_MODULE)
+        vec3 getParticleStart() {
+            return getBeamParticle().start_length.xyz;
+        }
+
+        vec3 getParticleEnd() {
+            return getBeamParticle().end.xyz;
+        }
+    #endif
+#else
+    layout (location = 0) in vec4 vertex_position;
+
+    vec3 getVertexPosition() {
+        return vertex_position.xyz;
     }
-#endif
 
-layout (location = 7) in vec4 vertex_uv_length;
+    #if defined(InitialColor_MODULE)
+        layout (location = 1) in vec4 vertex_color;
+
+        vec4 getParticleColor() {
+            return vertex_color;
+        }
+    #endif
 
-vec2 getVertexUV() {
-    return vertex_uv_length.xy;
-}
+    #if defined(SubUV_MODULE)
+        layout(location = 2) in vec4 vertex_subUV;
 
-float getParticleLength() {
-    return vertex_uv_length.z;
-}
+        vec4 getParticleSubUV() {
+            return vertex_subUV;
+        }
+    #endif
 
-#if defined(BeamSpeed_MODULE)
-    layout (location = 8) in vec3 vertex_start;
-    layout (location = 9) in vec3 vertex_end;
+    #if defined(CustomMaterial_MODULE)
+        layout(location = 3) in vec4 vertex_properties;
 
-    vec3 getParticleStart() {
-        return vertex_start;
+        vec4 getParticleProperties() {
+            return vertex_properties;
+        }
+    #endif
+
+    #if defined(Lifetime_MODULE) || defined(Acceleration_MODULE)
+        layout(location = 4) in vec4 vertex_acceleration_lifetime;
+
+        vec3 getParticleAcceleration() {
+            return vertex_acceleration_lifetime.xyz;
+        }
+
+        float getParticleLifetime() {
+            return vertex_acceleration_lifetime.w;
+        }
+    #endif
+
+    #if defined(InitialRotation_MODULE) || defined(Time_MODULE)
+        layout(location = 5) in vec4 vertex_rotation_time;
+
+        vec3 getParticleRotation() {
+            return vertex_rotation_time.xyz;
+        }
+
+        float getParticleTime() {
+            return vertex_rotation_time.w;
+        }
+    #endif
+
+    #if defined(InitialVelocity_MODULE) || defined(InitialSize_MODULE)
+        layout(location = 6) in vec4 vertex_velocity_size;
+
+        vec3 getParticleVelocity() {
+            return vertex_velocity_size.xyz;
+        }
+
+        float getParticleSize() {
+            return vertex_velocity_size.w;
+        }
+    #endif
+
+    layout (location = 7) in vec4 vertex_uv_length;
+
+    vec2 getVertexUV() {
+        return vertex_uv_length.xy;
     }
 
-    vec3 getParticleEnd() {
-        return vertex_end;
+    float getParticleLength() {
+        return vertex_uv_length.z;
     }
+
+    #if defined(BeamSpeed_MODULE)
+        layout (location = 8) in vec3 vertex_start;
+        layout (location = 9) in vec3 vertex_end;
+
+        vec3 getParticleStart() {
+            return vertex_start;
+        }
+
+        vec3 getParticleEnd() {
+            return vertex_end;
+        }
+    #endif
 #endif
@@ -37,62 +37,87 @@ vec4 getVertexBoneWeight() {
 }
 #endif
 
+// packed particle, see MeshGpuParticle
 struct MeshParticle {
-    mat4 model;
-    vec4 color;
-    vec4 subUV;
-    vec4 properties;
-    vec4 acceleration_lifetime;
-    vec4 position;
-    vec4 rotation_time;
-    vec4 velocity;
-    vec4 size;
+    vec4 position_time;
+    vec4 rotation_lifetime;
+    // half floats: xy - color; zw - subUV
+    uvec4 color_subUV;
+    // half floats: xy - properties; zw - size
+    uvec4 properties_size;
+    // half floats: xy - velocity; zw - acceleration
+    uvec4 velocity_acceleration;
 };
 
 layout (std430) buffer mesh_emitter_particles {
     MeshParticle _particles[];
 };
 
-mat4 getModelMatrix() {
-    return _particles[gl_InstanceID].model;
+vec4 unpackParticleHalf4(uvec2 value) {
+    return vec4(unpackHalf2x16(value.x), unpackHalf2x16(value.y));
 }
 
 vec4 getParticleColor() {
-    return _particles[gl_InstanceID].color;
+    return unpackParticleHalf4(_particles[gl_InstanceID].color_subUV.xy);
 }
 
 vec4 getParticleSubUV() {
-    return _particles[gl_InstanceID].subUV;
+    return unpackParticleHalf4(_particles[gl_InstanceID].color_subUV.zw);
 }
 
 vec4 getParticleProperties() {
-    return _particles[gl_InstanceID].properties;
+    return unpackParticleHalf4(_particles[gl_InstanceID].properties_size.xy);
 }
 
 vec3 getParticleAcceleration() {
-    return _particles[gl_InstanceID].acceleration_lifetime.xyz;
+    return unpackParticleHalf4(_particles[gl_InstanceID].velocity_acceleration.zw).xyz;
 }
 
 float getParticleLifetime() {
-    return _particles[gl_InstanceID].acceleration_lifetime.w;
+    return _particles[gl_InstanceID].rotation_lifetime.w;
 }
 
 vec3 getParticlePosition() {
-    return _particles[gl_InstanceID].position.xyz;
+    return _particles[gl_InstanceID].position_time.xyz;
 }
 
 vec3 getParticleSize() {
-    return _particles[gl_InstanceID].size.xyz;
+    return unpackParticleHalf4(_particles[gl_InstanceID].properties_size.zw).xyz;
 }
 
 vec3 getParticleRotation() {
-    return _particles[gl_InstanceID].rotation_time.xyz;
+    return _particles[gl_InstanceID].rotation_lifetime.xyz;
 }
 
 float getParticleTime() {
-    return _particles[gl_InstanceID].rotation_time.w;
+    return _particles[gl_InstanceID].position_time.w;
 }
 
 vec3 getParticleVelocity() {
-    return _particles[gl_InstanceID].velocity.xyz;
+    return unpackParticleHalf4(_particles[gl_InstanceID].velocity_acceleration.xy).xyz;
+}
+
+// translation * rotation around x, y, z * scale
+mat4 getModelMatrix() {
+    vec3 r = getParticleRotation();
+    vec3 c = cos(r);
+    vec3 s = sin(r);
+    vec3 size = getParticleSize();
+
+    mat3 rotation_x = mat3(1.0, 0.0, 0.0,  0.0, c.x, s.x,  0.0, -s.x, c.x);
+    mat3 rotation_y = mat3(c.y, 0.0, -s.y,  0.0, 1.0, 0.0,  s.y, 0.0, c.y);
+    mat3 rotation_z = mat3(c.z, s.z, 0.0,  -s.z, c.z, 0.0,  0.0, 0.0, 1.0);
+
+    mat3 rotation_scale = rotation_x * rotation_y * rotation_z * mat3(
+        size.x, 0.0, 0.0,
+        0.0, size.y, 0.0,
+        0.0, 0.0, size.z
+    );
+
+    return mat4(
+        vec4(rotation_scale[0], 0.0),
+        vec4(rotation_scale[1], 0.0),
+        vec4(rotation_scale[2], 0.0),
+        vec4(getParticlePosition(), 1.0)
+    );
 }
@@ -1,4 +1,4 @@
-#if defined (ENGINE_MATERIAL_REGULAR_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_DECAL_MODEL) || defined (ENGINE_MATERIAL_INSTANCED_MODEL)
+#if defined (ENGINE_MATERIAL_REGULAR_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_DECAL_MODEL) || defined (ENGINE_MATERIAL_INSTANCED_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
     layout (location = 0) in vec3 _vertex_position;
     layout (location = 1) in vec3 _vertex_normal;
 
@@ -8,7 +8,7 @@
 
     layout (location = 3) in vec2 _vertex_uv;
 
-    #if defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+    #if defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
         layout (location = 4) in ivec4 _vertex_bone_id;
         layout (location = 5) in vec4 _vertex_bone_weight;
     #endif
@@ -21,11 +21,37 @@
     layout (location = 3) in vec2 _vertex_uv;
 #endif
 
+// vertices skinned once per frame by compute pass
+#if defined (ENGINE_SETTINGS_COMPUTE_SKINNING) && defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+    struct SkinnedVertex {
+        vec4 position;
+        vec4 normal;
+        vec4 tangent;
+    };
+
+    layout (std430) readonly buffer skinned_vertex_buffer {
+        SkinnedVertex _skinned_vertices[];
+    };
+
+    // instances culled from skinning are skinned by vertex shader
+    uniform uint _compute_skinned;
+#endif
+
 vec3 getVertexPosition() {
+#if defined (ENGINE_SETTINGS_COMPUTE_SKINNING) && defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+    if (_compute_skinned != 0u) {
+        return _skinned_vertices[gl_VertexID].position.xyz;
+    }
+#endif
     return _vertex_position;
 }
 
 vec3 getVertexNormal() {
+#if defined (ENGINE_SETTINGS_COMPUTE_SKINNING) && defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+    if (_compute_skinned != 0u) {
+        return _skinned_vertices[gl_VertexID].normal.xyz;
+    }
+#endif
     return _vertex_normal;
 }
 
@@ -35,11 +61,16 @@ vec2 getVertexUV() {
 
 #if defined (ENGINE_MATERIAL_NORMAL_TEXTURE) && defined (ENGINE_SETTINGS_NORMAL_MAPPING)
     vec3 getVertexTangent() {
+    #if defined (ENGINE_SETTINGS_COMPUTE_SKINNING) && defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+        if (_compute_skinned != 0u) {
+            return _skinned_vertices[gl_VertexID].tangent.xyz;
+        }
+    #endif
         return _vertex_tangent;
     }
 #endif
 
-#if defined (ENGINE_MATERIAL_SKELETAL_MODEL)
+#if defined (ENGINE_MATERIAL_SKELETAL_MODEL) || defined (ENGINE_MATERIAL_SKELETAL_INSTANCED_MODEL)
     ivec4 getVertexBoneID() {
         return _vertex_bone_id;
     }
@@ -0,0 +1,117 @@
+#include <limitless/fx/beam_ribbon.hpp>
+
+#include <limitless/camera.hpp>
+
+using namespace Limitless::fx;
+
+namespace {
+    constexpr auto DOT_PRODUCT_RANGE = glm::vec2(0.2f, 0.8f);
+
+    // xy - screen position in pixels, z - ndc depth, w - clip w
+    glm::vec4 project(const glm::mat4& VP, const glm::vec2& resolution, const glm::vec3& point) noexcept {
+        auto clip = VP * glm::vec4(point, 1.0f);
+        const auto screen = (glm::vec2(clip) / clip.w + 1.0f) * 0.5f * resolution;
+        return {screen.x, screen.y, clip.z / clip.w, clip.w};
+    }
+
+    glm::vec2 perpendicular(const glm::vec2& v) noexcept {
+        return {-v.y, v.x};
+    }
+
+    // miter direction scaled so ribbon keeps its width at joint
+    glm::vec2 miter(const glm::vec2& normal, const glm::vec2& adjacent) noexcept {
+        const auto direction = glm::normalize(normal + perpendicular(adjacent));
+        const auto dot = glm::clamp(glm::dot(direction, normal), DOT_PRODUCT_RANGE.x, DOT_PRODUCT_RANGE.y);
+        return direction / dot;
+    }
+}
+
+BeamRibbon::View BeamRibbon::makeView(const Camera& camera, glm::vec2 resolution) noexcept {
+    const auto VP = camera.getProjection() * camera.getView();
+    return { VP, glm::inverse(VP), resolution };
+}
+
+size_t BeamRibbon::getSegmentCount(const BeamParticle& particle) noexcept {
+    const auto size = particle.derivative_line.size();
+    return size > 3 ? size - 3 : 0;
+}
+
+void BeamRibbon::expand(const BeamParticle& particle, const View& view, BeamParticleMapping* vertices) noexcept {
+    // corners of two triangles: anchor point of segment, side of ribbon and uv
+    static constexpr struct {
+        uint32_t point;
+        float side;
+        glm::vec2 uv;
+    } CORNERS[SEGMENT_VERTEX_COUNT] = {
+        {1, 0.5f, {0.0f, 1.0f}},
+        {1, -0.5f, {0.0f, 0.0f}},
+        {2, -0.5f, {1.0f, 0.0f}},
+        {1, 0.5f, {0.0f, 1.0f}},
+        {2, -0.5f, {1.0f, 0.0f}},
+        {2, 0.5f, {0.0f, 1.0f}},
+    };
+
+    BeamParticleMapping vertex;
+    vertex.size = particle.size;
+    vertex.color = particle.color;
+    vertex.subUV = particle.subUV;
+    vertex.properties = particle.properties;
+    vertex.acceleration = particle.acceleration;
+    vertex.lifetime = particle.lifetime;
+    vertex.rotation = particle.rotation;
+    vertex.time = particle.time;
+    vertex.velocity = particle.velocity;
+    vertex.length = particle.length;
+    vertex.start = particle.position;
+    vertex.end = particle.target;
+
+    const auto& line = particle.derivative_line;
+    const auto segments = getSegmentCount(particle);
+
+    // every point is projected once and reused by segments it belongs to
+    glm::vec4 projected[4];
+    for (size_t k = 0; k < 3 && k < line.size(); ++k) {
+        projected[k + 1] = project(view.VP, view.resolution, line[k]);
+    }
+
+    for (size_t segment = 0; segment < segments; ++segment) {
+        projected[0] = projected[1];
+        projected[1] = projected[2];
+        projected[2] = projected[3];
+        projected[3] = project(view.VP, view.resolution, line[segment + 3]);
+
+        const auto direction = glm::normalize(glm::vec2(projected[2]) - glm::vec2(projected[1]));
+        const auto normal = perpendicular(direction);
+
+        const glm::vec2 miters[] = {
+            {},
+            miter(normal, glm::normalize(glm::vec2(projected[1]) - glm::vec2(projected[0]))),
+            miter(normal, glm::normalize(glm::vec2(projected[3]) - glm::vec2(projected[2]))),
+        };
+
+        for (const auto& corner : CORNERS) {
+            auto position = projected[corner.point];
+            const auto offset = miters[corner.point] * particle.size / position.w * corner.side;
+
+            // back to clip space and then to world space
+            const auto ndc = (glm::vec2(position) + offset) / view.resolution * 2.0f - 1.0f;
+            position = glm::vec4(ndc.x * position.w, ndc.y * position.w, position.z * position.w, position.w);
+
+            vertex.position = view.VP_inverse * position;
+            vertex.uv = corner.uv;
+
+            *vertices++ = vertex;
+        }
+    }
+}
+
+BeamGpuParticle::BeamGpuParticle(const BeamParticle& particle) noexcept
+    : color {particle.color}
+    , subUV {particle.subUV}
+    , properties {particle.properties}
+    , acceleration {particle.acceleration, particle.lifetime}
+    , rotation {particle.rotation, particle.time}
+    , velocity {particle.velocity, particle.size}
+    , start {particle.position, particle.length}
+    , end {particle.target, 0.0f} {
+}
@@ -73,6 +73,16 @@ EffectBuilder& EffectBuilder::setDuration(std::chrono::duration<float> duration)
     return *this;
 }
 
+EffectBuilder& EffectBuilder::setFixedBounds(const std::optional<Box>& bounds) {
+    effect->emitters.at(last_emitter)->getFixedBounds() = bounds;
+    return *this;
+}
+
+EffectBuilder& EffectBuilder::setLod(const std::optional<EmitterLod>& lod) {
+    effect->emitters.at(last_emitter)->getLod() = lod;
+    return *this;
+}
+
 EffectBuilder& EffectBuilder::setMaterial(std::shared_ptr<ms::Material> material) {
     if (!material) {
         throw std::runtime_error{"Cannot set empty material for emitter!"};
@@ -7,6 +7,7 @@
 #include <limitless/instances/effect_instance.hpp>
 #include <limitless/assets.hpp>
 #include <limitless/fx/effect_shader_define_replacer.hpp>
+#include <limitless/fx/sprite_gpu_simulation.hpp>
 
 using namespace Limitless::fx;
 using namespace Limitless;
@@ -26,12 +27,30 @@ void EffectCompiler::compile(ShaderType shader_type, const T& emitter) {
     }
 }
 
+void EffectCompiler::compileSimulation(const SpriteEmitter& emitter) {
+    if (!render_settings || !render_settings->gpu_particles || !emitter.isGpuSimulationSupported()) {
+        return;
+    }
+
+    const auto name = SpriteGpuSimulation::getShaderName(emitter);
+    if (assets.shaders.contains(name)) {
+        return;
+    }
+
+    const auto props = [&] (Shader& shader) {
+        EffectShaderDefineReplacer::replaceEmitterDefine(shader, emitter);
+    };
+
+    assets.shaders.add(name, compile(assets.getShaderDir() / "pipeline/sprite_simulation", props));
+}
+
 void EffectCompiler::compile(const EffectInstance& instance, ShaderType shader_type) {
 	try {
 		for (const auto& [name, emitter] : instance.getEmitters()) {
 			switch (emitter->getType()) {
 				case fx::AbstractEmitter::Type::Sprite:
 					compile(shader_type, instance.get<fx::SpriteEmitter>(name));
+					compileSimulation(instance.get<fx::SpriteEmitter>(name));
 					break;
 				case fx::AbstractEmitter::Type::Mesh:
 					compile(shader_type, instance.get<fx::MeshEmitter>(name));
@@ -6,63 +6,71 @@
 #include <limitless/core/context.hpp>
 #include "limitless/core/uniform/uniform_setter.hpp"
 #include <limitless/fx/emitters/emitter_visitor.hpp>
-#include <limitless/fx/emitters/visitor_creator.hpp>
+#include <limitless/fx/emitters/visitor_collector.hpp>
 
-using namespace Limitless::fx;
+#include <algorithm>
 
-void EffectRenderer::visitEmitters(const Instances& instances, EmitterVisitor& emitter_visitor) noexcept {
-    auto effect_instance_visitor = [] (const EffectInstance& effect_instance, EmitterVisitor& visitor) {
-        for (const auto& [name, emitter] : effect_instance.getEmitters()) {
-            emitter->accept(visitor);
-        }
-    };
+using namespace Limitless::fx;
 
-    std::function<void(const Instance& instance)> visitor = [&] (const Instance& instance) {
-        for (const auto& [_, attachment] : instance.getAttachments()) {
-            visitor(*attachment);
-        }
+void EffectRenderer::visitEmitters(const Instance& instance, EmitterVisitor& visitor) noexcept {
+    for (const auto& [_, attachment] : instance.getAttachments()) {
+        visitEmitters(*attachment, visitor);
+    }
 
-        if (instance.getInstanceType() == InstanceType::Effect) {
-            effect_instance_visitor(static_cast<const EffectInstance&>(instance), emitter_visitor);
+    if (instance.getInstanceType() == InstanceType::Effect) {
+        for (const auto& [name, emitter] : static_cast<const EffectInstance&>(instance).getEmitters()) { //NOLINT
+            // emitters out of view are skipped even when rest of effect is visible
+            if (!emitter->isCulled()) {
+                emitter->accept(visitor);
+            }
         }
-    };
-
-    for (const auto& instance : instances) {
-        visitor(*instance);
     }
 }
 
-void EffectRenderer::updateRenderers(const Instances& instances) noexcept {
-    EmitterRendererCreator creator {renderers};
-    visitEmitters(instances, creator);
-}
-
-void EffectRenderer::update(const Instances& instances) {
-    updateRenderers(instances);
-
+void EffectRenderer::beginRenderers(const BeamRibbon::View& beam_view, bool gpu_beams) {
     for (const auto& [type, renderer] : renderers) {
-        type.material->update();
         switch (type.emitter_type) {
-            case AbstractEmitter::Type::Sprite: {
-                ParticleCollector<SpriteParticle> collector {type};
-                visitEmitters(instances, collector);
-                static_cast<EmitterRenderer<SpriteParticle>&>(*renderer).update(collector);
+            case AbstractEmitter::Type::Sprite:
+                static_cast<EmitterRenderer<SpriteParticle>&>(*renderer).begin();
                 break;
-            }
-            case AbstractEmitter::Type::Mesh: {
-                ParticleCollector<MeshParticle> collector {type};
-                visitEmitters(instances, collector);
-                static_cast<EmitterRenderer<MeshParticle>&>(*renderer).update(collector);
+            case AbstractEmitter::Type::Mesh:
+                static_cast<EmitterRenderer<MeshParticle>&>(*renderer).begin();
                 break;
-            }
-            case AbstractEmitter::Type::Beam: {
-                ParticleCollector<BeamParticleMapping> collector {type};
-                visitEmitters(instances, collector);
-                static_cast<EmitterRenderer<BeamParticle>&>(*renderer).update(collector);
+            case AbstractEmitter::Type::Beam:
+                static_cast<EmitterRenderer<BeamParticle>&>(*renderer).begin(beam_view, gpu_beams);
                 break;
-            }
         }
+    }
+}
+
+void EffectRenderer::update(const Instances& instances, const Camera& camera, glm::uvec2 resolution, bool gpu_beams) {
+    const auto beam_view = BeamRibbon::makeView(camera, resolution);
+
+    beginRenderers(beam_view, gpu_beams);
+
+    // particles are appended to renderers of their type in one pass over emitters
+    ParticleCollector collector {renderers, beam_view, gpu_beams};
+    for (const auto& instance : instances) {
+        visitEmitters(*instance, collector);
+    }
+
+    // streams grow only when frame does not fit them, then particles are collected once more
+    const auto overflowed = std::any_of(renderers.begin(), renderers.end(), [] (const auto& renderer) {
+        return renderer.second->overflowed();
+    });
+
+    if (overflowed) {
+        for (const auto& [type, renderer] : renderers) {
+            renderer->restart();
+        }
+
+        for (const auto& instance : instances) {
+            visitEmitters(*instance, collector);
+        }
+    }
 
+    for (const auto& [type, renderer] : renderers) {
+        type.material->update();
     }
 }
 
@@ -109,3 +109,7 @@ void EffectShaderDefineReplacer::replaceMaterialDependentDefine(Shader& shader,
     shader.replaceKey(SNIPPET_DEFINE[SnippetDefineType::CustomSamplers], getSamplerUniformDefines(material));
     shader.replaceKey(SNIPPET_DEFINE[SnippetDefineType::CustomShading], material.getShadingSnippet());
 }
+
+void EffectShaderDefineReplacer::replaceEmitterDefine(Shader& shader, const AbstractEmitter& emitter) {
+    shader.replaceKey(DEFINE_NAMES.at(Define::MaterialDependent), getEmitterDefines(emitter));
+}
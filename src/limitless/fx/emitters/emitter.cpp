@@ -14,17 +14,22 @@ Emitter<P>::Emitter(Type _type)
 
 template<typename P>
 void Emitter<P>::emit(uint32_t count) noexcept {
-    for (uint32_t i = 0; i < count; ++i) {
-        P particle {};
+    if (count == 0) {
+        return;
+    }
 
-        particle.position = local_position + position;
-        particle.rotation = glm::eulerAngles(rotation * local_rotation);
+    P particle {};
+    particle.position = local_position + position;
+    particle.rotation = glm::eulerAngles(rotation * local_rotation);
 
-        for (auto& module : modules) {
-            module->initialize(*this, particle, particles.size());
-        }
+    // modules initialize whole batch of new particles one after another
+    const auto first = particles.size();
+    particles.resize(first + count, particle);
 
-        particles.emplace_back(particle);
+    for (auto& module : modules) {
+        if (!isDropped(*module)) {
+            module->initializeBatch(*this, particles.data() + first, first, count);
+        }
     }
 }
 
@@ -48,6 +53,43 @@ void Emitter<P>::ressurect() noexcept {
     done = false;
 }
 
+template<typename P>
+void Emitter<P>::reset() {
+    particles.clear();
+    dead_indices.clear();
+
+    for (auto& module : modules) {
+        module->reset();
+    }
+
+    spawn.last_spawn = {};
+    if (spawn.burst) {
+        spawn.burst->loops_done = 0;
+    }
+
+    start_time = {};
+    last_time = {};
+    done = false;
+
+    bounds = std::nullopt;
+    suspended = false;
+    catch_up = {};
+    culled = false;
+    lod_level = {};
+}
+
+template<typename P>
+bool Emitter<P>::isDropped(const Module<P>& module) const noexcept {
+    switch (module.getType()) {
+        // particles never die or lose their per particle data without them
+        case ModuleType::Lifetime:
+        case ModuleType::MeshLocationAttachment:
+            return false;
+        default:
+            return lod_level.isDropped(module.getType());
+    }
+}
+
 template<typename P>
 bool& Emitter<P>::getLocalSpace() noexcept {
     return local_space;
@@ -73,6 +115,16 @@ std::chrono::duration<float>& Emitter<P>::getDuration() noexcept {
     return duration;
 }
 
+template<typename P>
+std::optional<Limitless::Box>& Emitter<P>::getFixedBounds() noexcept {
+    return fixed_bounds;
+}
+
+template<typename P>
+std::optional<EmitterLod>& Emitter<P>::getLod() noexcept {
+    return lod;
+}
+
 template<typename P>
 bool Emitter<P>::isDone() const noexcept {
     return done;
@@ -103,18 +155,41 @@ const std::chrono::duration<float>& Emitter<P>::getDuration() const noexcept {
     return duration;
 }
 
+template<typename P>
+const std::optional<Limitless::Box>& Emitter<P>::getFixedBounds() const noexcept {
+    return fixed_bounds;
+}
+
+template<typename P>
+const std::optional<EmitterLod>& Emitter<P>::getLod() const noexcept {
+    return lod;
+}
+
 template<typename P>
 void Emitter<P>::setPosition(const glm::vec3& new_position) noexcept {
-    if (local_space) {
-        const auto final_position = new_position + local_position;
-        const auto diff = final_position - (position + local_position);
+    const auto diff = new_position - position;
 
+    if (local_space) {
         for (auto& particle : particles) {
             particle.position += diff;
         }
     }
 
     position = new_position;
+
+    // suspended emitters are not updated, so their bounds follow origin here to be culled where emitter is now
+    if (bounds && diff != glm::vec3{0.0f}) {
+        const auto origin = position + local_position;
+
+        if (fixed_bounds) {
+            bounds = Box {origin + fixed_bounds->center, fixed_bounds->size};
+        } else if (local_space) {
+            bounds->center += diff;
+        } else {
+            // particles stay where they are, new ones spawn at origin
+            bounds = mergeBoundingBox(*bounds, Box {origin, glm::vec3{0.0f}});
+        }
+    }
 }
 
 template<typename P>
@@ -135,10 +210,16 @@ void Emitter<P>::setRotation(const glm::quat& new_rotation) noexcept {
 }
 
 template<typename P>
-void Emitter<P>::spawnParticles() noexcept {
+void Emitter<P>::spawnParticles(std::chrono::time_point<std::chrono::steady_clock> current_time) noexcept {
     using namespace std::chrono;
 
-    if (spawn.spawn_rate <= 0.0f) {
+    // level of detail scales spray rate and burst size
+    const auto spawn_scale = lod_level.spawn_rate;
+    const auto max_count = static_cast<size_t>(static_cast<float>(spawn.max_count) * lod_level.max_count);
+    const auto alive = getAliveCount();
+    const auto remaining = alive < max_count ? max_count - alive : 0;
+
+    if (spawn.spawn_rate <= 0.0f || spawn_scale <= 0.0f) {
         return;
     }
 
@@ -146,7 +227,6 @@ void Emitter<P>::spawnParticles() noexcept {
         return spawn.last_spawn == time_point<steady_clock>();
     };
 
-    const auto current_time = steady_clock::now();
     if (isFirst()) {
         spawn.last_spawn = current_time;
     }
@@ -154,10 +234,10 @@ void Emitter<P>::spawnParticles() noexcept {
 
     switch (spawn.mode) {
         case EmitterSpawn::Mode::Spray: {
-            if (delta >= (1.0f / spawn.spawn_rate) || isFirst()) {
-                const auto remaining = spawn.max_count - particles.size();
+            const auto spawn_rate = spawn.spawn_rate * spawn_scale;
+            if (delta >= (1.0f / spawn_rate) || isFirst()) {
                 if (remaining > 0) {
-                    emit(glm::clamp(static_cast<size_t>(delta * spawn.spawn_rate), static_cast<size_t>(1), remaining));
+                    emit(glm::clamp(static_cast<size_t>(delta * spawn_rate), static_cast<size_t>(1), remaining));
                 }
                 spawn.last_spawn = current_time;
             }
@@ -166,9 +246,12 @@ void Emitter<P>::spawnParticles() noexcept {
         case EmitterSpawn::Mode::Burst:
             if (spawn.burst->loops != spawn.burst->loops_done) {
                 if (delta >= (1.0f / spawn.spawn_rate) || isFirst()) {
-                    auto emit_count = spawn.burst->burst_count->get();
-                    emit_count = (particles.size() + emit_count > spawn.max_count) ? spawn.max_count - particles.size() : emit_count;
-                    emit(emit_count);
+                    const auto burst_count = std::min(static_cast<size_t>(static_cast<float>(spawn.burst->burst_count->get()) * spawn_scale), remaining);
+
+                    // burst scaled down to nothing still counts as one of its loops
+                    if (burst_count > 0) {
+                        emit(burst_count);
+                    }
 
                     if (spawn.burst->loops != -1) {
                         ++spawn.burst->loops_done;
@@ -183,60 +266,144 @@ void Emitter<P>::spawnParticles() noexcept {
 
 template<typename P>
 void Emitter<P>::killParticles() noexcept {
-    std::vector<size_t> indices;
+    dead_indices.clear();
     for (size_t i = 0; i < particles.size(); ++i) {
         if (particles[i].lifetime <= 0.0f) {
-            indices.emplace_back(i);
+            dead_indices.emplace_back(i);
         }
     }
 
-    for (auto it = particles.begin(); it != particles.end();) {
-        if (it->lifetime <= 0.0f) {
-            it = particles.erase(it);
-        } else {
-            ++it;
-        }
+    if (dead_indices.empty()) {
+        return;
     }
 
+    removeParticles(particles, dead_indices);
+
     for (auto& module : modules) {
-        module->deinitialize(indices);
+        module->deinitialize(dead_indices);
+    }
+}
+
+template<typename P>
+void Emitter<P>::updateParticles(float dt, const Camera& camera, [[maybe_unused]] ThreadPool* pool) {
+    killParticles();
+
+    for (auto& module : modules) {
+        if (!isDropped(*module)) {
+            module->update(*this, particles, dt, camera);
+        }
+    }
+
+    for (auto& particle : particles) {
+        particle.position += particle.velocity * dt;
+        particle.velocity += particle.acceleration * dt;
     }
 }
 
 template<typename P>
 void Emitter<P>::update(const Camera &camera) {
-    using namespace std::chrono;
+    updateEmitter(camera, nullptr);
+}
 
-    const auto current_time = steady_clock::now();
-    const auto delta_time = duration_cast<std::chrono::duration<float>>(current_time - last_time);
+template<typename P>
+void Emitter<P>::update(const Camera& camera, ThreadPool& pool) {
+    updateEmitter(camera, &pool);
+}
+
+template<typename P>
+void Emitter<P>::advance(std::chrono::time_point<std::chrono::steady_clock> current_time, const Camera& camera, ThreadPool* pool) {
+    const auto delta_time = std::chrono::duration_cast<std::chrono::duration<float>>(current_time - last_time);
     last_time = current_time;
 
-	if (start_time == time_point<steady_clock>()) {
-		start_time = current_time;
-	}
+    updateParticles(delta_time.count(), camera, pool);
 
-    killParticles();
+    if (!done) {
+        spawnParticles(current_time);
+    }
+}
 
-    {
-        for (auto& module : modules) {
-            module->update(*this, particles, delta_time.count(), camera);
-        }
+template<typename P>
+void Emitter<P>::catchUp(std::chrono::time_point<std::chrono::steady_clock> current_time, const Camera& camera, ThreadPool* pool) {
+    using namespace std::chrono;
 
-        for (auto& particle : particles) {
-            particle.position += particle.velocity * delta_time.count();
-            particle.velocity += particle.acceleration * delta_time.count();
+    suspended = false;
+
+    // time beyond catch up limit is dropped as if emitter was paused
+    const auto skipped = current_time - last_time;
+    const auto dropped = skipped - std::min(skipped, duration_cast<steady_clock::duration>(catch_up));
+
+    last_time += dropped;
+    if (spawn.last_spawn != time_point<steady_clock>()) {
+        spawn.last_spawn += dropped;
+    }
+
+    const auto step = duration_cast<steady_clock::duration>(CATCH_UP_STEP);
+    for (auto time = last_time + step; time < current_time; time += step) {
+        advance(time, camera, pool);
+    }
+}
+
+template<typename P>
+void Emitter<P>::suspend(std::chrono::duration<float> _catch_up) noexcept {
+    using namespace std::chrono;
+
+    suspended = true;
+    catch_up = _catch_up;
+
+    // suspended effects still end in time
+    if (duration.count() != 0.0f && start_time != time_point<steady_clock>()) {
+        if (steady_clock::now() - start_time >= duration) {
+            done = true;
         }
     }
+}
 
-    if (!done) {
-        spawnParticles();
+template<typename P>
+void Emitter<P>::updateBounds() noexcept {
+    const auto origin = position + local_position;
+
+    if (fixed_bounds) {
+        bounds = Box {origin + fixed_bounds->center, fixed_bounds->size};
+        return;
+    }
+
+    auto min = origin;
+    auto max = origin;
+
+    for (const auto& particle : particles) {
+        const auto [particle_min, particle_max] = getParticleBounds(particle);
+        min = glm::min(min, particle_min);
+        max = glm::max(max, particle_max);
     }
 
+    bounds = Box {(min + max) * 0.5f, max - min};
+}
+
+template<typename P>
+void Emitter<P>::updateEmitter(const Camera& camera, ThreadPool* pool) {
+    using namespace std::chrono;
+
+    const RandomStream::Scope scope {generator};
+
+    const auto current_time = steady_clock::now();
+
+	if (start_time == time_point<steady_clock>()) {
+		start_time = current_time;
+	}
+
+    if (suspended) {
+        catchUp(current_time, camera, pool);
+    }
+
+    advance(current_time, camera, pool);
+
     if (duration.count() != 0.0f) {
         if (current_time - start_time >= duration) {
             done = true;
         }
     }
+
+    updateBounds();
 }
 
 template<typename P>
@@ -254,6 +421,8 @@ Emitter<P>::Emitter(const Emitter& emitter)
     , local_space {emitter.local_space}
     , spawn {emitter.spawn}
     , duration {emitter.duration}
+    , fixed_bounds {emitter.fixed_bounds}
+    , lod {emitter.lod}
     , unique_shader {emitter.unique_shader} {
     // deep modules copy
     for (const auto& module : emitter.modules) {
@@ -4,6 +4,7 @@
 #include <limitless/fx/modules/module.hpp>
 
 #include <limitless/ms/material.hpp>
+#include <limitless/models/abstract_mesh.hpp>
 
 using namespace Limitless::fx;
 
@@ -21,20 +22,26 @@ MeshEmitter* MeshEmitter::clone() const {
     return new MeshEmitter(*this);
 }
 
-void MeshEmitter::update(const Camera &camera) {
-    Emitter::update(camera);
-
-    for (auto& particle : particles) {
-        auto model = glm::translate(glm::mat4(1.0f), particle.position);
+void MeshEmitter::updateBounds() noexcept {
+    if (fixed_bounds || !mesh) {
+        Emitter::updateBounds();
+        return;
+    }
 
-        model = glm::rotate(model, particle.rotation.x, glm::vec3(1.0f, 0.f, 0.f));
-        model = glm::rotate(model, particle.rotation.y, glm::vec3(0.0f, 1.f, 0.f));
-        model = glm::rotate(model, particle.rotation.z, glm::vec3(0.0f, 0.f, 1.f));
+    // particles rotate freely, so mesh is taken as sphere around its origin
+    const auto& box = mesh->getBoundingBox();
+    const auto radius = glm::length(glm::abs(box.center) + box.size * 0.5f);
 
-        model = glm::scale(model, particle.size);
+    auto min = position + local_position;
+    auto max = min;
 
-        particle.model = model;
+    for (const auto& particle : particles) {
+        const auto extent = glm::vec3{radius * glm::max(particle.size.x, glm::max(particle.size.y, particle.size.z))};
+        min = glm::min(min, particle.position - extent);
+        max = glm::max(max, particle.position + extent);
     }
+
+    bounds = Box {(min + max) * 0.5f, max - min};
 }
 
 void MeshEmitter::accept(EmitterVisitor& visitor) noexcept {
@@ -2,6 +2,8 @@
 
 #include <limitless/ms/material.hpp>
 #include <limitless/fx/emitters/emitter_visitor.hpp>
+#include <limitless/fx/modules/modules.hpp>
+#include <limitless/util/thread_pool.hpp>
 
 using namespace Limitless::fx;
 
@@ -25,3 +27,201 @@ void SpriteEmitter::accept(EmitterVisitor& visitor) noexcept {
 UniqueEmitterRenderer SpriteEmitter::getUniqueRendererType() const noexcept {
     return { type, std::nullopt, material };
 }
+
+std::optional<SpriteKernelModules> SpriteEmitter::getKernelModules() const {
+    SpriteKernelModules stages;
+    stages.rotation = rotation * local_rotation;
+
+    for (const auto& module : modules) {
+        if (isDropped(*module)) {
+            continue;
+        }
+
+        switch (module->getType()) {
+            case ModuleType::VelocityByLife:
+                stages.velocity_by_life = static_cast<VelocityByLife<SpriteParticle>&>(*module).getDistribution().get(); //NOLINT
+                break;
+            case ModuleType::ColorByLife:
+                stages.color_by_life = static_cast<ColorByLife<SpriteParticle>&>(*module).getDistribution().get(); //NOLINT
+                break;
+            case ModuleType::RotationRate:
+                stages.rotation_rate = static_cast<RotationRate<SpriteParticle>&>(*module).getDistribution().get(); //NOLINT
+                break;
+            case ModuleType::SizeByLife:
+                stages.size_by_life = static_cast<SizeByLife<SpriteParticle>&>(*module).getDistribution().get(); //NOLINT
+                break;
+            case ModuleType::Time:
+                stages.time = true;
+                break;
+            case ModuleType::Lifetime:
+                stages.lifetime = true;
+                break;
+            case ModuleType::InitialLocation:
+            case ModuleType::InitialRotation:
+            case ModuleType::InitialVelocity:
+            case ModuleType::InitialColor:
+            case ModuleType::InitialSize:
+            case ModuleType::InitialAcceleration:
+            case ModuleType::InitialMeshLocation:
+            case ModuleType::CustomMaterial:
+                // initialization only
+                break;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    return stages;
+}
+
+void SpriteEmitter::updateParticles(float dt, const Camera& camera, ThreadPool* pool) {
+    // simulation is dispatched by renderer, particles spawned meanwhile wait for it
+    if (gpu_simulation) {
+        gpu_dt += dt;
+        return;
+    }
+
+    const auto stages = getKernelModules();
+
+    if (!stages) {
+        // packed particles are kept up to date, so they are simulated by modules from here
+        storage.clear();
+        kernel_update = false;
+
+        Emitter<>::updateParticles(dt, camera, pool);
+        return;
+    }
+
+    // particles spawned since last update are appended to packed ones
+    for (auto i = storage.count(); i < particles.size(); ++i) {
+        storage.push(particles[i]);
+    }
+    kernel_update = true;
+
+    storage.removeDead(dead_indices);
+
+    if (!dead_indices.empty()) {
+        for (auto& module : modules) {
+            module->deinitialize(dead_indices);
+        }
+    }
+
+    // every chunk draws from its own stream derived from emitter one,
+    // so result is the same whether chunks are updated serially or on pool threads
+    const auto count = storage.count();
+    const auto chunks = (count + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+    const auto base = RandomStream::get()();
+
+    const auto update = [&] (size_t chunk) {
+        RandomStream::Engine engine {RandomStream::seed(base, chunk)};
+        const RandomStream::Scope scope {engine};
+
+        const auto begin = chunk * PARALLEL_CHUNK_SIZE;
+        updateSprites(storage, *stages, dt, begin, std::min(begin + PARALLEL_CHUNK_SIZE, count));
+    };
+
+    if (pool) {
+        pool->parallelFor(chunks, update);
+    } else {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            update(chunk);
+        }
+    }
+
+    storage.pack(particles);
+}
+
+void SpriteEmitter::updateBounds() noexcept {
+    if (gpu_simulation && !fixed_bounds) {
+        bounds = std::nullopt;
+        return;
+    }
+
+    Emitter<>::updateBounds();
+}
+
+size_t SpriteEmitter::getAliveCount() const noexcept {
+    return particles.size() + (gpu_simulation ? gpu_simulation->getAliveCount() : 0);
+}
+
+bool SpriteEmitter::isGpuSimulationSupported() const noexcept {
+    // moved particles of local space emitters are not tracked on GPU
+    if (local_space) {
+        return false;
+    }
+
+    for (const auto& module : modules) {
+        switch (module->getType()) {
+            case ModuleType::MeshLocationAttachment:
+            case ModuleType::CustomMaterialByLife:
+                return false;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+void SpriteEmitter::enableGpuSimulation(std::weak_ptr<const void> dispatcher) {
+    gpu_dispatcher = std::move(dispatcher);
+
+    if (gpu_simulation) {
+        return;
+    }
+
+    gpu_simulation = std::make_shared<SpriteGpuSimulation>();
+    gpu_dt = 0.0f;
+
+    storage.clear();
+    kernel_update = false;
+}
+
+void SpriteEmitter::disableGpuSimulation() {
+    if (!gpu_simulation) {
+        return;
+    }
+
+    // particles spawned since last simulation follow simulated ones
+    std::vector<SpriteParticle> simulated;
+    gpu_simulation->readBack(simulated);
+    simulated.insert(simulated.end(), particles.begin(), particles.end());
+    particles = std::move(simulated);
+
+    gpu_simulation.reset();
+    gpu_dispatcher.reset();
+    gpu_dt = 0.0f;
+}
+
+void SpriteEmitter::simulateOnGpu(Context& ctx, ShaderProgram& shader) {
+    gpu_simulation->simulate(ctx, shader, *this, particles, gpu_dt);
+
+    particles.clear();
+    gpu_dt = 0.0f;
+}
+
+void SpriteEmitter::reset() {
+    Emitter<>::reset();
+
+    storage.clear();
+    gpu_dt = 0.0f;
+    if (gpu_simulation) {
+        gpu_simulation->clear();
+    }
+}
+
+void SpriteEmitter::setPosition(const glm::vec3& new_position) noexcept {
+    if (local_space && kernel_update) {
+        storage.translate(new_position - position);
+    }
+
+    Emitter<>::setPosition(new_position);
+}
+
+void SpriteEmitter::setRotation(const glm::quat& new_rotation) noexcept {
+    if (local_space && kernel_update) {
+        storage.rotate((new_rotation * local_rotation) * glm::inverse(rotation * local_rotation));
+    }
+
+    Emitter<>::setRotation(new_rotation);
+}
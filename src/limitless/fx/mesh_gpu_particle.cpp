@@ -0,0 +1,21 @@
+#include <limitless/fx/mesh_gpu_particle.hpp>
+
+using namespace Limitless::fx;
+
+namespace {
+    glm::uvec2 packHalf(const glm::vec4& value) noexcept {
+        return { glm::packHalf2x16({value.x, value.y}), glm::packHalf2x16({value.z, value.w}) };
+    }
+
+    glm::uvec2 packHalf(const glm::vec3& value) noexcept {
+        return packHalf(glm::vec4{value, 0.0f});
+    }
+}
+
+MeshGpuParticle::MeshGpuParticle(const MeshParticle& particle) noexcept
+    : position {particle.position, particle.time}
+    , rotation {particle.rotation, particle.lifetime}
+    , color {packHalf(particle.color), packHalf(particle.subUV)}
+    , properties {packHalf(particle.properties), packHalf(particle.size)}
+    , velocity {packHalf(particle.velocity), packHalf(particle.acceleration)} {
+}
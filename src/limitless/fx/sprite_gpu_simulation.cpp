@@ -0,0 +1,278 @@
+#include <limitless/fx/sprite_gpu_simulation.hpp>
+
+#include <limitless/fx/emitters/sprite_emitter.hpp>
+#include <limitless/fx/modules/modules.hpp>
+#include <limitless/core/shader/shader_program.hpp>
+#include <limitless/core/buffer/buffer_builder.hpp>
+#include <limitless/core/vertex_array.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/core/sync.hpp>
+
+using namespace Limitless::fx;
+using namespace Limitless;
+
+namespace {
+    template<typename T>
+    std::pair<T, T> getRange(Distribution<T>& distribution) {
+        if (distribution.getType() == DistributionType::Range) {
+            auto& range = static_cast<RangeDistribution<T>&>(distribution); //NOLINT
+            return {range.getMin(), range.getMax()};
+        }
+
+        const auto value = distribution.get();
+        return {value, value};
+    }
+
+    template<typename T>
+    void setRange(ShaderProgram& shader, const std::string& name, Distribution<T>& distribution) {
+        const auto [min, max] = getRange(distribution);
+        shader.setUniform("_" + name + "_min", min);
+        shader.setUniform("_" + name + "_max", max);
+    }
+}
+
+SpriteGpuSimulation::~SpriteGpuSimulation() = default;
+
+void SpriteGpuSimulation::initialize(size_t _capacity) {
+    capacity = _capacity;
+    current = 0;
+
+    const DrawCommand empty {0, 1, 0, 0};
+
+    for (size_t i = 0; i < particles.size(); ++i) {
+        // buffers are vertex buffers for drawing and storage buffers for simulation
+        particles[i] = Buffer::builder()
+            .target(Buffer::Type::Array)
+            .usage(Buffer::Usage::DynamicCopy)
+            .access(Buffer::MutableAccess::None)
+            .data(nullptr)
+            .size(capacity * sizeof(SpriteParticle))
+            .build();
+
+        commands[i] = Buffer::builder()
+            .target(Buffer::Type::IndirectDraw)
+            .usage(Buffer::Usage::DynamicCopy)
+            .access(Buffer::MutableAccess::None)
+            .data(&empty)
+            .size(sizeof(DrawCommand))
+            .build();
+
+        vertex_arrays[i] = std::make_unique<VertexArray>();
+        *vertex_arrays[i] << std::pair<SpriteParticle, const std::shared_ptr<Buffer>&>(SpriteParticle{}, particles[i]);
+    }
+
+    spawned = Buffer::builder()
+        .target(Buffer::Type::ShaderStorage)
+        .usage(Buffer::Usage::DynamicDraw)
+        .access(Buffer::MutableAccess::None)
+        .data(nullptr)
+        .size(capacity * sizeof(SpriteParticle))
+        .build();
+
+    alive_readback = Buffer::builder()
+        .target(Buffer::Type::ShaderStorage)
+        .usage(Buffer::Usage::StreamRead)
+        .access(Buffer::MutableAccess::None)
+        .data(&empty)
+        .size(sizeof(DrawCommand))
+        .build();
+
+    alive_sync.reset();
+    spawned_since_fence = 0;
+    alive = 0;
+}
+
+void SpriteGpuSimulation::fetchAliveCount() {
+    if (!alive_sync || !alive_sync->isDone()) {
+        return;
+    }
+
+    // fence is signaled, so reading does not stall pipeline
+    DrawCommand command {};
+    alive_readback->bindAs(Buffer::Type::ShaderStorage);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(DrawCommand), &command);
+
+    alive = std::min(command.count + spawned_since_fence, capacity);
+    alive_sync.reset();
+}
+
+void SpriteGpuSimulation::fenceAliveCount(uint32_t output) {
+    // previous count is still in flight, one of the following updates is going to copy it again
+    if (alive_sync) {
+        return;
+    }
+
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, commands[output]->getId());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, alive_readback->getId());
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, sizeof(DrawCommand));
+
+    alive_sync = std::make_unique<Sync>();
+    alive_sync->place();
+    spawned_since_fence = 0;
+}
+
+void SpriteGpuSimulation::setModuleUniforms(ShaderProgram& shader, const SpriteEmitter& emitter, float dt) {
+    for (const auto& module : emitter.getModules()) {
+        switch (module->getType()) {
+            case ModuleType::VelocityByLife:
+                setRange(shader, "velocity_by_life", *static_cast<VelocityByLife<SpriteParticle>&>(*module).getDistribution()); //NOLINT
+                break;
+            case ModuleType::ColorByLife:
+                setRange(shader, "color_by_life", *static_cast<ColorByLife<SpriteParticle>&>(*module).getDistribution()); //NOLINT
+                break;
+            case ModuleType::RotationRate:
+                setRange(shader, "rotation_rate", *static_cast<RotationRate<SpriteParticle>&>(*module).getDistribution()); //NOLINT
+                break;
+            case ModuleType::SizeByLife:
+                setRange(shader, "size_by_life", *static_cast<SizeByLife<SpriteParticle>&>(*module).getDistribution()); //NOLINT
+                break;
+            case ModuleType::SubUV: {
+                const auto& subuv = static_cast<SubUV<SpriteParticle>&>(*module); //NOLINT
+                const auto& texture_size = subuv.getTextureSize();
+                const auto& frame_count = subuv.getFrameCount();
+
+                // the same frame grid as SubUV module builds
+                const auto width = static_cast<float>(static_cast<uint32_t>(texture_size.x / frame_count.x));
+                const auto height = static_cast<float>(static_cast<uint32_t>(texture_size.y / frame_count.y));
+
+                // frames are switched with module fps regardless of update rate
+                uint32_t advance {};
+                if (subuv.getFPS() > 0.0f) {
+                    subuv_time += dt;
+                    advance = static_cast<uint32_t>(subuv_time * subuv.getFPS());
+                    subuv_time -= static_cast<float>(advance) / subuv.getFPS();
+                }
+
+                shader.setUniform("_subuv_factor", glm::vec2(width / texture_size.x, height / texture_size.y));
+                shader.setUniform("_subuv_frame_count", frame_count);
+                shader.setUniform("_subuv_advance", advance);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+void SpriteGpuSimulation::simulate(Context& ctx, ShaderProgram& shader, const SpriteEmitter& emitter, const std::vector<SpriteParticle>& spawned_particles, float dt) {
+    const auto max_count = std::max<size_t>(emitter.getSpawn().max_count, 1);
+    if (capacity != max_count) {
+        initialize(max_count);
+    }
+
+    fetchAliveCount();
+
+    const auto spawn_count = std::min(spawned_particles.size(), capacity);
+    spawned_since_fence += spawn_count;
+    alive = std::min(alive + spawn_count, capacity);
+
+    if (spawn_count != 0) {
+        spawned->bufferSubData(0, spawn_count * sizeof(SpriteParticle), spawned_particles.data());
+    }
+
+    const auto input = current;
+    const auto output = 1 - current;
+
+    const DrawCommand empty {0, 1, 0, 0};
+    commands[output]->bufferSubData(0, sizeof(DrawCommand), &empty);
+
+    auto& buffers = ctx.getIndexedBuffers();
+    particles[input]->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "particle_input_buffer"));
+    commands[input]->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "particle_input_command"));
+    spawned->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "particle_spawn_buffer"));
+    particles[output]->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "particle_output_buffer"));
+    commands[output]->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "particle_output_command"));
+
+    const auto rotation = emitter.getRotation() * emitter.getLocalRotation();
+
+    shader.setUniform("_spawn_count", static_cast<uint32_t>(spawn_count));
+    shader.setUniform("_capacity", static_cast<uint32_t>(capacity));
+    shader.setUniform("_seed", seed++);
+    shader.setUniform("_dt", dt);
+    shader.setUniform("_rotation", glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w));
+
+    setModuleUniforms(shader, emitter, dt);
+
+    // alive count is known only on GPU, so every slot that may hold particle is dispatched
+    shader.setUniform("_spawn_pass", 0u);
+    shader.use();
+    glDispatchCompute(static_cast<uint32_t>((capacity + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE), 1, 1);
+
+    // survivors take their slots before any spawned particle is appended
+    if (spawn_count != 0) {
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+        shader.setUniform("_spawn_pass", 1u);
+        shader.use();
+        glDispatchCompute(static_cast<uint32_t>((spawn_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE), 1, 1);
+    }
+
+    fenceAliveCount(output);
+
+    current = output;
+}
+
+void SpriteGpuSimulation::readBack(std::vector<SpriteParticle>& out) const {
+    if (capacity == 0) {
+        return;
+    }
+
+    // simulation writes both buffers through shader storage
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    DrawCommand command {};
+    commands[current]->bindAs(Buffer::Type::ShaderStorage);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(DrawCommand), &command);
+
+    const auto count = std::min<size_t>(command.count, capacity);
+    if (count == 0) {
+        return;
+    }
+
+    const auto offset = out.size();
+    out.resize(offset + count);
+
+    particles[current]->bindAs(Buffer::Type::ShaderStorage);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(count * sizeof(SpriteParticle)), out.data() + offset);
+}
+
+void SpriteGpuSimulation::clear() {
+    if (capacity == 0) {
+        return;
+    }
+
+    const DrawCommand empty {0, 1, 0, 0};
+    for (const auto& command : commands) {
+        command->bufferSubData(0, sizeof(DrawCommand), &empty);
+    }
+
+    // count in flight belongs to dropped particles
+    alive_sync.reset();
+    spawned_since_fence = 0;
+    alive = 0;
+
+    subuv_time = 0.0f;
+}
+
+void SpriteGpuSimulation::draw() const {
+    if (!vertex_arrays[current]) {
+        return;
+    }
+
+    vertex_arrays[current]->bind();
+    commands[current]->bindAs(Buffer::Type::IndirectDraw);
+
+    glDrawArraysIndirect(GL_POINTS, nullptr);
+}
+
+std::string SpriteGpuSimulation::getShaderName(const SpriteEmitter& emitter) {
+    std::string name = "sprite_simulation";
+
+    for (const auto& type : emitter.getUniqueShaderType().module_type) {
+        name += "_" + std::to_string(static_cast<int>(type));
+    }
+
+    return name;
+}
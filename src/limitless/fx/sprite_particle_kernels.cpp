@@ -0,0 +1,164 @@
+#include <limitless/fx/sprite_particle_kernels.hpp>
+
+#include <algorithm>
+#include <array>
+
+using namespace Limitless::fx;
+
+void kernels::approach(float* value, const float* lifetime, float target, float dt, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value[i] += (target - value[i]) / (lifetime[i] / dt);
+    }
+}
+
+void kernels::approach(float* value, const float* lifetime, const float* target, float dt, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value[i] += (target[i] - value[i]) / (lifetime[i] / dt);
+    }
+}
+
+void kernels::clampMin(float* value, float min, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value[i] = std::max(value[i], min);
+    }
+}
+
+void kernels::add(float* value, float delta, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value[i] += delta;
+    }
+}
+
+void kernels::addScaled(float* value, const float* rate, float scale, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value[i] += rate[i] * scale;
+    }
+}
+
+void kernels::integrate(float* position, float* velocity, const float* acceleration, float dt, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        position[i] += velocity[i] * dt;
+        velocity[i] += acceleration[i] * dt;
+    }
+}
+
+namespace {
+    constexpr size_t BLOCK_SIZE = 256;
+
+    template<typename T>
+    constexpr size_t COMPONENTS = sizeof(T) / sizeof(float);
+
+    template<typename T>
+    using Samples = std::array<std::array<float, BLOCK_SIZE>, COMPONENTS<T>>;
+
+    float component(float value, [[maybe_unused]] size_t index) noexcept {
+        return value;
+    }
+
+    template<typename V>
+    float component(const V& value, size_t index) noexcept {
+        return value[static_cast<typename V::length_type>(index)];
+    }
+
+    /**
+     * Samples distribution for every particle of block
+     *
+     * constant distribution is sampled once, in that case false is returned and kernels get scalar target
+     */
+    template<typename T, typename F>
+    bool sample(Limitless::Distribution<T>& distribution, size_t count, F&& transform, Samples<T>& samples, T& constant) {
+        if (distribution.getType() == Limitless::DistributionType::Const) {
+            constant = transform(distribution.get());
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const T value = transform(distribution.get());
+            for (size_t c = 0; c < COMPONENTS<T>; ++c) {
+                samples[c][i] = component(value, c);
+            }
+        }
+
+        return true;
+    }
+
+    template<typename T, typename F>
+    void approach(Limitless::Distribution<T>& distribution, F&& transform, const std::array<float*, COMPONENTS<T>>& values, const float* lifetime, float dt, size_t count) {
+        Samples<T> samples;
+        T constant {};
+
+        const auto sampled = sample(distribution, count, std::forward<F>(transform), samples, constant);
+
+        for (size_t c = 0; c < COMPONENTS<T>; ++c) {
+            if (sampled) {
+                kernels::approach(values[c], lifetime, samples[c].data(), dt, count);
+            } else {
+                kernels::approach(values[c], lifetime, component(constant, c), dt, count);
+            }
+        }
+    }
+
+    void updateBlock(SpriteParticleStorage& s, const SpriteKernelModules& modules, float dt, size_t begin, size_t count) {
+        const auto* lifetime = s.lifetime.data() + begin;
+        const auto identity = [] (const auto& value) { return value; };
+
+        if (modules.velocity_by_life) {
+            approach(*modules.velocity_by_life, [&] (const glm::vec3& v) { return modules.rotation * v; },
+                     {s.velocity.x.data() + begin, s.velocity.y.data() + begin, s.velocity.z.data() + begin},
+                     lifetime, dt, count);
+        }
+
+        if (modules.color_by_life) {
+            approach(*modules.color_by_life, identity,
+                     {s.color.x.data() + begin, s.color.y.data() + begin, s.color.z.data() + begin, s.color.w.data() + begin},
+                     lifetime, dt, count);
+
+            for (auto* stream : {&s.color.x, &s.color.y, &s.color.z, &s.color.w}) {
+                kernels::clampMin(stream->data() + begin, 0.0f, count);
+            }
+        }
+
+        if (modules.rotation_rate) {
+            Samples<glm::vec3> samples;
+            glm::vec3 constant {0.0f};
+
+            const auto sampled = sample(*modules.rotation_rate, count, [&] (const glm::vec3& v) { return v * modules.rotation; }, samples, constant);
+
+            float* rotation[] = {s.rotation.x.data() + begin, s.rotation.y.data() + begin, s.rotation.z.data() + begin};
+            for (size_t c = 0; c < 3; ++c) {
+                if (sampled) {
+                    kernels::addScaled(rotation[c], samples[c].data(), dt, count);
+                } else {
+                    kernels::add(rotation[c], constant[static_cast<glm::length_t>(c)] * dt, count);
+                }
+            }
+        }
+
+        if (modules.size_by_life) {
+            approach(*modules.size_by_life, identity, {s.size.data() + begin}, lifetime, dt, count);
+        }
+
+        if (modules.time) {
+            kernels::add(s.time.data() + begin, dt, count);
+        }
+
+        // stages above read lifetime before it is decremented, the same way Lifetime module is run last
+        if (modules.lifetime) {
+            kernels::add(s.lifetime.data() + begin, -dt, count);
+        }
+
+        kernels::integrate(s.position.x.data() + begin, s.velocity.x.data() + begin, s.acceleration.x.data() + begin, dt, count);
+        kernels::integrate(s.position.y.data() + begin, s.velocity.y.data() + begin, s.acceleration.y.data() + begin, dt, count);
+        kernels::integrate(s.position.z.data() + begin, s.velocity.z.data() + begin, s.acceleration.z.data() + begin, dt, count);
+    }
+}
+
+void Limitless::fx::updateSprites(SpriteParticleStorage& storage, const SpriteKernelModules& modules, float dt) {
+    updateSprites(storage, modules, dt, 0, storage.count());
+}
+
+void Limitless::fx::updateSprites(SpriteParticleStorage& storage, const SpriteKernelModules& modules, float dt, size_t begin, size_t end) {
+    for (; begin < end; begin += BLOCK_SIZE) {
+        updateBlock(storage, modules, dt, begin, std::min(BLOCK_SIZE, end - begin));
+    }
+}
@@ -0,0 +1,146 @@
+#include <limitless/fx/sprite_particle_storage.hpp>
+
+using namespace Limitless::fx;
+
+namespace {
+    template<typename F>
+    void forEachStream(SpriteParticleStorage& storage, F&& function) {
+        for (auto* stream : {&storage.color, &storage.subUV, &storage.properties}) {
+            function(stream->x);
+            function(stream->y);
+            function(stream->z);
+            function(stream->w);
+        }
+
+        for (auto* stream : {&storage.acceleration, &storage.position, &storage.rotation, &storage.velocity}) {
+            function(stream->x);
+            function(stream->y);
+            function(stream->z);
+        }
+
+        function(storage.lifetime);
+        function(storage.size);
+        function(storage.time);
+    }
+
+    void push(SpriteParticleStorage::Vec4Stream& stream, const glm::vec4& value) {
+        stream.x.emplace_back(value.x);
+        stream.y.emplace_back(value.y);
+        stream.z.emplace_back(value.z);
+        stream.w.emplace_back(value.w);
+    }
+
+    void push(SpriteParticleStorage::Vec3Stream& stream, const glm::vec3& value) {
+        stream.x.emplace_back(value.x);
+        stream.y.emplace_back(value.y);
+        stream.z.emplace_back(value.z);
+    }
+
+    glm::vec4 get(const SpriteParticleStorage::Vec4Stream& stream, size_t index) noexcept {
+        return glm::vec4(stream.x[index], stream.y[index], stream.z[index], stream.w[index]);
+    }
+
+    glm::vec3 get(const SpriteParticleStorage::Vec3Stream& stream, size_t index) noexcept {
+        return glm::vec3(stream.x[index], stream.y[index], stream.z[index]);
+    }
+
+    void set(SpriteParticleStorage::Vec3Stream& stream, size_t index, const glm::vec3& value) noexcept {
+        stream.x[index] = value.x;
+        stream.y[index] = value.y;
+        stream.z[index] = value.z;
+    }
+}
+
+void SpriteParticleStorage::push(const SpriteParticle& particle) {
+    ::push(color, particle.color);
+    ::push(subUV, particle.subUV);
+    ::push(properties, particle.properties);
+    ::push(acceleration, particle.acceleration);
+    ::push(position, particle.position);
+    ::push(rotation, particle.rotation);
+    ::push(velocity, particle.velocity);
+    lifetime.emplace_back(particle.lifetime);
+    size.emplace_back(particle.size);
+    time.emplace_back(particle.time);
+}
+
+SpriteParticle SpriteParticleStorage::get(size_t index) const noexcept {
+    SpriteParticle particle {};
+
+    particle.color = ::get(color, index);
+    particle.subUV = ::get(subUV, index);
+    particle.properties = ::get(properties, index);
+    particle.acceleration = ::get(acceleration, index);
+    particle.lifetime = lifetime[index];
+    particle.position = ::get(position, index);
+    particle.size = size[index];
+    particle.rotation = ::get(rotation, index);
+    particle.time = time[index];
+    particle.velocity = ::get(velocity, index);
+
+    return particle;
+}
+
+void SpriteParticleStorage::removeDead(std::vector<size_t>& indices) {
+    indices.clear();
+    for (size_t i = 0; i < count(); ++i) {
+        if (lifetime[i] <= 0.0f) {
+            indices.emplace_back(i);
+        }
+    }
+
+    if (indices.empty()) {
+        return;
+    }
+
+    forEachStream(*this, [&] (std::vector<float>& stream) {
+        removeParticles(stream, indices);
+    });
+}
+
+void SpriteParticleStorage::pack(std::vector<SpriteParticle>& particles) const {
+    const auto particle_count = count();
+    particles.resize(particle_count);
+
+    for (size_t i = 0; i < particle_count; ++i) {
+        auto& particle = particles[i];
+
+        particle.color = glm::vec4(color.x[i], color.y[i], color.z[i], color.w[i]);
+        particle.subUV = glm::vec4(subUV.x[i], subUV.y[i], subUV.z[i], subUV.w[i]);
+        particle.properties = glm::vec4(properties.x[i], properties.y[i], properties.z[i], properties.w[i]);
+        particle.acceleration = glm::vec3(acceleration.x[i], acceleration.y[i], acceleration.z[i]);
+        particle.lifetime = lifetime[i];
+        particle.position = glm::vec3(position.x[i], position.y[i], position.z[i]);
+        particle.size = size[i];
+        particle.rotation = glm::vec3(rotation.x[i], rotation.y[i], rotation.z[i]);
+        particle.time = time[i];
+        particle.velocity = glm::vec3(velocity.x[i], velocity.y[i], velocity.z[i]);
+    }
+}
+
+void SpriteParticleStorage::translate(const glm::vec3& offset) noexcept {
+    for (size_t i = 0; i < count(); ++i) {
+        position.x[i] += offset.x;
+        position.y[i] += offset.y;
+        position.z[i] += offset.z;
+    }
+}
+
+void SpriteParticleStorage::rotate(const glm::quat& diff) noexcept {
+    const auto angles = glm::eulerAngles(diff);
+
+    for (size_t i = 0; i < count(); ++i) {
+        rotation.x[i] += angles.x;
+        rotation.y[i] += angles.y;
+        rotation.z[i] += angles.z;
+
+        set(velocity, i, diff * ::get(velocity, i));
+        set(acceleration, i, diff * ::get(acceleration, i));
+    }
+}
+
+void SpriteParticleStorage::clear() noexcept {
+    forEachStream(*this, [] (std::vector<float>& stream) {
+        stream.clear();
+    });
+}
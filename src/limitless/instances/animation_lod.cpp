@@ -0,0 +1,45 @@
+#include <limitless/instances/animation_lod.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+AnimationLod::AnimationLod(const AnimationLodSettings& _settings) noexcept
+    : settings {_settings} {
+}
+
+void AnimationLod::beginFrame(const Camera& camera) {
+    stats = {};
+
+    frustum = Frustum::fromCamera(camera);
+    screen_size = ScreenSize {camera};
+}
+
+uint32_t AnimationLod::select(const Box& box, bool has_sockets) const {
+    if (!settings.enabled) {
+        return 0;
+    }
+
+    // attached instances follow bones, so their carrier is evaluated even when it is not visible
+    if (settings.skip_culled && !has_sockets && frustum && !frustum->intersects(box)) {
+        return CULLED;
+    }
+
+    return ScreenSize::getLevel(screen_size.get(box), settings.screen_size);
+}
+
+uint32_t AnimationLod::getUpdateInterval(uint32_t level) const noexcept {
+    if (!settings.enabled || level >= settings.update_interval.size()) {
+        return 1;
+    }
+
+    return std::max(settings.update_interval[level], 1u);
+}
+
+bool AnimationLod::shouldSkipLeaves(uint32_t level) const noexcept {
+    return settings.enabled && level != CULLED && level >= settings.skip_leaf_bones_level;
+}
+
+void AnimationLod::setSettings(const AnimationLodSettings& _settings) noexcept {
+    settings = _settings;
+}
@@ -0,0 +1,44 @@
+#include <limitless/instances/effect_culling.hpp>
+
+#include <limitless/fx/emitters/abstract_emitter.hpp>
+#include <limitless/camera.hpp>
+
+using namespace Limitless;
+
+EffectCulling::EffectCulling(const EffectCullingSettings& _settings) noexcept
+    : settings {_settings} {
+}
+
+void EffectCulling::beginFrame(const Camera& camera) {
+    stats = {};
+
+    frustum = Frustum::fromCamera(camera);
+    camera_position = camera.getPosition();
+}
+
+bool EffectCulling::select(fx::AbstractEmitter& emitter) {
+    const auto& bounds = emitter.getBounds();
+
+    if (!settings.enabled || !frustum || !bounds || frustum->intersects(*bounds)) {
+        emitter.setCulled(false);
+        ++stats.visible_emitters;
+        return true;
+    }
+
+    emitter.setCulled(true);
+
+    // distance to the closest point of bounds
+    const auto outside = glm::max(glm::abs(camera_position - bounds->center) - bounds->size * 0.5f, glm::vec3{0.0f});
+    if (glm::length(outside) <= settings.distance) {
+        ++stats.culled_emitters;
+        return true;
+    }
+
+    emitter.suspend(settings.catch_up);
+    ++stats.suspended_emitters;
+    return false;
+}
+
+void EffectCulling::setSettings(const EffectCullingSettings& _settings) noexcept {
+    settings = _settings;
+}
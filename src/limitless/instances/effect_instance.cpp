@@ -1,5 +1,6 @@
 #include <limitless/instances/effect_instance.hpp>
 #include <limitless/fx/emitters/mesh_emitter.hpp>
+#include <limitless/fx/emitters/sprite_emitter.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
 
 using namespace Limitless;
@@ -12,7 +13,7 @@ bool EffectInstance::isDone() const noexcept {
     return done;
 }
 
-void EffectInstance::updateEmitters(const Camera& camera) const noexcept {
+void EffectInstance::placeEmitters() const noexcept {
 	// because we do not use final_matrix in emitter shaders explicitly
 	// we should decompose it to parameters
 	// and set it to emitters
@@ -31,10 +32,32 @@ void EffectInstance::updateEmitters(const Camera& camera) const noexcept {
 		emitter->setRotation(rotation);
 		//TODO
 		//emitter->setScale(scale);
-        emitter->update(camera);
 	}
 }
 
+void EffectInstance::updateBoundingBox() noexcept {
+    if (custom_bounding_box) {
+        Instance::updateBoundingBox();
+        bounded = true;
+        return;
+    }
+
+    std::optional<Box> box;
+    bounded = true;
+
+    for (const auto& [_, emitter] : emitters) {
+        const auto& emitter_bounds = emitter->getBounds();
+        if (!emitter_bounds) {
+            bounded = false;
+            continue;
+        }
+
+        box = box ? mergeBoundingBox(*box, *emitter_bounds) : *emitter_bounds;
+    }
+
+    bounding_box = box ? *box : Box {position, glm::vec3{0.0f}};
+}
+
 EffectInstance::EffectInstance() noexcept
     : Instance(InstanceType::Effect, glm::vec3{0.0f}) {
 }
@@ -45,6 +68,7 @@ EffectInstance::EffectInstance(const std::shared_ptr<EffectInstance>& effect, co
     for (const auto& [emitter_name, emitter] : effect->emitters) {
         emitters.emplace(emitter_name, emitter->clone());
     }
+    setSeed(getId());
 }
 
 EffectInstance::EffectInstance(const EffectInstance& effect) noexcept
@@ -53,6 +77,7 @@ EffectInstance::EffectInstance(const EffectInstance& effect) noexcept
     for (const auto& [emitter_name, emitter] : effect.emitters) {
         emitters.emplace(emitter_name, emitter->clone());
     }
+    setSeed(getId());
 }
 
 std::unique_ptr<Instance> EffectInstance::clone() noexcept {
@@ -60,7 +85,48 @@ std::unique_ptr<Instance> EffectInstance::clone() noexcept {
 }
 
 void EffectInstance::update(const Camera &camera) {
+    prepareUpdate(camera);
+    for (auto& [_, emitter] : emitters) {
+        emitter->update(camera);
+    }
+    finishUpdate();
+}
+
+void EffectInstance::prepareUpdate(const Camera& camera) {
     Instance::update(camera);
-	updateEmitters(camera);
-	done = isDone();
+    placeEmitters();
+
+    // simulation pass was removed from renderer; particles are read back here
+    // because emitters themselves may be updated on pool threads
+    for (auto& [_, emitter] : emitters) {
+        if (emitter->getType() == fx::AbstractEmitter::Type::Sprite) {
+            auto& sprite = static_cast<fx::SpriteEmitter&>(*emitter); //NOLINT
+            if (sprite.isGpuSimulationOrphaned()) {
+                sprite.disableGpuSimulation();
+            }
+        }
+    }
+}
+
+void EffectInstance::finishUpdate() noexcept {
+    // emitters moved their particles, so box is merged again
+    updateBoundingBox();
+    done = isDone();
+}
+
+void EffectInstance::reset(const glm::vec3& _position) {
+    Instance::reset(_position);
+
+    for (auto& [_, emitter] : emitters) {
+        emitter->reset();
+    }
+
+    setSeed(getId());
+}
+
+void EffectInstance::setSeed(uint64_t seed) noexcept {
+    // emitters get streams by name, so they do not depend on order of emitters in map
+    for (auto& [emitter_name, emitter] : emitters) {
+        emitter->setSeed(RandomStream::seed(seed, std::hash<std::string>{}(emitter_name)));
+    }
 }
@@ -0,0 +1,105 @@
+#include <limitless/instances/effect_pool.hpp>
+
+#include <limitless/instances/effect_instance.hpp>
+
+using namespace Limitless;
+
+EffectPool::Stats& EffectPool::Stats::operator+=(const Stats& rhs) noexcept {
+    created += rhs.created;
+    reused += rhs.reused;
+    active += rhs.active;
+    idle += rhs.idle;
+    return *this;
+}
+
+EffectPool::Entry& EffectPool::getEntry(const std::shared_ptr<EffectInstance>& effect) {
+    auto& entry = entries[effect.get()];
+    if (!entry.effect) {
+        entry.effect = effect;
+    }
+    return entry;
+}
+
+void EffectPool::collect(Entry& entry) {
+    auto& active = entry.active;
+
+    for (size_t i = 0; i < active.size(); ) {
+        // scene and other holders are done with killed instance when only pool owns it
+        if (active[i]->isKilled() && active[i].use_count() == 1) {
+            entry.idle.emplace_back(std::move(active[i]));
+            active[i] = std::move(active.back());
+            active.pop_back();
+        } else {
+            ++i;
+        }
+    }
+
+    entry.stats.active = active.size();
+    entry.stats.idle = entry.idle.size();
+}
+
+void EffectPool::prewarm(const std::shared_ptr<EffectInstance>& effect, size_t count) {
+    auto& entry = getEntry(effect);
+
+    entry.idle.reserve(count);
+    while (entry.idle.size() < count) {
+        entry.idle.emplace_back(std::make_shared<EffectInstance>(effect, glm::vec3 {0.0f}));
+        ++entry.stats.created;
+    }
+
+    entry.stats.idle = entry.idle.size();
+}
+
+std::shared_ptr<EffectInstance> EffectPool::acquire(const std::shared_ptr<EffectInstance>& effect, const glm::vec3& position) {
+    auto& entry = getEntry(effect);
+
+    if (entry.idle.empty()) {
+        collect(entry);
+    }
+
+    std::shared_ptr<EffectInstance> instance;
+    if (entry.idle.empty()) {
+        instance = std::make_shared<EffectInstance>(effect, position);
+        ++entry.stats.created;
+    } else {
+        instance = std::move(entry.idle.back());
+        entry.idle.pop_back();
+
+        instance->reset(position);
+        ++entry.stats.reused;
+    }
+
+    entry.active.emplace_back(instance);
+
+    entry.stats.active = entry.active.size();
+    entry.stats.idle = entry.idle.size();
+
+    return instance;
+}
+
+void EffectPool::collect() {
+    for (auto& [_, entry] : entries) {
+        collect(entry);
+    }
+}
+
+void EffectPool::clear(const std::shared_ptr<EffectInstance>& effect) {
+    entries.erase(effect.get());
+}
+
+void EffectPool::clear() {
+    entries.clear();
+}
+
+EffectPool::Stats EffectPool::getStats(const std::shared_ptr<EffectInstance>& effect) const {
+    const auto it = entries.find(effect.get());
+    return it != entries.end() ? it->second.stats : Stats {};
+}
+
+EffectPool::Stats EffectPool::getStats() const {
+    Stats stats;
+    for (const auto& [_, entry] : entries) {
+        stats += entry.stats;
+    }
+    return stats;
+}
@@ -32,6 +32,7 @@ Instance::Instance(const Instance& rhs)
     , custom_bounding_box {rhs.custom_bounding_box}
     , decal_mask {rhs.decal_mask}
     , shadow_cast {rhs.shadow_cast}
+    , static_geometry {rhs.static_geometry}
     , outlined {rhs.outlined}
     , hidden {rhs.hidden}
     , done {rhs.done}
@@ -45,6 +46,31 @@ Instance::Instance(const Instance& rhs)
          .build("model_buffer", *Context::getCurrentContext())} {
 }
 
+void Instance::reset(const glm::vec3& _position) noexcept {
+    id = next_id++;
+
+    final_matrix = glm::mat4 {1.0f};
+    parent = glm::mat4 {1.0f};
+    transformation_matrix = glm::mat4 {1.0f};
+    model_matrix = glm::mat4 {1.0f};
+    rotation = glm::quat {1.0f, 0.0f, 0.0f, 0.0f};
+    position = _position;
+    scale = glm::vec3 {1.0f};
+    outline_color = glm::vec3 {1.0f};
+    bounding_box = {};
+    custom_bounding_box = std::nullopt;
+    decal_mask = 0x00;
+    shadow_cast = true;
+    static_geometry = false;
+    outlined = false;
+    hidden = false;
+    done = false;
+    pickable = true;
+    current_data = {};
+
+    getAttachments().clear();
+}
+
 void Instance::updateModelMatrix() noexcept {
     const auto translation_matrix = glm::translate(glm::mat4{1.0f}, position);
     const auto rotation_matrix = glm::toMat4(rotation);
@@ -101,6 +127,24 @@ bool Instance::doesCastShadow() const noexcept {
 	return shadow_cast;
 }
 
+void Instance::makeStatic() noexcept {
+    static_geometry = true;
+    for (const auto& [_, attachment]: getAttachments()) {
+        attachment->makeStatic();
+    }
+}
+
+void Instance::makeDynamic() noexcept {
+    static_geometry = false;
+    for (const auto& [_, attachment]: getAttachments()) {
+        attachment->makeDynamic();
+    }
+}
+
+bool Instance::isStatic() const noexcept {
+    return static_geometry;
+}
+
 void Instance::makePickable() noexcept {
     pickable = true;
     for (const auto& [_, attachment]: getAttachments()) {
@@ -19,6 +19,10 @@ void Instance::Builder::initialize(Instance& instance) {
         instance.castShadow();
     }
 
+    if (static_) {
+        instance.makeStatic();
+    }
+
     if (bounding_box_) {
         instance.setBoundingBox(*bounding_box_);
     }
@@ -80,6 +84,11 @@ Instance::Builder &Instance::Builder::cast_shadow(bool cast_shadow) {
     return *this;
 }
 
+Instance::Builder &Instance::Builder::static_geometry(bool static_geometry) {
+    static_ = static_geometry;
+    return *this;
+}
+
 Instance::Builder& Instance::Builder::bounding_box(const Box& box) {
     bounding_box_ = box;
     return *this;
@@ -5,7 +5,11 @@
 using namespace Limitless;
 
 InstancedInstance::InstancedInstance()
-    : Instance {InstanceType::Instanced, glm::vec3{0.0f}}
+    : InstancedInstance {InstanceType::Instanced} {
+}
+
+InstancedInstance::InstancedInstance(InstanceType type)
+    : Instance {type, glm::vec3{0.0f}}
     , buffer {Buffer::builder()
         .target(Buffer::Type::ShaderStorage)
         .usage(Buffer::Usage::DynamicDraw)
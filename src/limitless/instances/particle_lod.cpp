@@ -0,0 +1,83 @@
+#include <limitless/instances/particle_lod.hpp>
+
+#include <limitless/fx/emitters/abstract_emitter.hpp>
+#include <limitless/fx/emitters/emitter_spawn.hpp>
+#include <limitless/camera.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace Limitless;
+
+ParticleLod::ParticleLod(const ParticleLodSettings& _settings) noexcept
+    : settings {_settings} {
+}
+
+void ParticleLod::beginFrame(const Camera& camera) {
+    stats = {};
+    selected.clear();
+
+    screen_size = ScreenSize {camera};
+}
+
+float ParticleLod::getScreenSize(const std::optional<Box>& bounds) const noexcept {
+    return bounds ? screen_size.get(*bounds) : std::numeric_limits<float>::max();
+}
+
+uint32_t ParticleLod::getLevel(const std::optional<Box>& bounds) const noexcept {
+    if (!settings.enabled) {
+        return 0;
+    }
+
+    return ScreenSize::getLevel(getScreenSize(bounds), settings.screen_size);
+}
+
+void ParticleLod::select(fx::AbstractEmitter& emitter) {
+    const auto level = getLevel(emitter.getBounds());
+    const auto& lod = emitter.getLod() ? *emitter.getLod() : settings.default_lod;
+    const auto lod_level = settings.enabled ? lod.levels[level] : fx::EmitterLodLevel {};
+
+    emitter.setLodLevel(lod_level);
+    ++stats.emitters[level];
+
+    const auto particles = static_cast<uint64_t>(static_cast<float>(emitter.getSpawn().max_count) * lod_level.max_count);
+    selected.push_back({&emitter, getScreenSize(emitter.getBounds()), particles});
+    stats.budgeted_particles += particles;
+}
+
+void ParticleLod::applyBudget() {
+    if (!settings.enabled || settings.particle_budget == 0 || stats.budgeted_particles <= settings.particle_budget) {
+        return;
+    }
+
+    // least important emitters are throttled first
+    std::sort(selected.begin(), selected.end(), [] (const Selected& a, const Selected& b) {
+        return a.screen_size < b.screen_size;
+    });
+
+    for (const auto& [emitter, _, particles] : selected) {
+        if (stats.budgeted_particles <= settings.particle_budget) {
+            break;
+        }
+
+        if (particles == 0) {
+            continue;
+        }
+
+        // the last throttled emitter keeps as many particles as still fit
+        const auto excess = std::min(stats.budgeted_particles - settings.particle_budget, particles);
+        const auto scale = static_cast<float>(particles - excess) / static_cast<float>(particles);
+
+        auto level = emitter->getLodLevel();
+        level.spawn_rate *= scale;
+        level.max_count *= scale;
+        emitter->setLodLevel(level);
+
+        stats.budgeted_particles -= excess;
+        ++stats.throttled_emitters;
+    }
+}
+
+void ParticleLod::setSettings(const ParticleLodSettings& _settings) noexcept {
+    settings = _settings;
+}
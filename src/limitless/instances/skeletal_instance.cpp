@@ -1,4 +1,5 @@
 #include <limitless/instances/skeletal_instance.hpp>
+#include <limitless/instances/animation_lod.hpp>
 #include <limitless/shader_storage.hpp>
 #include "limitless/core/shader/shader_program.hpp"
 #include <limitless/core/context.hpp>
@@ -24,82 +25,222 @@ void SkeletalInstance::initializeBuffer() {
             .build();
 }
 
-void SkeletalInstance::updateAnimationFrame() {
-    if (!animation || paused) {
+bool SkeletalInstance::skipEvaluation(AnimationLod* lod) {
+    if (!lod) {
+        return false;
+    }
+
+    if (lod_level == AnimationLod::CULLED) {
+        // pose is stale, interpolation restarts once instance is visible again
+        lod_to.clear();
+        lod->onSkipped();
+        return true;
+    }
+
+    const auto interval = lod->getUpdateInterval(lod_level);
+
+    // instances with fresh state are spread over interval, so they are not evaluated on the same frame
+    if (lod_to.empty()) {
+        frames_since_evaluation = static_cast<uint32_t>(getId() % interval);
+        return false;
+    }
+
+    if (++frames_since_evaluation >= interval) {
+        frames_since_evaluation = 0;
+        return false;
+    }
+
+    interpolatePose(static_cast<float>(frames_since_evaluation + 1) / static_cast<float>(interval));
+    lod->onInterpolated();
+    return true;
+}
+
+void SkeletalInstance::storePose(std::vector<BonePose>& pose) const {
+    pose.resize(bone_transform.size());
+
+    for (size_t i = 0; i < bone_transform.size(); ++i) {
+        const auto& transform = bone_transform[i];
+        auto& bone = pose[i];
+
+        bone.translation = glm::vec3(transform[3]);
+        bone.scale = glm::vec3(glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])));
+
+        // mirrored bone keeps proper rotation with negative scale
+        if (glm::determinant(glm::mat3(transform)) < 0.0f) {
+            bone.scale.x = -bone.scale.x;
+        }
+
+        glm::mat3 rotation {1.0f};
+        for (glm::length_t axis = 0; axis < 3; ++axis) {
+            if (bone.scale[axis] != 0.0f) {
+                rotation[axis] = glm::vec3(transform[axis]) / bone.scale[axis];
+            }
+        }
+        bone.rotation = glm::normalize(glm::quat_cast(rotation));
+    }
+}
+
+void SkeletalInstance::interpolatePose(float factor) {
+    for (size_t i = 0; i < bone_transform.size(); ++i) {
+        const auto& from = lod_from[i];
+        const auto& to = lod_to[i];
+
+        // translate * rotate * scale without intermediate matrix products
+        auto& transform = bone_transform[i];
+        transform = glm::mat4_cast(glm::normalize(glm::slerp(from.rotation, to.rotation, factor)));
+
+        const auto scale = glm::mix(from.scale, to.scale, factor);
+        transform[0] *= scale.x;
+        transform[1] *= scale.y;
+        transform[2] *= scale.z;
+        transform[3] = glm::vec4(glm::mix(from.translation, to.translation, factor), 1.0f);
+    }
+
+    bone_buffer->mapData(bone_transform.data(), sizeof(glm::mat4) * bone_transform.size());
+}
+
+void SkeletalInstance::beginEvaluation(const AnimationLod* lod) {
+    // currently displayed pose becomes start of next interpolation
+    if (lod && !lod_to.empty()) {
+        storePose(lod_from);
+    }
+}
+
+void SkeletalInstance::finishEvaluation(AnimationLod* lod, size_t bones) {
+    if (!lod) {
+        bone_buffer->mapData(bone_transform.data(), sizeof(glm::mat4) * bone_transform.size());
+        return;
+    }
+
+    lod->onEvaluated(bones);
+
+    const auto interval = lod->getUpdateInterval(lod_level);
+    if (interval <= 1) {
+        lod_to.clear();
+        bone_buffer->mapData(bone_transform.data(), sizeof(glm::mat4) * bone_transform.size());
+        return;
+    }
+
+    const auto fresh = lod_to.empty();
+    storePose(lod_to);
+    if (fresh) {
+        lod_from = lod_to;
+    }
+
+    interpolatePose(1.0f / static_cast<float>(interval));
+}
+
+void SkeletalInstance::updateAnimationFrame(AnimationLod* lod) {
+    if ((!animation && blender.empty()) || paused) {
         return;
     }
 
     auto& skeletal = dynamic_cast<SkeletalModel&>(*model);
-    auto& bones = skeletal.getBones();
-    const Animation& anim = *animation;
 
     const auto current_time = std::chrono::steady_clock::now();
     if (last_time == std::chrono::time_point<std::chrono::steady_clock>()) {
         last_time = current_time;
     }
-    const auto delta_time = current_time - last_time;
-    animation_duration += delta_time;
+    const std::chrono::duration<double> delta_time = current_time - last_time;
     last_time = current_time;
-    const auto animation_time = glm::mod(animation_duration.count() * anim.tps, anim.duration);
 
-    std::function<void(const Tree<uint32_t>&, const glm::mat4&)> node_traversal;
-    node_traversal = [&](const Tree<uint32_t>& node, const glm::mat4& parent_mat) {
-        const auto bone_indice = *node;
-        auto& bone = bones[bone_indice];
+    if (!blender.empty()) {
+        blender.advance(delta_time.count());
+
+        // every layer faded out, nothing left to play
+        if (blender.empty()) {
+            animation = nullptr;
+            return;
+        }
 
-        auto local_transform = [&]() -> glm::mat4 {
-            auto* anim_node = findAnimationNode(bone);
-            if (!anim_node) {
-                return bone.node_transform;
+        if (!blender.isSingleClip()) {
+            if (skipEvaluation(lod)) {
+                return;
             }
 
-            auto maybe_anim_position = anim_node->positionLerp(animation_time);
-            auto maybe_anim_rotation = anim_node->rotationLerp(animation_time);
-            auto maybe_anim_scale = anim_node->scalingLerp(animation_time);
+            beginEvaluation(lod);
+            blender.evaluate(skeletal, global_transform, bone_transform);
+            finishEvaluation(lod, skeletal.getFlatSkeleton().size());
+            return;
+        }
 
-            auto position = maybe_anim_position? *maybe_anim_position : bone.position;
-            auto rotation = maybe_anim_rotation? *maybe_anim_rotation : bone.rotation;
-            auto scale = maybe_anim_scale? *maybe_anim_scale : bone.scale;
+        // blend is finished, remaining clip continues playing without blending
+        auto& layer = blender.getLayers().front();
+        animation = layer.animation;
+        cursors = std::move(layer.cursors);
+        animation_duration = std::chrono::duration<double>(layer.time);
+        blender.clear();
+    } else {
+        animation_duration += delta_time;
+    }
 
-            auto translate = glm::translate(glm::mat4(1.f), position);
-            auto rotate = glm::mat4_cast(rotation);
-            auto scale_mat = glm::scale(glm::mat4(1.f), scale);
+    const Animation& anim = *animation;
+    const auto animation_time = glm::mod(animation_duration.count() * anim.tps, anim.duration);
 
-            return translate * rotate * scale_mat;
-        }();
+    if (!pose_sharing) {
+        if (skipEvaluation(lod)) {
+            return;
+        }
 
-        auto global_transform = parent_mat * local_transform;
+        beginEvaluation(lod);
+        const auto bones = evaluatePose(animation_time, lod && lod->shouldSkipLeaves(lod_level));
+        finishEvaluation(lod, bones);
+        return;
+    }
 
-        if (bone.joint_index) {
-            bone_transform[*bone.joint_index] = global_transform * bone.offset_matrix;
-        }
+    if (lod && lod_level == AnimationLod::CULLED) {
+        lod->onSkipped();
+        return;
+    }
 
-        for (const auto& n : node) {
-            node_traversal(n, global_transform);
-        }
-    };
+    // throttled levels sample every interval-th cache frame instead of interpolating,
+    // so those frames stay shared with instances on any level
+    const auto interval = lod ? lod->getUpdateInterval(lod_level) : 1u;
 
-    try {
-        for (auto& hierarchy : skeletal.getSkeletonTrees()) {
-            node_traversal(hierarchy, glm::mat4(1.f));
-        }
-    } catch (const std::exception& e) {
-        throw std::runtime_error("Wrong TPS/duration. " + std::string(e.what()));
+    auto& cache = skeletal.getPoseCache();
+    auto frame = cache.getFrame(anim, animation_time);
+    frame -= frame % interval;
+    if (shared_pose && shared_animation == animation && shared_frame == frame) {
+        return;
     }
 
-    bone_buffer->mapData(bone_transform.data(), sizeof(glm::mat4) * bone_transform.size());
-}
+    shared_animation = animation;
+    shared_frame = frame;
+    shared_pose = cache.find(anim, frame);
+    if (shared_pose) {
+        return;
+    }
 
-const AnimationNode* SkeletalInstance::findAnimationNode(const Bone& bone) const noexcept {
-    if (animation) {
-        for (auto& node : animation->nodes) {
-            if (&node.bone == &bone) {
-                return &node;
-            }
-        }
+    // cached poses are shared with instances on any level, so they are always complete
+    const auto bones = evaluatePose(cache.getFrameTime(anim, frame));
+    if (lod) {
+        lod->onEvaluated(bones);
+    }
+
+    // released poses of the model come with buffers of the same size, so buffer is only rewritten
+    auto pose = cache.acquire();
+    pose->bone_transform = bone_transform;
+
+    const auto size = pose->bone_transform.size() * sizeof(glm::mat4);
+    if (pose->buffer && pose->buffer->getSize() >= size) {
+        pose->buffer->bufferSubData(0, size, pose->bone_transform.data());
+    } else {
+        pose->buffer = Buffer::builder()
+                .target(Buffer::Type::ShaderStorage)
+                .usage(Buffer::Usage::DynamicDraw)
+                .access(Buffer::MutableAccess::None)
+                .data(pose->bone_transform.data())
+                .size(size)
+                .build();
     }
 
-    return nullptr;
+    cache.insert(anim, frame, pose);
+    shared_pose = std::move(pose);
+}
+
+size_t SkeletalInstance::evaluatePose(double animation_time, bool skip_leaves) {
+    const auto& skeletal = dynamic_cast<SkeletalModel&>(*model);
+    return skeletal.evaluatePose(*animation, animation_time, cursors, global_transform, bone_transform, skip_leaves);
 }
 
 SkeletalInstance::SkeletalInstance(std::shared_ptr<AbstractModel> m, const glm::vec3& position)
@@ -113,6 +254,7 @@ SkeletalInstance::SkeletalInstance(std::shared_ptr<AbstractModel> m, const glm::
     });
 
     bone_transform.resize(skinned_bones, glm::mat4(1.0f));
+    global_transform.resize(skeletal.getFlatSkeleton().size(), glm::mat4(1.0f));
     initializeBuffer();
 }
 
@@ -120,11 +262,23 @@ SkeletalInstance::SkeletalInstance(const SkeletalInstance& rhs) noexcept
     : ModelInstance {rhs}
     , SocketAttachment {rhs}
     , bone_transform {rhs.bone_transform}
+    , global_transform {rhs.global_transform}
     , animation {rhs.animation}
+    , cursors {rhs.cursors}
     , paused {rhs.paused}
     , last_time {rhs.last_time}
-    , animation_duration {rhs.animation_duration} {
+    , animation_duration {rhs.animation_duration}
+    , shared_pose {rhs.shared_pose}
+    , shared_animation {rhs.shared_animation}
+    , shared_frame {rhs.shared_frame}
+    , pose_sharing {rhs.pose_sharing}
+    , blender {rhs.blender} {
     initializeBuffer();
+
+    // skinning output is per instance, copy gets its own buffers on first dispatch
+    if (rhs.skinned_vertices && rhs.skinned_vertices->isReadbackEnabled()) {
+        enableSkinnedReadback();
+    }
 }
 
 
@@ -133,7 +287,17 @@ std::unique_ptr<Instance> SkeletalInstance::clone() noexcept {
 }
 
 void SkeletalInstance::update(const Camera &camera) {
-    updateAnimationFrame();
+    updateAnimationFrame(nullptr);
+
+    SocketAttachment::updateSocketAttachments();
+
+    ModelInstance::update(camera);
+}
+
+void SkeletalInstance::update(const Camera& camera, AnimationLod& lod) {
+    lod_level = lod.select(getBoundingBox(), !getAttachmentBoneData().empty());
+
+    updateAnimationFrame(&lod);
 
     SocketAttachment::updateSocketAttachments();
 
@@ -145,6 +309,8 @@ SkeletalInstance &SkeletalInstance::play(uint32_t index) {
     const auto& animations = skeletal.getAnimations();
 
     animation = &animations.at(index);
+    cursors.assign(animation->nodes.size(), {});
+    blender.clear();
     animation_duration = std::chrono::seconds(0);
     last_time = std::chrono::time_point<std::chrono::steady_clock>();
 
@@ -152,18 +318,70 @@ SkeletalInstance &SkeletalInstance::play(uint32_t index) {
 }
 
 SkeletalInstance& SkeletalInstance::play(const std::string& name) {
-    const auto& skeletal = dynamic_cast<SkeletalModel&>(*model);
-    const auto& animations = skeletal.getAnimations();
+    animation = &findAnimation(name);
+    cursors.assign(animation->nodes.size(), {});
+    blender.clear();
+    animation_duration = std::chrono::seconds(0);
+    last_time = std::chrono::time_point<std::chrono::steady_clock>();
+
+    return *this;
+}
+
+const Animation& SkeletalInstance::findAnimation(const std::string& name) const {
+    const auto& animations = getAllAnimations();
 
     const auto found = std::find_if(animations.begin(), animations.end(), [&] (const auto& anim) { return name == anim.name; });
     if (found == animations.end()) {
         throw no_such_animation("with name " + name);
-    } else {
-        animation = &(*found);
-        animation_duration = std::chrono::seconds(0);
-        last_time = std::chrono::time_point<std::chrono::steady_clock>();
     }
 
+    return *found;
+}
+
+void SkeletalInstance::beginBlending() {
+    if (!blender.empty()) {
+        return;
+    }
+
+    // blended pose is evaluated per instance
+    if (shared_pose) {
+        bone_transform = shared_pose->bone_transform;
+        shared_pose.reset();
+    }
+    shared_animation = nullptr;
+
+    blender.initialize(dynamic_cast<SkeletalModel&>(*model));
+
+    // currently playing clip becomes the first layer
+    if (animation) {
+        const auto index = blender.add(*animation);
+        auto& layer = blender.getLayers()[index];
+        layer.time = animation_duration.count();
+        layer.cursors = std::move(cursors);
+    }
+}
+
+SkeletalInstance& SkeletalInstance::crossfade(const std::string& name, double duration) {
+    const auto& next = findAnimation(name);
+
+    beginBlending();
+    blender.crossfade(next, duration);
+    animation = &next;
+
+    return *this;
+}
+
+SkeletalInstance& SkeletalInstance::addLayer(const std::string& name, float weight, std::shared_ptr<const BoneMask> mask, bool additive) {
+    const auto& clip = findAnimation(name);
+
+    beginBlending();
+    blender.add(clip, weight, std::move(mask), additive);
+
+    return *this;
+}
+
+SkeletalInstance& SkeletalInstance::fadeLayer(size_t index, float weight, double duration) {
+    blender.fade(index, weight, duration);
     return *this;
 }
 
@@ -177,21 +395,73 @@ SkeletalInstance& SkeletalInstance::resume() noexcept {
     return *this;
 }
 
+SkeletalInstance& SkeletalInstance::enablePoseSharing() noexcept {
+    pose_sharing = true;
+    return *this;
+}
+
+SkeletalInstance& SkeletalInstance::disablePoseSharing() noexcept {
+    if (shared_pose) {
+        bone_transform = shared_pose->bone_transform;
+        bone_buffer->mapData(bone_transform.data(), sizeof(glm::mat4) * bone_transform.size());
+        shared_pose.reset();
+    }
+    shared_animation = nullptr;
+    pose_sharing = false;
+    return *this;
+}
+
+const std::shared_ptr<Buffer>& SkeletalInstance::getBoneBuffer() const noexcept {
+    return shared_pose ? shared_pose->buffer : bone_buffer;
+}
+
+const std::vector<glm::mat4>& SkeletalInstance::getBoneTransform() const noexcept {
+    return shared_pose ? shared_pose->bone_transform : bone_transform;
+}
+
 SkeletalInstance& SkeletalInstance::stop() noexcept {
     animation = nullptr;
+    blender.clear();
+    return *this;
+}
+
+SkinnedVertices& SkeletalInstance::getSkinnedVertices() {
+    if (!skinned_vertices) {
+        skinned_vertices = std::make_unique<SkinnedVertices>();
+    }
+    return *skinned_vertices;
+}
+
+SkeletalInstance& SkeletalInstance::enableSkinnedReadback() {
+    getSkinnedVertices().enableReadback();
+    return *this;
+}
+
+SkeletalInstance& SkeletalInstance::disableSkinnedReadback() noexcept {
+    if (skinned_vertices) {
+        skinned_vertices->disableReadback();
+    }
     return *this;
 }
 
 glm::vec3 SkeletalInstance::getSkinnedVertexPosition(const std::shared_ptr<AbstractMesh>& mesh, size_t vertex_index) const {
+    if (skinned_vertices) {
+        if (const auto* skinned = skinned_vertices->findVertex(*mesh, vertex_index); skinned) {
+            return final_matrix * glm::vec4(glm::vec3(skinned->position), 1.0f);
+        }
+    }
+
     const auto& skinned_mesh = dynamic_cast<SkinnedVertexStream<VertexNormalTangent>&>(dynamic_cast<Mesh&>(*mesh).getVertexStream());
 
     const auto& bone_weight = skinned_mesh.getBoneWeights().at(vertex_index);
     const auto& vertex = skinned_mesh.getVertices().at(vertex_index);
 
-    auto transform = bone_transform[bone_weight.bone_index[0]] * bone_weight.weight[0];
-    transform     += bone_transform[bone_weight.bone_index[1]] * bone_weight.weight[1];
-    transform     += bone_transform[bone_weight.bone_index[2]] * bone_weight.weight[2];
-    transform     += bone_transform[bone_weight.bone_index[3]] * bone_weight.weight[3];
+    const auto& palette = getBoneTransform();
+
+    auto transform = palette[bone_weight.bone_index[0]] * bone_weight.weight[0];
+    transform     += palette[bone_weight.bone_index[1]] * bone_weight.weight[1];
+    transform     += palette[bone_weight.bone_index[2]] * bone_weight.weight[2];
+    transform     += palette[bone_weight.bone_index[3]] * bone_weight.weight[3];
 
     auto matrix = final_matrix;
     matrix *= transform;
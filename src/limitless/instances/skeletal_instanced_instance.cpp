@@ -0,0 +1,154 @@
+#include <limitless/instances/skeletal_instanced_instance.hpp>
+#include <limitless/instances/skeletal_instance.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+[[maybe_unused]] constexpr auto ANIMATION_BUFFER_NAME = "animation_buffer";
+
+SkeletalInstancedInstance::SkeletalInstancedInstance(std::shared_ptr<BakedAnimations> _baked)
+    : InstancedInstance {InstanceType::SkeletalInstanced}
+    , baked {std::move(_baked)}
+    , animation_buffer {Buffer::builder()
+        .target(Buffer::Type::ShaderStorage)
+        .usage(Buffer::Usage::DynamicDraw)
+        .access(Buffer::MutableAccess::WriteOrphaning)
+        .data(nullptr)
+        .size(sizeof(AnimationData))
+        .build()} {
+    if (!baked->isUploaded()) {
+        baked->initializeBuffers();
+    }
+}
+
+SkeletalInstancedInstance::SkeletalInstancedInstance(const SkeletalInstancedInstance& rhs)
+    : InstancedInstance {rhs}
+    , baked {rhs.baked}
+    , animation_buffer {Buffer::builder()
+        .target(Buffer::Type::ShaderStorage)
+        .usage(Buffer::Usage::DynamicDraw)
+        .access(Buffer::MutableAccess::WriteOrphaning)
+        .data(nullptr)
+        .size(sizeof(AnimationData))
+        .build()} {
+    // cloned instances get new ids, so states are remapped in order
+    for (size_t i = 0; i < instances.size(); ++i) {
+        states[instances[i]->getId()] = rhs.states.at(rhs.instances[i]->getId());
+    }
+}
+
+std::unique_ptr<Instance> SkeletalInstancedInstance::clone() noexcept {
+    return std::make_unique<SkeletalInstancedInstance>(*this);
+}
+
+void SkeletalInstancedInstance::add(const std::shared_ptr<ModelInstance>& instance, uint32_t animation) {
+    if (animation >= baked->getClips().size()) {
+        throw no_such_animation("with index " + std::to_string(animation));
+    }
+
+    InstancedInstance::add(instance);
+    states[instance->getId()] = {animation};
+}
+
+void SkeletalInstancedInstance::remove(uint64_t id) {
+    InstancedInstance::remove(id);
+    states.erase(id);
+}
+
+void SkeletalInstancedInstance::play(uint64_t id, uint32_t animation) {
+    if (animation >= baked->getClips().size()) {
+        throw no_such_animation("with index " + std::to_string(animation));
+    }
+
+    auto& state = states.at(id);
+    state.animation = animation;
+    state.time = 0.0;
+    animation_dirty = true;
+}
+
+void SkeletalInstancedInstance::play(uint64_t id, const std::string& name) {
+    play(id, baked->getAnimationIndex(name));
+}
+
+void SkeletalInstancedInstance::pause(uint64_t id) {
+    states.at(id).paused = true;
+}
+
+void SkeletalInstancedInstance::resume(uint64_t id) {
+    states.at(id).paused = false;
+}
+
+void SkeletalInstancedInstance::setSpeed(uint64_t id, float speed) {
+    states.at(id).speed = speed;
+}
+
+void SkeletalInstancedInstance::advance() {
+    const auto current_time = std::chrono::steady_clock::now();
+    if (last_time == std::chrono::time_point<std::chrono::steady_clock>()) {
+        last_time = current_time;
+    }
+    const std::chrono::duration<double> delta_time = current_time - last_time;
+    last_time = current_time;
+
+    for (auto& [_, state] : states) {
+        if (state.paused) {
+            continue;
+        }
+
+        const auto duration = baked->getDuration(state.animation);
+        state.time = duration > 0.0 ? glm::mod(state.time + delta_time.count() * state.speed, duration) : 0.0;
+    }
+}
+
+bool SkeletalInstancedInstance::isAnimationBufferUpToDate() const noexcept {
+    return !animation_dirty && std::equal(visible_instances.begin(), visible_instances.end(), uploaded_ids.begin(), uploaded_ids.end(),
+                                          [] (const auto& instance, uint64_t id) { return instance->getId() == id; });
+}
+
+void SkeletalInstancedInstance::updateAnimationBuffer() {
+    animation_data.clear();
+    animation_data.reserve(visible_instances.size());
+    uploaded_ids.clear();
+    uploaded_ids.reserve(visible_instances.size());
+
+    for (const auto& instance : visible_instances) {
+        const auto& state = states.at(instance->getId());
+        animation_data.push_back({state.animation, static_cast<float>(state.time)});
+        uploaded_ids.push_back(instance->getId());
+    }
+
+    animation_dirty = false;
+
+    if (animation_data.empty()) {
+        return;
+    }
+
+    const auto size = sizeof(AnimationData) * animation_data.size();
+    if (animation_buffer->getSize() < size) {
+        animation_buffer->resize(size);
+    }
+
+    animation_buffer->mapData(animation_data.data(), size);
+}
+
+void SkeletalInstancedInstance::updateInstanceBuffer() {
+    InstancedInstance::updateInstanceBuffer();
+
+    // every pass sets visible subset; states change only in update, so passes after first one just bind buffer
+    if (!isAnimationBufferUpToDate()) {
+        updateAnimationBuffer();
+    }
+}
+
+void SkeletalInstancedInstance::update(const Camera& camera) {
+    advance();
+    animation_dirty = true;
+
+    InstancedInstance::update(camera);
+}
+
+void SkeletalInstancedInstance::bind(Context& ctx) const {
+    baked->bind(ctx);
+    animation_buffer->bindBase(ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, ANIMATION_BUFFER_NAME));
+}
@@ -0,0 +1,77 @@
+#include <limitless/instances/skinned_vertices.hpp>
+#include <limitless/core/buffer/buffer_builder.hpp>
+
+using namespace Limitless;
+
+const std::shared_ptr<Buffer>& SkinnedVertices::getOutput(const AbstractMesh& mesh, size_t vertex_count) {
+    auto& output = outputs[&mesh];
+
+    const auto size = vertex_count * sizeof(SkinnedVertex);
+    if (!output.buffer) {
+        output.buffer = Buffer::builder()
+            .target(Buffer::Type::ShaderStorage)
+            .usage(Buffer::Usage::DynamicCopy)
+            .access(Buffer::MutableAccess::None)
+            .data(nullptr)
+            .size(size)
+            .build();
+    } else if (output.buffer->getSize() < size) {
+        output.buffer->resize(size);
+    }
+
+    return output.buffer;
+}
+
+std::shared_ptr<Buffer> SkinnedVertices::findOutput(const AbstractMesh& mesh) const noexcept {
+    const auto found = outputs.find(&mesh);
+    return found != outputs.end() ? found->second.buffer : nullptr;
+}
+
+void SkinnedVertices::fetch() {
+    for (auto& [_, output] : outputs) {
+        if (!output.sync || !output.sync->isDone()) {
+            continue;
+        }
+
+        // fence is signaled, so reading does not stall pipeline
+        output.cpu_copy.resize(output.buffer->getSize() / sizeof(SkinnedVertex));
+        output.buffer->bindAs(Buffer::Type::ShaderStorage);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(output.cpu_copy.size() * sizeof(SkinnedVertex)), output.cpu_copy.data());
+
+        output.sync.reset();
+    }
+}
+
+void SkinnedVertices::fence() {
+    if (!readback) {
+        return;
+    }
+
+    for (auto& [_, output] : outputs) {
+        // previous readback is still in flight, it is going to see one of the following frames
+        if (output.sync) {
+            continue;
+        }
+
+        output.sync = std::make_unique<Sync>();
+        output.sync->place();
+    }
+}
+
+void SkinnedVertices::disableReadback() noexcept {
+    readback = false;
+
+    for (auto& [_, output] : outputs) {
+        output.sync.reset();
+        output.cpu_copy = {};
+    }
+}
+
+const SkinnedVertex* SkinnedVertices::findVertex(const AbstractMesh& mesh, size_t vertex_index) const noexcept {
+    const auto found = outputs.find(&mesh);
+    if (found == outputs.end() || vertex_index >= found->second.cpu_copy.size()) {
+        return nullptr;
+    }
+
+    return &found->second.cpu_copy[vertex_index];
+}
@@ -13,6 +13,7 @@
 #include <limitless/renderer/renderer.hpp>
 #include <limitless/camera.hpp>
 #include <limitless/scene.hpp>
+#include <limitless/util/frustum.hpp>
 
 #include <limitless/fx/effect_renderer.hpp>
 #include <iostream>
@@ -23,7 +24,7 @@ namespace {
     constexpr auto DIRECTIONAL_CSM_BUFFER_NAME = "directional_shadows";
 }
 
-void CascadeShadows::initBuffers() {
+std::unique_ptr<Framebuffer> CascadeShadows::makeDepthFramebuffer() const {
     auto depth = Texture::builder()
             .target(Texture::Type::Tex2DArray)
             .internal_format(Texture::InternalFormat::Depth16)
@@ -39,14 +40,26 @@ void CascadeShadows::initBuffers() {
             .wrap_r(Texture::Wrap::ClampToEdge)
             .build();
 
-    framebuffer = std::make_unique<Framebuffer>();
-    framebuffer->bind();
-    *framebuffer << TextureAttachment{FramebufferAttachment::Depth, depth};
-    framebuffer->specifyLayer(FramebufferAttachment::Depth, 0);
-    framebuffer->drawBuffer(FramebufferAttachment::None);
-    framebuffer->readBuffer(FramebufferAttachment::None);
-    framebuffer->checkStatus();
-    framebuffer->unbind();
+    auto fb = std::make_unique<Framebuffer>();
+    fb->bind();
+    *fb << TextureAttachment{FramebufferAttachment::Depth, depth};
+    fb->specifyLayer(FramebufferAttachment::Depth, 0);
+    fb->drawBuffer(FramebufferAttachment::None);
+    fb->readBuffer(FramebufferAttachment::None);
+    fb->checkStatus();
+    fb->unbind();
+
+    return fb;
+}
+
+void CascadeShadows::initBuffers() {
+    framebuffer = makeDepthFramebuffer();
+
+    if (static_cache) {
+        static_framebuffer = makeDepthFramebuffer();
+    } else {
+        static_framebuffer.reset();
+    }
 
     light_buffer = Buffer::builder()
           .target(Buffer::Type::ShaderStorage)
@@ -58,7 +71,9 @@ void CascadeShadows::initBuffers() {
 
 CascadeShadows::CascadeShadows(const RendererSettings& settings)
     : shadow_resolution {settings.csm_resolution}
-    , split_count {settings.csm_split_count} {
+    , split_count {settings.csm_split_count}
+    , static_cache {settings.csm_static_cache}
+    , static_cache_margin {settings.csm_static_cache_margin} {
     initBuffers();
     frustums.resize(split_count);
     far_bounds.resize(split_count);
@@ -127,9 +142,6 @@ void CascadeShadows::updateFrustums(Context& ctx, const Camera& camera) {
 }
 
 void CascadeShadows::updateLightMatrices(const Light& light) {
-    // clear matrices
-    light_space.clear();
-
     auto up = glm::vec3{0.0f, 1.0f, 0.0f};
 
     if (glm::abs(glm::dot(up, light.getDirection())) > 0.999f) {
@@ -138,49 +150,96 @@ void CascadeShadows::updateLightMatrices(const Light& light) {
 
     const auto view = glm::lookAt(-light.getDirection(), { 0.0f, 0.0f, 0.0f }, up);
     for (auto& frustum : frustums) {
-        glm::vec3 max = {std::numeric_limits<float>::min(), std::numeric_limits<float>::min(), 0.0f};
-        glm::vec3 min = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), 0.0f};
+        // bounding sphere does not depend on camera rotation, so cascade size stays the same between frames
+        auto center = glm::vec3{0.0f};
+        for (const auto& point : frustum.points) {
+            center += point;
+        }
+        center /= 8.0f;
 
-        auto transform = view * glm::vec4(frustum.points[0], 1.0f);
-        min.z = transform.z;
-        max.z = transform.z;
+        auto radius = 0.0f;
+        for (const auto& point : frustum.points) {
+            radius = glm::max(radius, glm::distance(center, point));
+        }
+        radius = glm::ceil(radius * 16.0f) / 16.0f;
 
-        for (int j = 1; j < 8; j++) {
-            transform = view * glm::vec4(frustum.points[j], 1.0f);
-            max.z = glm::max(max.z, transform.z);
-            min.z = glm::min(min.z, transform.z);
+        // cached cascades are enlarged so the camera can move within margin without redrawing static layer
+        if (static_cache) {
+            radius *= 1.0f + static_cache_margin;
         }
 
+        // snaps cascade origin to shadow map texels to prevent shimmering while camera moves
+        const auto texel = glm::vec2{2.0f * radius} / glm::vec2{shadow_resolution};
+        auto light_center = glm::vec3{view * glm::vec4(center, 1.0f)};
+        light_center.x = glm::floor(light_center.x / texel.x) * texel.x;
+        light_center.y = glm::floor(light_center.y / texel.y) * texel.y;
+
         // TODO: make sure all relevant shadow casters are included, solve this shit, add AABB
-        max.z += 50;
+        const auto projection = glm::ortho(light_center.x - radius, light_center.x + radius,
+                                           light_center.y - radius, light_center.y + radius,
+                                           -(light_center.z + radius + 50.0f), -(light_center.z - radius));
 
-        const auto projection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -max.z, -min.z);
-        const auto mvp = projection * view;
+        frustum.center = light_center;
+        frustum.radius = radius;
+        frustum.crop = projection * view;
+    }
+}
 
-        for (const auto& point : frustum.points) {
-            transform = mvp * glm::vec4(point, 1.0f);
+bool CascadeShadows::isStaticLayerValid(const ShadowFrustum& frustum, const Light& light) const noexcept {
+    if (!frustum.static_valid) {
+        return false;
+    }
+
+    if (static_light_direction != light.getDirection()) {
+        return false;
+    }
+
+    if (frustum.static_radius != frustum.radius) {
+        return false;
+    }
+
+    // cascade is padded with margin, so it still covers current frustum slice
+    const auto threshold = frustum.radius * static_cache_margin / (1.0f + static_cache_margin);
+    const auto delta = glm::abs(frustum.center - frustum.static_center);
+    return delta.x <= threshold && delta.y <= threshold && delta.z <= threshold;
+}
+
+void CascadeShadows::updateStaticLayers(Scene& scene, Context& ctx, const Assets& assets, const Light& light) {
+    bool bound = false;
+
+    for (uint32_t i = 0; i < split_count; ++i) {
+        auto& frustum = frustums[i];
 
-            transform.x /= transform.w;
-            transform.y /= transform.w;
+        if (isStaticLayerValid(frustum, light)) {
+            continue;
+        }
 
-            max.x = glm::max(transform.x, max.x);
-            max.y = glm::max(transform.y, max.y);
-            min.x = glm::min(transform.x, min.x);
-            min.y = glm::min(transform.y, min.y);
+        if (!bound) {
+            static_framebuffer->bind();
+            bound = true;
         }
 
-        const auto scale = glm::vec2(2.0f / (max.x - min.x), 2.0f / (max.y - min.y));
-        const auto offset = glm::vec2(-0.5f * (max.x + min.x) * scale.x, -0.5f * (max.y + min.y) * scale.y);
+        frustum.static_crop = frustum.crop;
+        frustum.static_center = frustum.center;
+        frustum.static_radius = frustum.radius;
+        frustum.static_valid = true;
 
-        glm::mat4 crop {1.0f};
-        crop[0][0] = scale.x;
-        crop[1][1] = scale.y;
-        crop[0][3] = offset.x;
-        crop[1][3] = offset.y;
-        crop = glm::transpose(crop);
+        static_framebuffer->specifyLayer(FramebufferAttachment::Depth, i);
+        static_framebuffer->clear();
 
-        frustum.crop = crop * projection * view;
-        light_space.emplace_back(frustum.crop);
+        const auto uniform_set = [&] (ShaderProgram& shader) {
+            shader.setUniform("light_space", frustum.static_crop);
+        };
+
+        // layer outlives camera view, so casters are culled against cascade volume instead of camera frustum
+        const Frustum volume {frustum.static_crop};
+        InstanceRenderer::renderIntersecting(scene, volume, {ctx, assets, ShaderType::DirectionalShadow, ms::Blending::Opaque, UniformSetter{uniform_set}, {}, GeometryFilter::Static});
+    }
+
+    static_light_direction = light.getDirection();
+
+    if (bound) {
+        static_framebuffer->unbind();
     }
 }
 
@@ -189,25 +248,50 @@ void CascadeShadows::draw(InstanceRenderer& renderer,
                           Context& ctx,
                           const Assets& assets,
                           const Camera& camera) {
-    updateFrustums(ctx, camera);
-    updateLightMatrices(scene.getLighting().getDirectionalLight());
+    const auto& light = scene.getLighting().getDirectionalLight();
 
-    framebuffer->bind();
+    updateFrustums(ctx, camera);
+    updateLightMatrices(light);
 
     ctx.setViewPort(shadow_resolution);
     ctx.setDepthMask(DepthMask::True);
     ctx.setDepthFunc(DepthFunc::Less);
     ctx.enable(Capabilities::DepthTest);
 
+    if (static_cache) {
+        updateStaticLayers(scene, ctx, assets, light);
+    }
+
+    light_space.clear();
+
+    framebuffer->bind();
+
     for (uint32_t i = 0; i < split_count; ++i) {
+        auto& frustum = frustums[i];
+
         framebuffer->specifyLayer(FramebufferAttachment::Depth, i);
-        framebuffer->clear();
+
+        if (static_cache) {
+            // cascade keeps cached matrix so dynamic casters are composited on top of static layer
+            frustum.crop = frustum.static_crop;
+
+            const auto& src = static_framebuffer->get(FramebufferAttachment::Depth).texture;
+            const auto& dst = framebuffer->get(FramebufferAttachment::Depth).texture;
+            glCopyImageSubData(src->getId(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i,
+                               dst->getId(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i,
+                               shadow_resolution.x, shadow_resolution.y, 1);
+        } else {
+            framebuffer->clear();
+        }
+
+        light_space.emplace_back(frustum.crop);
 
         const auto uniform_set = [&] (ShaderProgram& shader) {
-            shader.setUniform("light_space", frustums[i].crop);
+            shader.setUniform("light_space", frustum.crop);
         };
 
-        renderer.renderScene({ctx, assets, ShaderType::DirectionalShadow, ms::Blending::Opaque, UniformSetter{uniform_set} });
+        const auto filter = static_cache ? GeometryFilter::Dynamic : GeometryFilter::All;
+        renderer.renderScene({ctx, assets, ShaderType::DirectionalShadow, ms::Blending::Opaque, UniformSetter{uniform_set}, {}, filter});
     }
 
     framebuffer->unbind();
@@ -236,11 +320,21 @@ void CascadeShadows::mapData() const {
 void CascadeShadows::update(const RendererSettings& settings) {
     shadow_resolution = settings.csm_resolution;
     split_count = settings.csm_split_count;
+    static_cache = settings.csm_static_cache;
+    static_cache_margin = settings.csm_static_cache_margin;
 
     initBuffers();
 
     frustums.resize(split_count);
     far_bounds.resize(split_count);
+
+    invalidateStaticCache();
+}
+
+void CascadeShadows::invalidateStaticCache() noexcept {
+    for (auto& frustum : frustums) {
+        frustum.static_valid = false;
+    }
 }
 
 CascadeShadows::~CascadeShadows() {
@@ -51,7 +51,9 @@ Light::Light(const Light& light) noexcept
     , type {light.type}
     , changed {true}
     , removed {light.removed}
-    , hidden {light.hidden} {
+    , hidden {light.hidden}
+    , shadow_cast {light.shadow_cast}
+    , shadow_index {light.shadow_index} {
 }
 
 Light::Light(Light&& light) noexcept
@@ -64,7 +66,9 @@ Light::Light(Light&& light) noexcept
     , type {light.type}
     , changed {true}
     , removed {light.removed}
-    , hidden {light.hidden} {
+    , hidden {light.hidden}
+    , shadow_cast {light.shadow_cast}
+    , shadow_index {light.shadow_index} {
 }
 
 Light& Light::operator=(const Light& light) noexcept {
@@ -78,6 +82,8 @@ Light& Light::operator=(const Light& light) noexcept {
     changed = true;
     removed = light.removed;
     hidden = light.hidden;
+    shadow_cast = light.shadow_cast;
+    shadow_index = light.shadow_index;
     return *this;
 }
 
@@ -92,6 +98,8 @@ Light& Light::operator=(Light&& light) noexcept {
     changed = true;
     removed = light.removed;
     hidden = light.hidden;
+    shadow_cast = light.shadow_cast;
+    shadow_index = light.shadow_index;
     return *this;
 }
 
@@ -199,6 +207,31 @@ void Light::reveal() noexcept {
     change();
 }
 
+bool Light::doesCastShadow() const noexcept {
+    return shadow_cast;
+}
+
+void Light::castShadow() noexcept {
+    shadow_cast = true;
+    change();
+}
+
+void Light::removeShadow() noexcept {
+    shadow_cast = false;
+    change();
+}
+
+int32_t Light::getShadowIndex() const noexcept {
+    return shadow_index;
+}
+
+void Light::setShadowIndex(int32_t index) noexcept {
+    if (shadow_index != index) {
+        shadow_index = index;
+        change();
+    }
+}
+
 bool Light::Builder::isSpot() {
     return color_ != glm::vec4(0.0f) && position_ != glm::vec3(0.0) && inner_angle_ != 0.0f && outer_angle_ != 0.0f && direction_ != glm::vec3(0.0f) && radius_ != 0.0f;
 }
@@ -237,16 +270,25 @@ Light::Builder& Light::Builder::radius(float _radius) noexcept {
     return *this;
 }
 
+Light::Builder& Light::Builder::cast_shadow(bool cast_shadow) noexcept {
+    cast_shadow_ = cast_shadow;
+    return *this;
+}
+
 Light Light::Builder::build() {
     if (isSpot()) {
         if (inner_angle_ < 0.00872665f || inner_angle_ > 90.0f || outer_angle_ < inner_angle_ || outer_angle_ > 90.0f) {
             throw light_builder_exception {"Inner/Outer angles are out of range!"};
         }
-        return {color_, position_, direction_, {inner_angle_, outer_angle_}, radius_};
+        Light light {color_, position_, direction_, {inner_angle_, outer_angle_}, radius_};
+        light.shadow_cast = cast_shadow_;
+        return light;
     }
 
     if (isPoint()) {
-        return {color_, position_, radius_};
+        Light light {color_, position_, radius_};
+        light.shadow_cast = cast_shadow_;
+        return light;
     }
 
     if (isDirectional()) {
@@ -40,7 +40,7 @@ glm::vec2 LightContainer::InternalLight::scaleOffsetToAngles(const glm::vec2& sc
 
 LightContainer::InternalLight::InternalLight(const Light& light) noexcept
     : color {light.getColor()}
-    , position {light.getPosition(), 0.0f}
+    , position {light.getPosition(), static_cast<float>(light.getShadowIndex())}
     , direction {light.getDirection(), 0.0f}
     , scale_offset {anglesToScaleOffset(light.getCone())}
     , falloff {radiusToFalloff(light.getRadius())}
@@ -49,7 +49,7 @@ LightContainer::InternalLight::InternalLight(const Light& light) noexcept
 
 void LightContainer::InternalLight::update(const Light& light) noexcept {
     color = light.getColor();
-    position = {light.getPosition(), 0.0f};
+    position = {light.getPosition(), static_cast<float>(light.getShadowIndex())};
     direction = {light.getDirection(), 0.0f};
     scale_offset = anglesToScaleOffset(light.getCone());
     falloff = radiusToFalloff(light.getRadius());
@@ -0,0 +1,445 @@
+#include <limitless/lighting/local_shadows.hpp>
+
+#include <limitless/core/texture/texture_builder.hpp>
+#include <limitless/core/buffer/buffer_builder.hpp>
+#include <limitless/core/shader/shader_program.hpp>
+#include <limitless/core/uniform/uniform_setter.hpp>
+
+#include <limitless/ms/blending.hpp>
+#include <limitless/lighting/light.hpp>
+#include <limitless/renderer/instance_renderer.hpp>
+#include <limitless/camera.hpp>
+#include <limitless/scene.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+namespace {
+    constexpr auto LOCAL_SHADOWS_BUFFER_NAME = "local_shadows";
+    constexpr auto SHADOW_NEAR_PLANE = 0.05f;
+}
+
+void LocalShadows::initBuffers(uint32_t atlas_resolution) {
+    auto depth = Texture::builder()
+            .target(Texture::Type::Tex2D)
+            .internal_format(Texture::InternalFormat::Depth24)
+            .size(glm::uvec2{atlas_resolution})
+            .format(Texture::Format::DepthComponent)
+            .data_type(Texture::DataType::Float)
+            .mipmap(false)
+            .levels(1)
+            .min_filter(Texture::Filter::Nearest)
+            .mag_filter(Texture::Filter::Nearest)
+            .wrap_s(Texture::Wrap::ClampToEdge)
+            .wrap_t(Texture::Wrap::ClampToEdge)
+            .build();
+
+    framebuffer = std::make_unique<Framebuffer>();
+    framebuffer->bind();
+    *framebuffer << TextureAttachment{FramebufferAttachment::Depth, depth};
+    framebuffer->drawBuffer(FramebufferAttachment::None);
+    framebuffer->readBuffer(FramebufferAttachment::None);
+    framebuffer->checkStatus();
+    framebuffer->unbind();
+
+    buffer = Buffer::builder()
+          .target(Buffer::Type::ShaderStorage)
+          .usage(Buffer::Usage::DynamicDraw)
+          .access(Buffer::MutableAccess::WriteOrphaning)
+          .size(sizeof(ShadowData) * MAX_SHADOWED_LIGHTS)
+          .build(LOCAL_SHADOWS_BUFFER_NAME, *Context::getCurrentContext());
+}
+
+LocalShadows::LocalShadows(const RendererSettings& settings)
+    : atlas {settings.local_shadows_atlas_resolution, settings.local_shadows_min_resolution}
+    , texel_budget {settings.local_shadows_texel_budget}
+    , update_budget {settings.local_shadows_update_budget}
+    , min_resolution {atlas.getMinSize()}
+    , max_resolution {glm::clamp(ShadowAtlas::roundToPowerOfTwo(settings.local_shadows_max_resolution), atlas.getMinSize(), atlas.getSize())} {
+    initBuffers(atlas.getSize());
+    data.reserve(MAX_SHADOWED_LIGHTS);
+}
+
+LocalShadows::~LocalShadows() {
+    if (auto* ctx = Context::getCurrentContext(); ctx) {
+        ctx->getIndexedBuffers().remove(LOCAL_SHADOWS_BUFFER_NAME, buffer);
+    }
+}
+
+void LocalShadows::update(const RendererSettings& settings) {
+    texel_budget = settings.local_shadows_texel_budget;
+    update_budget = settings.local_shadows_update_budget;
+
+    // budgets apply from next frame, rendered views are dropped only when atlas layout changes
+    ShadowAtlas resized {settings.local_shadows_atlas_resolution, settings.local_shadows_min_resolution};
+    const auto resized_max = glm::clamp(ShadowAtlas::roundToPowerOfTwo(settings.local_shadows_max_resolution), resized.getMinSize(), resized.getSize());
+    if (resized.getSize() == atlas.getSize() && resized.getMinSize() == atlas.getMinSize() && resized_max == max_resolution) {
+        return;
+    }
+
+    atlas = std::move(resized);
+    min_resolution = atlas.getMinSize();
+    max_resolution = resized_max;
+
+    // all regions are gone with old atlas, states are rebuilt next frame
+    for (auto& [_, state] : states) {
+        for (auto& view : state.views) {
+            view = {};
+        }
+        state.requested_resolution = 0;
+        state.resolution = 0;
+    }
+
+    for (auto& shadow : data) {
+        shadow = {};
+    }
+
+    initBuffers(atlas.getSize());
+}
+
+uint32_t LocalShadows::getUpdatePeriod(float distance, float radius) noexcept {
+    const auto ratio = distance / glm::max(radius, 0.001f);
+
+    if (ratio < 2.0f) {
+        return 1;
+    }
+
+    if (ratio < 4.0f) {
+        return 2;
+    }
+
+    if (ratio < 8.0f) {
+        return 4;
+    }
+
+    return 8;
+}
+
+glm::mat4 LocalShadows::getLightSpace(const Light& light, uint32_t view) noexcept {
+    const auto position = light.getPosition();
+    const auto far = glm::max(light.getRadius(), SHADOW_NEAR_PLANE * 2.0f);
+
+    if (light.isSpot()) {
+        const auto direction = glm::normalize(light.getDirection());
+        const auto up = glm::abs(direction.y) > 0.999f ? glm::vec3{0.0f, 0.0f, 1.0f} : glm::vec3{0.0f, 1.0f, 0.0f};
+        const auto fov = glm::min(glm::radians(light.getCone().y * 2.0f), glm::radians(170.0f));
+
+        return glm::perspective(fov, 1.0f, SHADOW_NEAR_PLANE, far) * glm::lookAt(position, position + direction, up);
+    }
+
+    // cube faces in +X, -X, +Y, -Y, +Z, -Z order
+    static const glm::vec3 directions[MAX_VIEWS] = {
+        { 1.0f,  0.0f,  0.0f}, {-1.0f,  0.0f,  0.0f},
+        { 0.0f,  1.0f,  0.0f}, { 0.0f, -1.0f,  0.0f},
+        { 0.0f,  0.0f,  1.0f}, { 0.0f,  0.0f, -1.0f},
+    };
+    static const glm::vec3 ups[MAX_VIEWS] = {
+        { 0.0f, -1.0f,  0.0f}, { 0.0f, -1.0f,  0.0f},
+        { 0.0f,  0.0f,  1.0f}, { 0.0f,  0.0f, -1.0f},
+        { 0.0f, -1.0f,  0.0f}, { 0.0f, -1.0f,  0.0f},
+    };
+
+    return glm::perspective(glm::radians(90.0f), 1.0f, SHADOW_NEAR_PLANE, far) * glm::lookAt(position, position + directions[view], ups[view]);
+}
+
+int32_t LocalShadows::acquireSlot() {
+    if (!free_slots.empty()) {
+        const auto slot = free_slots.back();
+        free_slots.pop_back();
+        return slot;
+    }
+
+    if (data.size() < MAX_SHADOWED_LIGHTS) {
+        data.emplace_back();
+        return static_cast<int32_t>(data.size() - 1);
+    }
+
+    return -1;
+}
+
+void LocalShadows::releaseSlot(ShadowState& state) {
+    if (state.slot < 0) {
+        return;
+    }
+
+    data[state.slot] = {};
+    free_slots.emplace_back(state.slot);
+    state.slot = -1;
+}
+
+void LocalShadows::releaseRegions(ShadowState& state) {
+    for (uint32_t i = 0; i < MAX_VIEWS; ++i) {
+        auto& view = state.views[i];
+
+        if (view.region) {
+            atlas.free(*view.region);
+        }
+
+        view = {};
+
+        if (state.slot >= 0) {
+            data[state.slot].regions[i] = glm::vec4{0.0f};
+        }
+    }
+
+    state.resolution = 0;
+}
+
+bool LocalShadows::allocateRegions(ShadowState& state, uint32_t resolution) {
+    for (uint32_t i = 0; i < state.view_count; ++i) {
+        auto region = atlas.allocate(resolution);
+
+        if (!region) {
+            releaseRegions(state);
+            return false;
+        }
+
+        state.views[i].region = region;
+        state.views[i].valid = false;
+    }
+
+    state.resolution = resolution;
+    stats.allocated_views += state.view_count;
+    return true;
+}
+
+void LocalShadows::updateStates(Lighting& lighting, const Camera& camera, glm::uvec2 screen) {
+    for (auto& [_, state] : states) {
+        state.seen = false;
+    }
+
+    // collects shadow casting lights with their screen-space size
+    candidates.clear();
+
+    const auto projection_scale = static_cast<float>(screen.y) / glm::tan(glm::radians(camera.getFov()) * 0.5f);
+    for (auto& [id, light] : lighting.getLights()) {
+        if (!light.doesCastShadow() || light.isHidden() || light.isRemoved() || light.isDirectional()) {
+            continue;
+        }
+
+        const auto distance = glm::distance(camera.getPosition(), light.getPosition());
+        const auto pixels = distance > light.getRadius()
+                ? light.getRadius() * projection_scale / distance
+                : static_cast<float>(max_resolution);
+
+        auto& state = states[id];
+        state.seen = true;
+
+        candidates.push_back({&light, &state, pixels, distance, 0});
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [] (const auto& a, const auto& b) {
+        return a.pixels > b.pixels;
+    });
+
+    // assigns resolutions by importance within texel budget
+    auto remaining = texel_budget;
+    for (auto& candidate : candidates) {
+        const auto views = candidate.light->isPoint() ? MAX_VIEWS : 1u;
+        const auto texels = [&] (uint64_t resolution) { return resolution * resolution * views; };
+
+        auto resolution = glm::clamp(ShadowAtlas::roundToPowerOfTwo(static_cast<uint32_t>(candidate.pixels)), min_resolution, max_resolution);
+        while (resolution > min_resolution && texels(resolution) > remaining) {
+            resolution /= 2;
+        }
+
+        if (texels(resolution) > remaining) {
+            resolution = 0;
+        } else {
+            remaining -= texels(resolution);
+        }
+
+        auto& state = *candidate.state;
+        candidate.resolution = resolution;
+
+        // regions are kept while request is the same, even if they are smaller than requested
+        if (state.requested_resolution != resolution || state.view_count != views) {
+            releaseRegions(state);
+        }
+
+        state.requested_resolution = resolution;
+        state.view_count = views;
+        state.importance = candidate.pixels;
+        state.period = getUpdatePeriod(candidate.distance, candidate.light->getRadius());
+    }
+
+    // removes states of lights that are gone or do not cast shadows anymore
+    for (auto it = states.begin(); it != states.end();) {
+        auto& [id, state] = *it;
+
+        if (state.seen) {
+            ++it;
+            continue;
+        }
+
+        releaseRegions(state);
+        releaseSlot(state);
+
+        if (auto light = lighting.getLights().find(id); light != lighting.getLights().end()) {
+            light->second.setShadowIndex(-1);
+        }
+
+        it = states.erase(it);
+    }
+
+    // allocates regions after all stale ones are freed
+    for (auto& candidate : candidates) {
+        auto& state = *candidate.state;
+        auto& light = *candidate.light;
+
+        if (candidate.resolution != 0 && state.resolution == 0) {
+            auto resolution = candidate.resolution;
+            while (!allocateRegions(state, resolution) && resolution > min_resolution) {
+                resolution /= 2;
+            }
+        }
+
+        if (state.resolution != 0 && state.slot < 0) {
+            state.slot = acquireSlot();
+        }
+
+        if (state.resolution == 0 || state.slot < 0) {
+            releaseRegions(state);
+            releaseSlot(state);
+            light.setShadowIndex(-1);
+            continue;
+        }
+
+        light.setShadowIndex(state.slot);
+
+        // moved or changed lights are redrawn with priority
+        if (state.position != light.getPosition() || state.direction != light.getDirection() ||
+            state.cone != light.getCone() || state.radius != light.getRadius()) {
+            state.position = light.getPosition();
+            state.direction = light.getDirection();
+            state.cone = light.getCone();
+            state.radius = light.getRadius();
+
+            for (auto& view : state.views) {
+                view.dirty = true;
+            }
+        }
+    }
+}
+
+void LocalShadows::scheduleUpdates() {
+    requests.clear();
+
+    for (auto& candidate : candidates) {
+        auto& state = *candidate.state;
+
+        if (state.resolution == 0) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < state.view_count; ++i) {
+            const auto& view = state.views[i];
+            const auto age = static_cast<float>(frame - view.last_update);
+
+            float priority;
+            if (!view.valid) {
+                priority = 1e9f + state.importance;
+            } else if (view.dirty) {
+                priority = 1e6f + state.importance;
+            } else if (age >= static_cast<float>(state.period)) {
+                priority = age / static_cast<float>(state.period) * state.importance;
+            } else {
+                continue;
+            }
+
+            requests.push_back({candidate.light, &state, i, priority});
+        }
+    }
+
+    const auto count = glm::min(static_cast<size_t>(update_budget), requests.size());
+    std::partial_sort(requests.begin(), requests.begin() + count, requests.end(), [] (const auto& a, const auto& b) {
+        return a.priority > b.priority;
+    });
+    requests.resize(count);
+}
+
+void LocalShadows::renderView(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Light& light, ShadowState& state, uint32_t index) {
+    auto& view = state.views[index];
+    const auto& region = *view.region;
+
+    view.light_space = getLightSpace(light, index);
+
+    // clears only region of current view
+    ctx.setViewPort(glm::uvec4{region.origin, region.size, region.size});
+    ctx.setScissorTest(region.origin, glm::uvec2{region.size});
+    framebuffer->clear();
+
+    const auto uniform_set = [&] (ShaderProgram& shader) {
+        shader.setUniform("light_space", view.light_space);
+    };
+
+    // casters out of camera view still shadow what camera sees, so instances are culled by view of light
+    const DrawParameters drawp {ctx, assets, ShaderType::DirectionalShadow, ms::Blending::Opaque, UniformSetter{uniform_set}};
+    InstanceRenderer::renderIntersecting(scene, Frustum {view.light_space}, drawp);
+    renderer.renderEffects(drawp);
+
+    view.valid = true;
+    view.dirty = false;
+    view.last_update = frame;
+
+    const auto atlas_size = static_cast<float>(atlas.getSize());
+    auto& shadow = data[state.slot];
+    shadow.light_space[index] = view.light_space;
+    shadow.regions[index] = glm::vec4{glm::vec2{region.origin} / atlas_size, glm::vec2{static_cast<float>(region.size) / atlas_size}};
+}
+
+void LocalShadows::prepare(Lighting& lighting, const Camera& camera, glm::uvec2 screen) {
+    ++frame;
+    stats.allocated_views = 0;
+
+    updateStates(lighting, camera, screen);
+    scheduleUpdates();
+
+    stats.shadowed_lights = 0;
+    for (const auto& [_, state] : states) {
+        stats.shadowed_lights += state.resolution != 0 ? 1 : 0;
+    }
+    stats.rendered_views = requests.size();
+    stats.used_texels = atlas.getAllocatedTexels();
+}
+
+void LocalShadows::draw(InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera) {
+    prepare(scene.getLighting(), camera, ctx.getSize());
+
+    if (requests.empty()) {
+        return;
+    }
+
+    const auto viewport = ctx.getViewPort();
+
+    framebuffer->bind();
+
+    ctx.setDepthMask(DepthMask::True);
+    ctx.setDepthFunc(DepthFunc::Less);
+    ctx.enable(Capabilities::DepthTest);
+    ctx.enable(Capabilities::ScissorTest);
+
+    for (const auto& request : requests) {
+        renderView(renderer, scene, ctx, assets, *request.light, *request.state, request.view);
+    }
+
+    ctx.disable(Capabilities::ScissorTest);
+    ctx.setViewPort(viewport);
+
+    framebuffer->unbind();
+}
+
+void LocalShadows::setUniform(ShaderProgram& shader) const {
+    if (auto* ctx = Context::getCurrentContext(); ctx) {
+        buffer->bindBase(ctx->getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, LOCAL_SHADOWS_BUFFER_NAME));
+    }
+
+    shader.setUniform("_local_shadow_atlas", framebuffer->get(FramebufferAttachment::Depth).texture);
+}
+
+void LocalShadows::mapData() const {
+    if (!data.empty()) {
+        buffer->mapData(data.data(), data.size() * sizeof(ShadowData));
+    }
+}
@@ -0,0 +1,131 @@
+#include <limitless/lighting/shadow_atlas.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+ShadowAtlas::ShadowAtlas(uint32_t _size, uint32_t _min_size)
+    : size {roundToPowerOfTwo(_size)}
+    , min_size {roundToPowerOfTwo(glm::min(_min_size, _size))} {
+    for (uint32_t node_size = size, count = 1; node_size >= min_size; node_size /= 2, count *= 4) {
+        levels.emplace_back(count, NodeState::Free);
+    }
+}
+
+uint32_t ShadowAtlas::roundToPowerOfTwo(uint32_t value) noexcept {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+uint32_t ShadowAtlas::getNodeSize(uint32_t level) const noexcept {
+    return size >> level;
+}
+
+uint32_t ShadowAtlas::getNodeIndex(uint32_t level, uint32_t x, uint32_t y) noexcept {
+    return y * (1u << level) + x;
+}
+
+std::optional<ShadowAtlas::Region> ShadowAtlas::allocate(uint32_t level, uint32_t x, uint32_t y, uint32_t target) {
+    auto& state = levels[level][getNodeIndex(level, x, y)];
+
+    if (state == NodeState::Occupied) {
+        return std::nullopt;
+    }
+
+    if (level == target) {
+        if (state != NodeState::Free) {
+            return std::nullopt;
+        }
+
+        state = NodeState::Occupied;
+
+        const auto node_size = getNodeSize(level);
+        return Region {{x * node_size, y * node_size}, node_size, level};
+    }
+
+    // prefers already split children to keep free nodes as large as possible
+    for (auto pass : {NodeState::Split, NodeState::Free}) {
+        if (state == NodeState::Free && pass == NodeState::Split) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i < 4; ++i) {
+            const auto cx = x * 2 + (i & 1u);
+            const auto cy = y * 2 + (i >> 1u);
+
+            if (levels[level + 1][getNodeIndex(level + 1, cx, cy)] != pass) {
+                continue;
+            }
+
+            if (auto region = allocate(level + 1, cx, cy, target); region) {
+                state = NodeState::Split;
+                return region;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::optional<ShadowAtlas::Region> ShadowAtlas::allocate(uint32_t region_size) {
+    const auto rounded = glm::clamp(roundToPowerOfTwo(region_size), min_size, size);
+
+    uint32_t target = 0;
+    while (getNodeSize(target) > rounded) {
+        ++target;
+    }
+
+    auto region = allocate(0, 0, 0, target);
+    if (region) {
+        allocated_texels += static_cast<uint64_t>(region->size) * region->size;
+    }
+
+    return region;
+}
+
+void ShadowAtlas::free(const Region& region) {
+    auto level = region.level;
+    auto x = region.origin.x / region.size;
+    auto y = region.origin.y / region.size;
+
+    auto& state = levels[level][getNodeIndex(level, x, y)];
+    if (state != NodeState::Occupied) {
+        return;
+    }
+
+    state = NodeState::Free;
+    allocated_texels -= static_cast<uint64_t>(region.size) * region.size;
+
+    // merges free siblings into parent
+    while (level > 0) {
+        const auto px = x / 2;
+        const auto py = y / 2;
+
+        bool all_free = true;
+        for (uint32_t i = 0; i < 4; ++i) {
+            if (levels[level][getNodeIndex(level, px * 2 + (i & 1u), py * 2 + (i >> 1u))] != NodeState::Free) {
+                all_free = false;
+                break;
+            }
+        }
+
+        if (!all_free) {
+            break;
+        }
+
+        --level;
+        x = px;
+        y = py;
+        levels[level][getNodeIndex(level, x, y)] = NodeState::Free;
+    }
+}
+
+void ShadowAtlas::clear() {
+    for (auto& level : levels) {
+        std::fill(level.begin(), level.end(), NodeState::Free);
+    }
+    allocated_texels = 0;
+}
@@ -2,8 +2,9 @@
 #include <limitless/loaders/texture_loader.hpp>
 #include <limitless/core/texture/texture_builder.hpp>
 #include <limitless/util/filesystem.hpp>
-#include <fstream>
+#include <limitless/assets.hpp>
 #include <iostream>
+#include <optional>
 
 using namespace Limitless;
 
@@ -50,14 +51,11 @@ std::size_t DDSLoader::getDXTByteCount(glm::uvec2 size, std::size_t block_size)
     return s.x * s.y * block_size;
 }
 
-void DDSLoader::loadLevel(std::shared_ptr<Texture>& texture, std::ifstream& fs, uint32_t level, int channels) {
+void DDSLoader::loadLevel(std::shared_ptr<Texture>& texture, ByteReader& reader, uint32_t level, int channels) {
     const auto s = glm::clamp(texture->getSize() >> level, 1u, std::numeric_limits<uint32_t>::max());
     const auto byte_count = getDXTByteCount(s, channels == 3 ? DXT1_BLOCK_SIZE : DXT5_BLOCK_SIZE);
 
-    auto* data = new uint8_t[byte_count];
-    fs.read(reinterpret_cast<char*>(data), byte_count);
-    texture->compressedImage(level, static_cast<glm::uvec2>(s), data, byte_count);
-    delete[] data;
+    texture->compressedImage(level, static_cast<glm::uvec2>(s), reader.view(byte_count).data(), byte_count);
 }
 
 std::shared_ptr<Texture> DDSLoader::load(Assets& assets, const fs::path& _path, const TextureLoaderFlags& flags) {
@@ -67,23 +65,21 @@ std::shared_ptr<Texture> DDSLoader::load(Assets& assets, const fs::path& _path,
         return assets.textures[path.stem().string()];
     }
 
-    std::ifstream fs;
-	fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
+    std::optional<AssetFile> file;
 	try {
-		fs.open(path, std::ios::binary);
+		file.emplace(assets.archives.open(path));
 	} catch (const std::exception& e) {
 		throw dds_loader_exception{"Cant open " + path.string()};
 	}
 
-    std::array<char, 4> code {0};
-    fs.read(code.data(), code.size());
-    if (std::string(code.data(), code.size()) != DDS_CODE) {
+    // level data is uploaded straight from file contents
+    auto reader = file->reader();
+    if (reader.remaining() < 4 + sizeof(DDSHEADER) || reader.view(4) != DDS_CODE) {
         throw dds_loader_exception{"It is not a DDS file!"};
     }
 
     DDSHEADER header {};
-    fs.read(reinterpret_cast<char*>(&header), sizeof(DDSHEADER));
+    reader >> header;
 
     Texture::Builder& builder = Texture::builder().target(Texture::Type::Tex2D);
 
@@ -129,22 +125,19 @@ std::shared_ptr<Texture> DDSLoader::load(Assets& assets, const fs::path& _path,
 			byte_count += getDXTByteCount(size, channels == 3 ? DXT1_BLOCK_SIZE : DXT5_BLOCK_SIZE);
 			size = size >> 1u;
 		}
-		fs.seekg(byte_count, std::ios_base::cur);
+		reader.seek(reader.tell() + byte_count);
 	}
     builder.size(size);
 	const auto byte_count = getDXTByteCount(size, channels == 3 ? DXT1_BLOCK_SIZE : DXT5_BLOCK_SIZE);
-	auto* data = new uint8_t[byte_count];
-	fs.read(reinterpret_cast<char*>(data), byte_count);
-    builder.compressed_data(data, byte_count);
+    builder.compressed_data(reader.view(byte_count).data(), byte_count);
 	TextureLoader::setTextureParameters(builder, flags);
     builder.path(path);
 	auto texture = builder.buildMutable();
-	delete[] data;
 
     if (flags.mipmap) {
         const auto mipmap_count = (level == header.dwMipMapCount - 1) ? 0 : (header.dwMipMapCount - 1) - level;
         for (uint32_t i = 0; i < mipmap_count; ++i) {
-            loadLevel(texture, fs, i + 1, channels);
+            loadLevel(texture, reader, i + 1, channels);
         }
     }
 
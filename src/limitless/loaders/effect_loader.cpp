@@ -14,17 +14,11 @@ using namespace Limitless;
 
 std::shared_ptr<EffectInstance> EffectLoader::load(Assets& assets, const fs::path& _path) {
     auto path = convertPathSeparators(_path);
-    std::ifstream stream(path, std::ios::binary | std::ios::ate);
-    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
-    auto filesize = stream.tellg();
-    ByteBuffer buffer{static_cast<size_t>(filesize)};
-
-    stream.seekg(0, std::ios::beg);
-    stream.read(buffer.cdata(), buffer.size());
+    const auto file = assets.archives.open(path);
+    auto reader = file.reader();
 
     std::shared_ptr<EffectInstance> effect;
-    buffer >> AssetDeserializer<std::shared_ptr<EffectInstance>>{assets, effect};
+    reader >> AssetDeserializer<std::shared_ptr<EffectInstance>>{assets, effect};
     return effect;
 }
 
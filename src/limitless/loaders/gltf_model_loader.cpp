@@ -13,6 +13,7 @@
 #include <limitless/instances/model_instance.hpp>
 #include <limitless/instances/skeletal_instance.hpp>
 #include <limitless/loaders/gltf_model_loader.hpp>
+#include <limitless/loaders/model_cache.hpp>
 #include <limitless/models/abstract_mesh.hpp>
 #include <limitless/models/abstract_model.hpp>
 #include <limitless/models/bones.hpp>
@@ -120,14 +121,19 @@ static std::vector<ElemType> copyFromAccessor(const cgltf_accessor& accessor) {
 			+ toString(accessor.component_type)};
 	}
 
-	std::vector<ElemType> result;
-	result.reserve(accessor.count);
+	std::vector<ElemType> result(accessor.count);
 
 	const uint8_t* data = static_cast<const uint8_t*>(accessor.buffer_view->buffer->data)
 	                      + accessor.buffer_view->offset + accessor.offset;
 
+	// tightly packed accessor is copied at once
+	if (accessor.stride == sizeof(ElemType)) {
+		std::memcpy(result.data(), data, accessor.count * sizeof(ElemType));
+		return result;
+	}
+
 	for (cgltf_size i = 0; i < accessor.count; ++i) {
-		result.emplace_back(*reinterpret_cast<const ElemType*>(data));
+		std::memcpy(&result[i], data, sizeof(ElemType));
 		data += accessor.stride;
 	}
 
@@ -240,29 +246,25 @@ static std::string generateMeshName(const std::string& model_name, size_t mesh_i
 	return model_name + "_mesh" + std::to_string(mesh_index);
 }
 
-// TODO: return std::vector of mesh + material.
-// Note that material pointer can be empty if mesh does not have material.
-static std::pair<std::vector<std::shared_ptr<AbstractMesh>>, std::vector<std::shared_ptr<ms::Material>>>
-loadMeshes(
+// Mesh material is an index of source material, meshes without one get dummy material later.
+static std::vector<ModelData::Mesh> loadMeshes(
 	const cgltf_node& node,
 	const cgltf_mesh& mesh,
 	const cgltf_skin* skin,
 	const std::string& model_name,
 	size_t mesh_index,
-	const std::vector<std::shared_ptr<ms::Material>>& materials,
 	const cgltf_data& data,
     const ModelLoaderFlags& flags
 ) {
 	auto base_mesh_name =
 		std::string(mesh.name ? mesh.name : generateMeshName(model_name, mesh_index));
-	std::vector<std::shared_ptr<AbstractMesh>> meshes;
-	std::vector<std::shared_ptr<ms::Material>> mesh_materials;
+	std::vector<ModelData::Mesh> meshes;
 
-	auto select_mesh_material = [&](const cgltf_primitive& primitive) -> std::shared_ptr<ms::Material> {
+	auto select_mesh_material = [&](const cgltf_primitive& primitive) -> uint32_t {
 		if (!primitive.material) {
-			return {nullptr};
+			return ModelData::NO_MATERIAL;
 		}
-		return materials.at(cgltf_material_index(&data, primitive.material));
+		return static_cast<uint32_t>(cgltf_material_index(&data, primitive.material));
 	};
 
 	auto mesh_matrix = getNodeMatrix(node);
@@ -436,6 +438,10 @@ loadMeshes(
 				uv});
 		}
 
+		ModelData::Mesh result;
+		result.name = mesh_name + std::to_string(i);
+		result.material = select_mesh_material(primitive);
+
 		if (!skin) {
 			// plain mesh.
 
@@ -446,21 +452,8 @@ loadMeshes(
 				vertice.position = glm::vec3(model_position.x, model_position.y, model_position.z);
 			}
 
-			auto stream = std::make_unique<IndexedVertexStream<VertexNormalTangent>>(
-				std::move(vertices),
-				std::move(indices),
-				VertexStreamUsage::Static,
-				VertexStreamDraw::Triangles
-			);
-
-			auto result = std::make_shared<Mesh>(std::move(stream), mesh_name + std::to_string(i));
-
-			meshes.emplace_back(std::move(result));
-			mesh_materials.emplace_back(select_mesh_material(primitive));
-
 		} else {
 			// skeletal mesh.
-			std::vector<VertexBoneWeight> vertex_bone_weights;
 			if (positions.size() != bone_weights.size()
 			    || positions.size() != bone_indices.size()) {
 				throw "mismatching count of vertex bone attributes: "
@@ -469,36 +462,30 @@ loadMeshes(
 					+ std::to_string(bone_indices.size()) + " bone indices";
 			}
 
-			vertex_bone_weights.reserve(positions.size());
+			result.bone_weights.reserve(positions.size());
 			for (size_t i = 0; i < positions.size(); ++i) {
-				vertex_bone_weights.emplace_back(VertexBoneWeight {bone_indices[i], bone_weights[i]}
+				result.bone_weights.emplace_back(VertexBoneWeight {bone_indices[i], bone_weights[i]}
 				);
 			}
+			result.skinned = true;
+		}
 
-			auto stream = std::make_unique<SkinnedVertexStream<VertexNormalTangent>>(
-				std::move(vertices),
-				std::move(indices),
-				std::move(vertex_bone_weights),
-				VertexStreamUsage::Static,
-				VertexStreamDraw::Triangles
-			);
-
-			auto result = std::make_shared<Mesh>(std::move(stream), mesh_name + std::to_string(i));
+		result.vertices = std::move(vertices);
+		result.indices = std::move(indices);
 
-			meshes.emplace_back(std::move(result));
-			mesh_materials.emplace_back(select_mesh_material(primitive));
-		}
+		meshes.emplace_back(std::move(result));
 	}
 
-	return {meshes, mesh_materials};
+	return meshes;
 }
 
-Animation loadAnimation(
+static ModelData::Animation loadAnimation(
 	std::string anim_name,
 	const cgltf_animation& animation,
-	const std::unordered_map<const cgltf_node*, Bone*>& bone_map
+	const std::unordered_map<const cgltf_node*, uint32_t>& bone_map
 ) {
-	std::unordered_map<cgltf_node*, AnimationNode> anim_nodes;
+	std::vector<ModelData::AnimationNode> anim_nodes;
+	std::unordered_map<const cgltf_node*, size_t> anim_node_indices;
 	double max_time = 0.f;
 
 	for (size_t i = 0; i < animation.channels_count; ++i) {
@@ -514,14 +501,17 @@ Animation loadAnimation(
 
 		auto keyframe_times = copyFromAccessor<float>(*sampler.input);
 
-		if (bone_map.find(channel.target_node) == bone_map.end()) {
+		const auto bone = bone_map.find(channel.target_node);
+		if (bone == bone_map.end()) {
 			throw ModelLoadError {"failed to find bone for this node"};
 		}
 
-		Bone& bone = *bone_map.at(channel.target_node);
 		// Get or create animation node for this bone if missing.
-		auto it = anim_nodes.emplace(channel.target_node, AnimationNode({}, {}, {}, bone));
-		AnimationNode& anim_node = it.first->second;
+		auto it = anim_node_indices.emplace(channel.target_node, anim_nodes.size());
+		if (it.second) {
+			anim_nodes.emplace_back().bone = bone->second;
+		}
+		ModelData::AnimationNode& anim_node = anim_nodes[it.first->second];
 
 		switch (sampler.interpolation) {
 		case cgltf_interpolation_type_linear:
@@ -605,17 +595,12 @@ Animation loadAnimation(
 		}
 	}
 
-	std::vector<AnimationNode> flat_animation_nodes;
-	for (auto& [_, anim_node] : anim_nodes) {
-		flat_animation_nodes.emplace_back(std::move(anim_node));
-	}
-
-	return Animation {std::move(anim_name), max_time, 1.0f, std::move(flat_animation_nodes)};
+	return ModelData::Animation {std::move(anim_name), max_time, 1.0, std::move(anim_nodes)};
 }
 
 static std::vector<Tree<uint32_t>> makeBoneIndiceTrees(
 	const std::vector<const cgltf_node*>& roots,
-	const std::unordered_map<const cgltf_node*, Bone*>& bone_map
+	const std::unordered_map<const cgltf_node*, uint32_t>& bone_map
 ) {
 	std::vector<Tree<uint32_t>> result;
 
@@ -624,16 +609,14 @@ static std::vector<Tree<uint32_t>> makeBoneIndiceTrees(
 	dfs = [&](Tree<uint32_t>& tree, const cgltf_node& node, int depth) {
 		for (size_t i = 0; i < node.children_count; ++i) {
 			const auto& child_node = *node.children[i];
-			const auto& child_bone = *bone_map.at(&child_node);
 
-			auto& child_tree = tree.add(child_bone.index);
+			auto& child_tree = tree.add(bone_map.at(&child_node));
 			dfs(child_tree, child_node, depth + 1);
 		}
 	};
 
 	for (const auto* root : roots) {
-		const auto& bone = bone_map.at(root);
-		result.emplace_back(bone->index);
+		result.emplace_back(bone_map.at(root));
 		dfs(result.back(), *root, 0);
 	}
 
@@ -657,37 +640,30 @@ static std::string generateMaterialName(const std::string& model_name, size_t ma
 	return model_name + "_material" + std::to_string(material_index);
 }
 
-static std::shared_ptr<ms::Material> loadMaterial(
-	Assets& assets,
-	const InstanceTypes& instance_types,
-	const fs::path& base_path,
+// Describes material of source file, embedded images are copied to description, so it does not refer to source.
+static ModelData::Material describeMaterial(
 	const cgltf_material& material,
 	const std::string& model_name,
-	size_t material_index,
-    [[maybe_unused]] const ModelLoaderFlags& flags
+	size_t material_index
 ) {
-	ms::Material::Builder builder = ms::Material::builder();
-	const auto material_name = model_name + (material.name
+	ModelData::Material description;
+	description.name = model_name + (material.name
 		? std::string(material.name)
 		: generateMaterialName(model_name, material_index));
 
-	builder
-		.name(material_name)
-		.shading(material.unlit ? ms::Shading::Unlit : ms::Shading::Lit)
-		.two_sided(material.double_sided);
+	description.unlit = material.unlit;
+	description.two_sided = material.double_sided;
 
 	switch (material.alpha_mode) {
 	case cgltf_alpha_mode_opaque:
-		builder.blending(ms::Blending::Opaque);
+		description.blending = ms::Blending::Opaque;
 		break;
 	case cgltf_alpha_mode_blend:
-		builder.blending(ms::Blending::Translucent);
+		description.blending = ms::Blending::Translucent;
 		break;
     case cgltf_alpha_mode_mask:
-        builder.blending(ms::Blending::Opaque);
-        //TODO: add to material built-in
-        builder.custom("alpha_cutoff", material.alpha_cutoff);
-        builder.fragment("if (mctx.diffuse.a <= alpha_cutoff) discard;");
+        description.blending = ms::Blending::Opaque;
+        description.alpha_cutoff = material.alpha_cutoff;
         break;
 	default:
 		throw ModelLoadError {"alpha mode " + std::to_string(material.alpha_mode) + " not supported"};
@@ -736,7 +712,7 @@ static std::shared_ptr<ms::Material> loadMaterial(
 	    return output;
 	};
 
-	auto loadTextureFrom = [&](cgltf_texture& tex, std::string name, TextureLoaderFlags flags) -> std::optional<std::shared_ptr<Texture>> {
+	auto describeTexture = [&](cgltf_texture& tex, std::string name, TextureLoaderFlags flags) -> std::optional<ModelData::Texture> {
 		if (!tex.image) {
 			return std::nullopt;
 		}
@@ -828,51 +804,46 @@ static std::shared_ptr<ms::Material> loadMaterial(
 			flags.wrapping = *wrap_t_mode;
 		}
 
+		ModelData::Texture texture;
+
 		if (img.uri == nullptr) {
 			if (!img.buffer_view) {
 				throw ModelLoadError {"texture has no uri and no buffer view"};
 			}
 
-			return TextureLoader::load(
-				assets,
-				name,
-				cgltf_buffer_view_data(img.buffer_view),
-				img.buffer_view->size
-			);
+			// images of buffers are loaded with default flags
+			const auto* data = static_cast<const uint8_t*>(cgltf_buffer_view_data(img.buffer_view));
+			texture.name = std::move(name);
+			texture.bytes.assign(data, data + img.buffer_view->size);
 
 		} else {
 			if (strncmp(img.uri, "data:", 5) == 0) {
 				const char* comma = strchr(img.uri, ',');
 
 				if (comma && comma - img.uri >= 7 && strncmp(comma - 7, ";base64", 7) == 0) {
-					auto buffer = bytesFromBase64(comma + 1);
-
-					return TextureLoader::load(
-						assets,
-						name,
-						buffer.data(),
-						buffer.size(),
-						flags
-					);
+					texture.name = std::move(name);
+					texture.bytes = bytesFromBase64(comma + 1);
+					texture.flags = flags;
 				} else {
 					throw ModelLoadError {"unknown data uri"};
 				}
 
 			} else {
-				const auto path = base_path / fs::path(img.uri);
-				return TextureLoader::load(assets, path, flags);
+				texture.path = img.uri;
+				texture.flags = flags;
 			}
 		}
+
+		return texture;
 	};
 
 	const auto& pbr_mr   = material.pbr_metallic_roughness;
 	auto* base_color_tex = pbr_mr.base_color_texture.texture;
 
-	if (base_color_tex == nullptr) {
-		// no texture, this means that base color factor is the color.
-		builder.color(toVec4(pbr_mr.base_color_factor));
+	// base color factor is the color without texture and multiplies it otherwise
+	description.color = toVec4(pbr_mr.base_color_factor);
 
-	} else {
+	if (base_color_tex != nullptr) {
 		if (base_color_tex->image == nullptr) {
 			throw ModelLoadError {"material has no base color texture image despite having PBR"};
 		}
@@ -882,8 +853,7 @@ static std::shared_ptr<ms::Material> loadMaterial(
 		// TODO: deduce other flags from cgltf sampler.
 		const auto flags = TextureLoaderFlags(TextureLoaderFlags::Space::sRGB);
 
-		builder.diffuse(*loadTextureFrom(*base_color_tex, material_name + "_base_color", flags));
-		builder.color(toVec4(pbr_mr.base_color_factor));
+		description.diffuse = describeTexture(*base_color_tex, description.name + "_base_color", flags);
 	}
 
 	// TODO: load as metallic-roughness texture.
@@ -902,12 +872,11 @@ static std::shared_ptr<ms::Material> loadMaterial(
 		// These values MUST be encoded with a linear transfer function.
 		const auto flags = TextureLoaderFlags(TextureLoaderFlags::Space::Linear);
 
-		builder.normal(*loadTextureFrom(*normal_tex, material_name + "_normal", flags));
+		description.normal = describeTexture(*normal_tex, description.name + "_normal", flags);
 	}
 
 	if (material.has_ior) {
-        builder.refraction(true);
-		builder.ior(material.ior.ior);
+		description.ior = material.ior.ior;
 	}
 
 	auto* emissive_tex = material.emissive_texture.texture;
@@ -916,36 +885,81 @@ static std::shared_ptr<ms::Material> loadMaterial(
 		// function
 		const auto flags = TextureLoaderFlags(TextureLoaderFlags::Space::sRGB);
 
-		builder.emissive_mask(*loadTextureFrom(*emissive_tex, material_name + "_emissive_mask", flags));
+		description.emissive_mask = describeTexture(*emissive_tex, description.name + "_emissive_mask", flags);
 	}
 
-	glm::vec3 emissive_rgb = toVec3(material.emissive_factor);
-	if (emissive_rgb != glm::vec3(0.f)) {
-		glm::vec3 emissive_color(toVec3(material.emissive_factor));
-		if (material.has_emissive_strength) {
-            emissive_color *= material.emissive_strength.emissive_strength;
-		}
+	description.emissive_color = toVec3(material.emissive_factor);
+	if (material.has_emissive_strength) {
+		description.emissive_color *= material.emissive_strength.emissive_strength;
+	}
+
+	return description;
+}
+
+static std::shared_ptr<Texture> loadTexture(Assets& assets, const fs::path& base_path, const ModelData::Texture& texture) {
+	if (texture.path.empty()) {
+		return TextureLoader::load(assets, texture.name, texture.bytes.data(), texture.bytes.size(), texture.flags);
+	}
+
+	return TextureLoader::load(assets, base_path / fs::path(texture.path), texture.flags);
+}
+
+static std::shared_ptr<ms::Material> loadMaterial(
+	Assets& assets,
+	const InstanceTypes& instance_types,
+	const fs::path& base_path,
+	const ModelData::Material& material
+) {
+	ms::Material::Builder builder = ms::Material::builder();
+
+	builder
+		.name(material.name)
+		.shading(material.unlit ? ms::Shading::Unlit : ms::Shading::Lit)
+		.two_sided(material.two_sided)
+		.blending(material.blending);
 
-		builder.emissive_color(emissive_color);
+	if (material.alpha_cutoff) {
+        //TODO: add to material built-in
+        builder.custom("alpha_cutoff", *material.alpha_cutoff);
+        builder.fragment("if (mctx.diffuse.a <= alpha_cutoff) discard;");
+	}
+
+	builder.color(material.color);
+
+	if (material.diffuse) {
+		builder.diffuse(loadTexture(assets, base_path, *material.diffuse));
+	}
+
+	if (material.normal) {
+		builder.normal(loadTexture(assets, base_path, *material.normal));
+	}
+
+	if (material.ior) {
+        builder.refraction(true);
+		builder.ior(*material.ior);
+	}
+
+	if (material.emissive_mask) {
+		builder.emissive_mask(loadTexture(assets, base_path, *material.emissive_mask));
+	}
+
+	if (material.emissive_color != glm::vec3(0.f)) {
+		builder.emissive_color(material.emissive_color);
 	}
 
 	return builder.models(instance_types).build(assets);
 }
 
 static std::vector<std::shared_ptr<ms::Material>> loadMaterials(
-	const std::string& model_name,
 	Assets& assets,
 	const InstanceTypes& instance_types,
 	const fs::path& path,
-	const cgltf_data& src,
-    const ModelLoaderFlags& flags
+	const std::vector<ModelData::Material>& descriptions
 ) {
 	std::vector<std::shared_ptr<ms::Material>> materials;
 
-	for (size_t i = 0; i < src.materials_count; ++i) {
-		materials.emplace_back(loadMaterial(
-			assets, instance_types, path.parent_path(), src.materials[i], model_name, i, flags
-		));
+	for (const auto& description : descriptions) {
+		materials.emplace_back(loadMaterial(assets, instance_types, path.parent_path(), description));
 	}
 
 	return materials;
@@ -988,155 +1002,313 @@ static void fixMissingMaterials(
 	}
 }
 
-static SkeletalModel* loadSkeletalModel(
-	Assets& assets, const fs::path& path, const cgltf_data& src, const std::string& model_name, const ModelLoaderFlags& flags
-) {
-	std::vector<Bone> bones;
-	std::unordered_map<const cgltf_node*, size_t> bone_indice_map;
+// Processes source file to arrays that go to GPU as they are, this is what model cache stores.
+static ModelData loadModelData(const cgltf_data& src, const std::string& model_name, const ModelLoaderFlags& flags) {
+	ModelData model;
+	model.skeletal = src.skins_count > 0;
 
-	auto root_nodes = findRootNodes(src);
+	if (model.skeletal) {
+		std::unordered_map<const cgltf_node*, uint32_t> bone_map;
 
-	for (size_t i = 0; i < src.nodes_count; ++i) {
-		const cgltf_node& node = src.nodes[i];
-		auto bone_name =
-			node.name ? std::string(node.name) : model_name + "_bone" + std::to_string(i);
-		bones.emplace_back(Bone(i, bone_name, getNodeMatrix(node), glm::mat4(1.f)));
-		bone_indice_map.emplace(&node, i);
-
-		auto& bone = bones.back();
-		if (node.has_translation) {
-			bone.position = toVec3(node.translation);
-		}
-		if (node.has_rotation) {
-			bone.rotation = toQuat(node.rotation);
-		}
-		if (node.has_scale) {
-			bone.scale = toVec3(node.scale);
+		auto root_nodes = findRootNodes(src);
+
+		for (size_t i = 0; i < src.nodes_count; ++i) {
+			const cgltf_node& node = src.nodes[i];
+			auto bone_name =
+				node.name ? std::string(node.name) : model_name + "_bone" + std::to_string(i);
+			model.bones.emplace_back(Bone(i, bone_name, getNodeMatrix(node), glm::mat4(1.f)));
+			bone_map.emplace(&node, i);
+
+			auto& bone = model.bones.back();
+			if (node.has_translation) {
+				bone.position = toVec3(node.translation);
+			}
+			if (node.has_rotation) {
+				bone.rotation = toQuat(node.rotation);
+			}
+			if (node.has_scale) {
+				bone.scale = toVec3(node.scale);
+			}
 		}
-	}
 
-	// we do this last to avoid ptrs being invalidated if bones vector
-	// reallocates.
-	std::unordered_map<const cgltf_node*, Bone*> bone_map;
+		for (size_t i = 0; i < src.skins_count; ++i) {
+			const cgltf_skin& skin = src.skins[i];
+			// Accessors of matrix type have data stored in column-major order.
+			// glm stores them in column-major order.
+			auto inverse_bind_matrices =
+				copyFromAccessor<std::array<float, 16>>(*skin.inverse_bind_matrices);
 
-	for (const auto& [node, bone_index] : bone_indice_map) {
-		bone_map.emplace(node, &bones[bone_index]);
-	}
+			if (inverse_bind_matrices.size() != skin.joints_count) {
+				throw ModelLoadError {"mismatched number of skin joints and inverse bind matrices"};
+			}
 
-	for (size_t i = 0; i < src.skins_count; ++i) {
-		const cgltf_skin& skin = src.skins[i];
-		// Accessors of matrix type have data stored in column-major order.
-		// glm stores them in column-major order.
-		auto inverse_bind_matrices =
-			copyFromAccessor<std::array<float, 16>>(*skin.inverse_bind_matrices);
+			for (size_t j = 0; j < skin.joints_count; ++j) {
+				const cgltf_node& joint_node = *skin.joints[j];
+				auto& bone                   = model.bones[bone_map.at(&joint_node)];
+				bone.offset_matrix           = toMat4(inverse_bind_matrices[j]);
+				bone.joint_index             = j;
+			}
+		}
 
-		if (inverse_bind_matrices.size() != skin.joints_count) {
-			throw ModelLoadError {"mismatched number of skin joints and inverse bind matrices"};
+		for (size_t i = 0; i < src.animations_count; ++i) {
+			auto anim_name = src.animations[i].name ? std::string(src.animations[i].name)
+			                                        : "anim" + std::to_string(i);
+			model.animations.emplace_back(loadAnimation(std::move(anim_name), src.animations[i], bone_map));
 		}
 
-		for (size_t j = 0; j < skin.joints_count; ++j) {
-			const cgltf_node& joint_node = *skin.joints[j];
-			auto* bone                   = bone_map.at(&joint_node);
-			bone->offset_matrix          = toMat4(inverse_bind_matrices[j]);
-			bone->joint_index            = j;
+		model.skeletons = makeBoneIndiceTrees(root_nodes, bone_map);
+	}
+
+	for (size_t i = 0; i < src.nodes_count; ++i) {
+		const cgltf_node& node = src.nodes[i];
+
+		if (node.mesh) {
+			// skins are applied only by skeletal models
+			auto meshes = loadMeshes(
+				node, *node.mesh, model.skeletal ? node.skin : nullptr, model_name, model.meshes.size(), src, flags
+			);
+			model.meshes.insert(
+				model.meshes.end(), std::make_move_iterator(meshes.begin()), std::make_move_iterator(meshes.end())
+			);
 		}
 	}
 
-	std::vector<Animation> animations;
-	for (size_t i = 0; i < src.animations_count; ++i) {
-		auto anim_name = src.animations[i].name ? std::string(src.animations[i].name)
-		                                        : "anim" + std::to_string(i);
-		animations.emplace_back(loadAnimation(std::move(anim_name), src.animations[i], bone_map));
+	for (size_t i = 0; i < src.materials_count; ++i) {
+		model.materials.emplace_back(describeMaterial(src.materials[i], model_name, i));
 	}
 
-	auto bone_indices_tree = makeBoneIndiceTrees(root_nodes, bone_map);
+	return model;
+}
 
+// Creates meshes and materials of processed model.
+static std::shared_ptr<AbstractModel> makeModel(
+	Assets& assets,
+	const fs::path& path,
+	ModelData&& model,
+	const std::string& model_name,
+	const ModelLoaderFlags& flags
+) {
 	InstanceTypes instance_types = flags.additional_instance_types;
-	instance_types.emplace(InstanceType::Skeletal);
-	auto loaded_materials = loadMaterials(model_name, assets, instance_types, path, src, flags);
+	instance_types.emplace(model.skeletal ? InstanceType::Skeletal : InstanceType::Model);
+
+	auto loaded_materials = loadMaterials(assets, instance_types, path, model.materials);
 
 	std::vector<std::shared_ptr<AbstractMesh>> meshes;
 	std::vector<std::shared_ptr<ms::Material>> mesh_materials;
 
-	for (size_t i = 0; i < src.nodes_count; ++i) {
-		const cgltf_node& node = src.nodes[i];
+	for (auto& mesh : model.meshes) {
+		std::unique_ptr<AbstractVertexStream> stream;
 
-		if (node.mesh) {
-			auto [more_meshes, more_mesh_materials] = loadMeshes(
-				node, *node.mesh, node.skin, model_name, meshes.size(), loaded_materials, src, flags
+		if (mesh.skinned) {
+			stream = std::make_unique<SkinnedVertexStream<VertexNormalTangent>>(
+				std::move(mesh.vertices),
+				std::move(mesh.indices),
+				std::move(mesh.bone_weights),
+				VertexStreamUsage::Static,
+				VertexStreamDraw::Triangles
 			);
-			meshes.insert(meshes.end(), more_meshes.begin(), more_meshes.end());
-			mesh_materials.insert(
-				mesh_materials.end(), more_mesh_materials.begin(), more_mesh_materials.end()
+		} else {
+			stream = std::make_unique<IndexedVertexStream<VertexNormalTangent>>(
+				std::move(mesh.vertices),
+				std::move(mesh.indices),
+				VertexStreamUsage::Static,
+				VertexStreamDraw::Triangles
 			);
 		}
+
+		meshes.emplace_back(std::make_shared<Mesh>(std::move(stream), std::move(mesh.name)));
+		mesh_materials.emplace_back(
+			mesh.material == ModelData::NO_MATERIAL ? nullptr : loaded_materials.at(mesh.material)
+		);
 	}
 
 	fixMissingMaterials(mesh_materials, assets, model_name, instance_types);
 
+	if (!model.skeletal) {
+		return std::shared_ptr<AbstractModel>(new Model(std::move(meshes), std::move(mesh_materials), model_name));
+	}
+
+	// animation nodes refer to bones, bones vector is moved to model with its storage
+	auto& bones = model.bones;
+
+	std::vector<Animation> animations;
+	animations.reserve(model.animations.size());
+	for (auto& animation : model.animations) {
+		std::vector<AnimationNode> nodes;
+		nodes.reserve(animation.nodes.size());
+		for (auto& node : animation.nodes) {
+			nodes.emplace_back(
+				std::move(node.positions), std::move(node.rotations), std::move(node.scales), bones.at(node.bone)
+			);
+		}
+		animations.emplace_back(std::move(animation.name), animation.duration, animation.tps, std::move(nodes));
+	}
+
 	std::unordered_map<std::string, uint32_t> bone_indices_map;
 	for (size_t i = 0; i < bones.size(); ++i) {
 		bone_indices_map.emplace(bones[i].name, i);
 	}
 
-	return new SkeletalModel(
+	return std::shared_ptr<AbstractModel>(new SkeletalModel(
 		std::move(meshes),
 		std::move(mesh_materials),
 		std::move(bones),
 		std::move(bone_indices_map),
-		std::move(bone_indices_tree),
+		std::move(model.skeletons),
 		std::move(animations),
 		model_name
-	);
+	));
 }
 
-static Model* loadPlainModel(
-	Assets& assets, const fs::path& path, const cgltf_data& src, const std::string& model_name, const ModelLoaderFlags& flags
-) {
-	std::vector<std::shared_ptr<AbstractMesh>> meshes;
-	std::vector<std::shared_ptr<ms::Material>> mesh_materials;
-	InstanceTypes instance_types = flags.additional_instance_types;
-	instance_types.emplace(InstanceType::Model);
+// Key of cache file: model path and everything processing depends on except source contents.
+static uint64_t getCacheKey(const fs::path& path, const std::string& model_name, const ModelLoaderFlags& flags) {
+	auto hashValue = [] (const auto& value, uint64_t seed) {
+		return ModelCache::hash({reinterpret_cast<const char*>(&value), sizeof(value)}, seed);
+	};
 
-	auto loaded_materials = loadMaterials(model_name, assets, instance_types, path, src, flags);
+	uint64_t key = ModelCache::hash(model_name, ModelCache::VERSION);
+	key = ModelCache::hash(path.generic_string(), key);
 
-	for (size_t i = 0; i < src.nodes_count; ++i) {
-		const cgltf_node& node = src.nodes[i];
+	for (const auto option : flags.options) {
+		key = hashValue(option, key);
+	}
+	key = hashValue(flags.scale_factor, key);
 
-		if (node.mesh) {
-			auto [more_meshes, more_mesh_materials] = loadMeshes(
-				node, *node.mesh, nullptr, model_name, meshes.size(), loaded_materials, src, flags
-			);
-			meshes.insert(meshes.end(), more_meshes.begin(), more_meshes.end());
-			mesh_materials.insert(
-				mesh_materials.end(), more_mesh_materials.begin(), more_mesh_materials.end()
-			);
+	return key;
+}
+
+// Stamp of source file that changes whenever file does, without reading files on disk.
+static ModelCache::Source getSource(const PackArchives& archives, const fs::path& path) {
+	if (const auto archived = archives.find(path)) {
+		return {path.generic_string(), archived->size(), static_cast<int64_t>(ModelCache::hash(*archived))};
+	}
+
+	return {
+		path.generic_string(),
+		static_cast<uint64_t>(fs::file_size(path)),
+		static_cast<int64_t>(fs::last_write_time(path).time_since_epoch().count())
+	};
+}
+
+// Source files of model: model file itself and its external buffers; buffers of glb file and data uris are part of file.
+static std::vector<ModelCache::Source> getSources(const PackArchives& archives, const fs::path& path, const cgltf_data& src) {
+	std::vector<ModelCache::Source> sources;
+	sources.emplace_back(getSource(archives, path));
+
+	for (size_t i = 0; i < src.buffers_count; ++i) {
+		const char* uri = src.buffers[i].uri;
+		if (uri == nullptr || strncmp(uri, "data:", 5) == 0) {
+			continue;
+		}
+
+		std::string buffer_uri = uri;
+		buffer_uri.resize(cgltf_decode_uri(buffer_uri.data()));
+
+		sources.emplace_back(getSource(archives, path.parent_path() / buffer_uri));
+	}
+
+	return sources;
+}
+
+// Whether sources still have stamps they had when model was cached.
+static bool areSourcesUnchanged(const PackArchives& archives, const std::vector<ModelCache::Source>& sources) {
+	if (sources.empty()) {
+		return false;
+	}
+
+	try {
+		for (const auto& source : sources) {
+			if (!(getSource(archives, source.path) == source)) {
+				return false;
+			}
 		}
+	} catch (const fs::filesystem_error&) {
+		return false;
 	}
 
-	fixMissingMaterials(mesh_materials, assets, model_name, instance_types);
+	return true;
+}
+
+// Hash of source contents, compared when stamps changed, so touched but unchanged files are not processed again.
+static uint64_t getContentKey(const PackArchives& archives, const std::vector<ModelCache::Source>& sources) {
+	uint64_t key = ModelCache::VERSION;
 
-	return new Model(std::move(meshes), std::move(mesh_materials), model_name);
+	for (const auto& source : sources) {
+		const auto file = archives.open(source.path);
+		key = ModelCache::hash({reinterpret_cast<const char*>(file.data()), file.size()}, key);
+	}
+
+	return key;
 }
 
-static std::shared_ptr<AbstractModel>
-loadModel(Assets& assets, const fs::path& path, const cgltf_data& src, const ModelLoaderFlags& flags) {
-	auto model_name = path.stem().string();
+// serves files stored in mounted archives straight from their memory, other files are read by cgltf
+static cgltf_result readArchivedFile(
+	const cgltf_memory_options* memory_options,
+	const cgltf_file_options* file_options,
+	const char* path,
+	cgltf_size* size,
+	void** data
+) {
+	const auto& archives = *static_cast<const PackArchives*>(file_options->user_data);
 
-	if (src.skins_count > 0) {
-		return std::shared_ptr<AbstractModel>(loadSkeletalModel(assets, path, src, model_name, flags));
-	} else {
-		return std::shared_ptr<AbstractModel>(loadPlainModel(assets, path, src, model_name, flags));
+	const auto contents = archives.find(path);
+	if (!contents) {
+		return cgltf_default_file_read(memory_options, file_options, path, size, data);
+	}
+
+	// buffers are read with their declared size
+	const auto requested = (size && *size != 0) ? *size : contents->size();
+	if (requested > contents->size()) {
+		return cgltf_result_io_error;
+	}
+
+	if (size) {
+		*size = requested;
+	}
+	if (data) {
+		// cgltf does not write to file data
+		*data = const_cast<char*>(contents->data());
+	}
+
+	return cgltf_result_success;
+}
+
+static void releaseArchivedFile(
+	const cgltf_memory_options* memory_options,
+	const cgltf_file_options* file_options,
+	void* data
+) {
+	const auto& archives = *static_cast<const PackArchives*>(file_options->user_data);
+
+	if (!archives.contains(data)) {
+		cgltf_default_file_release(memory_options, file_options, data);
 	}
 }
 
 std::shared_ptr<AbstractModel>
 GltfModelLoader::loadModel(Assets& assets, const fs::path& path, const ModelLoaderFlags& flags) {
+	const auto model_name = path.stem().string();
+
+	std::optional<fs::path> cache_path;
+	uint64_t cache_key {};
+	std::optional<ModelCache::Entry> cached;
+
+	if (flags.cache_directory) {
+		cache_key = getCacheKey(path, model_name, flags);
+		cache_path = ModelCache::getPath(*flags.cache_directory, cache_key);
+		cached = ModelCache::load(*cache_path, cache_key);
+
+		// model and its materials are restored from cache without parsing or hashing of sources
+		if (cached && areSourcesUnchanged(assets.archives, cached->sources)) {
+			return makeModel(assets, path, std::move(cached->model), model_name, flags);
+		}
+	}
+
 	cgltf_options opts = cgltf_options {
 		cgltf_file_type_invalid, // autodetect
 		0, // auto json token count
 		cgltf_memory_options {nullptr, nullptr, nullptr},
-		cgltf_file_options {nullptr, nullptr, nullptr}
+		cgltf_file_options {&readArchivedFile, &releaseArchivedFile, &assets.archives}
     };
 	cgltf_data* out_data = nullptr;
 
@@ -1149,15 +1321,46 @@ GltfModelLoader::loadModel(Assets& assets, const fs::path& path, const ModelLoad
 			+ std::to_string(static_cast<int>(gltf))};
 	}
 
-	auto result = cgltf_load_buffers(&opts, out_data, path_str.c_str());
+	const std::unique_ptr<cgltf_data, decltype(&cgltf_free)> src {out_data, &cgltf_free};
+
+	if (src->scenes == nullptr) {
+		throw ModelLoadError {"no scene"};
+	}
+
+	auto saveCache = [&] (const ModelCache::Entry& entry) {
+		try {
+			ModelCache::save(*cache_path, cache_key, entry);
+		} catch (const std::exception& e) {
+			// model is loaded anyway, it is processed from source again next time
+			std::cerr << "Failed to write model cache " << cache_path->string() << ": " << e.what() << std::endl;
+		}
+	};
+
+	ModelCache::Entry entry;
+
+	if (cache_path) {
+		entry.sources = getSources(assets.archives, path, *src);
+		entry.content_key = getContentKey(assets.archives, entry.sources);
+
+		// sources are touched but the same, only their stamps are updated
+		if (cached && cached->content_key == entry.content_key) {
+			entry.model = std::move(cached->model);
+			saveCache(entry);
+			return makeModel(assets, path, std::move(entry.model), model_name, flags);
+		}
+	}
+
+	auto result = cgltf_load_buffers(&opts, src.get(), path_str.c_str());
 	if (result != cgltf_result_success) {
 		throw ModelLoadError {
 			"failed to load buffers: " + std::to_string(static_cast<int>(result))};
 	}
 
-	if (out_data->scenes == nullptr) {
-		throw ModelLoadError {"no scene"};
+	entry.model = loadModelData(*src, model_name, flags);
+
+	if (cache_path) {
+		saveCache(entry);
 	}
 
-	return ::loadModel(assets, path, *out_data, flags);
+	return makeModel(assets, path, std::move(entry.model), model_name, flags);
 }
@@ -3,6 +3,7 @@
 #include <ostream>
 #include <fstream>
 
+#include <limitless/assets.hpp>
 #include <limitless/util/bytebuffer.hpp>
 #include <limitless/ms/material.hpp>
 #include <limitless/serialization/material_serializer.hpp>
@@ -12,22 +13,11 @@ using namespace Limitless::ms;
 
 std::shared_ptr<ms::Material> MaterialLoader::load(Assets& assets, const fs::path& _path) {
     auto path = convertPathSeparators(_path);
-    std::ifstream stream;
-    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    try {
-	    stream.open(path, std::ios::binary | std::ios::ate);
-    } catch (const std::exception& e) {
-    	throw std::runtime_error("Failed to open " + path.string());
-    }
-
-    auto filesize = stream.tellg();
-    ByteBuffer buffer{static_cast<size_t>(filesize)};
-
-    stream.seekg(0, std::ios::beg);
-    stream.read(buffer.cdata(), buffer.size());
+    const auto file = assets.archives.open(path);
+    auto reader = file.reader();
 
     std::shared_ptr<ms::Material> material;
-    buffer >> AssetDeserializer<std::shared_ptr<ms::Material>>{assets, material};
+    reader >> AssetDeserializer<std::shared_ptr<ms::Material>>{assets, material};
     return material;
 }
 
@@ -0,0 +1,345 @@
+#include <limitless/loaders/model_cache.hpp>
+
+#include <limitless/util/bytebuffer.hpp>
+#include <limitless/util/mapped_file.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+using namespace Limitless;
+
+namespace {
+    constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ull;
+
+    constexpr uint64_t mix(uint64_t value) noexcept {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    // skeletons of real models are far shallower, deeper tree means damaged file
+    constexpr size_t MAX_TREE_DEPTH = 256;
+
+    // every child takes at least its bone and its child count
+    constexpr size_t MIN_TREE_NODE_SIZE = sizeof(uint32_t) + sizeof(size_t);
+
+    constexpr uint64_t rotate(uint64_t value, int bits) noexcept {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    void writeTree(ByteBuffer& buffer, const Tree<uint32_t>& tree) {
+        buffer << *tree << tree.size();
+        for (const auto& child : tree) {
+            writeTree(buffer, child);
+        }
+    }
+
+    void readTree(ByteReader& reader, Tree<uint32_t>& tree, size_t depth = 0) {
+        if (depth > MAX_TREE_DEPTH) {
+            throw std::runtime_error("Model cache skeleton is too deep");
+        }
+
+        size_t children {};
+        reader >> children;
+        if (children > reader.remaining() / MIN_TREE_NODE_SIZE) {
+            throw std::runtime_error("Model cache skeleton has more children than file contains");
+        }
+
+        for (size_t i = 0; i < children; ++i) {
+            uint32_t bone {};
+            reader >> bone;
+            readTree(reader, tree.add(bone), depth + 1);
+        }
+    }
+
+    /**
+     * Temporary file next to path, unique for process and thread, so concurrent saves of the same model never share it
+     */
+    fs::path getTemporaryPath(const fs::path& path) {
+        const auto unique = mix(std::random_device{}() ^ rotate(std::hash<std::thread::id>{}(std::this_thread::get_id()), 32)
+                                ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+
+        std::stringstream name;
+        name << path.filename().string() << '.' << std::hex << std::setw(16) << std::setfill('0') << unique << ".tmp";
+        return path.parent_path() / name.str();
+    }
+
+    template<typename T>
+    void writeOptional(ByteBuffer& buffer, const std::optional<T>& value) {
+        buffer << value.has_value() << value.value_or(T{});
+    }
+
+    template<typename T>
+    void readOptional(ByteReader& reader, std::optional<T>& value) {
+        bool present {};
+        T data {};
+        reader >> present >> data;
+        if (present) {
+            value = data;
+        }
+    }
+
+    void writeTexture(ByteBuffer& buffer, const std::optional<ModelData::Texture>& texture) {
+        buffer << texture.has_value();
+        if (texture) {
+            buffer << texture->path << texture->name << texture->flags;
+            buffer.writeBlock(texture->bytes);
+        }
+    }
+
+    void readTexture(ByteReader& reader, std::optional<ModelData::Texture>& texture) {
+        bool present {};
+        reader >> present;
+        if (present) {
+            auto& data = texture.emplace();
+            reader >> data.path >> data.name >> data.flags;
+            reader.readBlock(data.bytes);
+        }
+    }
+
+    void writeModel(ByteBuffer& buffer, const ModelData& model) {
+        buffer << model.skeletal;
+
+        buffer << model.meshes.size();
+        for (const auto& mesh : model.meshes) {
+            buffer << mesh.name << mesh.material << mesh.skinned;
+            buffer.writeBlock(mesh.vertices);
+            buffer.writeBlock(mesh.indices);
+            buffer.writeBlock(mesh.bone_weights);
+        }
+
+        buffer << model.materials.size();
+        for (const auto& material : model.materials) {
+            buffer << material.name << material.blending << material.unlit << material.two_sided;
+            buffer << material.color << material.emissive_color;
+            writeOptional(buffer, material.alpha_cutoff);
+            writeOptional(buffer, material.ior);
+            writeTexture(buffer, material.diffuse);
+            writeTexture(buffer, material.normal);
+            writeTexture(buffer, material.emissive_mask);
+        }
+
+        buffer << model.bones.size();
+        for (const auto& bone : model.bones) {
+            buffer << bone.index << bone.name << bone.node_transform << bone.offset_matrix;
+            buffer << bone.position << bone.rotation << bone.scale;
+            buffer << bone.joint_index.has_value() << bone.joint_index.value_or(0);
+        }
+
+        buffer << model.skeletons.size();
+        for (const auto& skeleton : model.skeletons) {
+            writeTree(buffer, skeleton);
+        }
+
+        buffer << model.animations.size();
+        for (const auto& animation : model.animations) {
+            buffer << animation.name << animation.duration << animation.tps;
+
+            buffer << animation.nodes.size();
+            for (const auto& node : animation.nodes) {
+                buffer << node.bone;
+                buffer.writeBlock(node.positions);
+                buffer.writeBlock(node.rotations);
+                buffer.writeBlock(node.scales);
+            }
+        }
+    }
+
+    ModelData readModel(ByteReader& reader) {
+        ModelData model;
+        reader >> model.skeletal;
+
+        size_t mesh_count {};
+        reader >> mesh_count;
+        // corrupted count should fail on reading instead of allocation
+        model.meshes.reserve(std::min(mesh_count, reader.remaining()));
+        for (size_t i = 0; i < mesh_count; ++i) {
+            auto& mesh = model.meshes.emplace_back();
+            reader >> mesh.name >> mesh.material >> mesh.skinned;
+            reader.readBlock(mesh.vertices);
+            reader.readBlock(mesh.indices);
+            reader.readBlock(mesh.bone_weights);
+        }
+
+        size_t material_count {};
+        reader >> material_count;
+        model.materials.reserve(std::min(material_count, reader.remaining()));
+        for (size_t i = 0; i < material_count; ++i) {
+            auto& material = model.materials.emplace_back();
+            reader >> material.name >> material.blending >> material.unlit >> material.two_sided;
+            reader >> material.color >> material.emissive_color;
+            readOptional(reader, material.alpha_cutoff);
+            readOptional(reader, material.ior);
+            readTexture(reader, material.diffuse);
+            readTexture(reader, material.normal);
+            readTexture(reader, material.emissive_mask);
+        }
+
+        size_t bone_count {};
+        reader >> bone_count;
+        model.bones.reserve(std::min(bone_count, reader.remaining()));
+        for (size_t i = 0; i < bone_count; ++i) {
+            uint32_t index {};
+            std::string name;
+            glm::mat4 node_transform {1.0f};
+            glm::mat4 offset_matrix {1.0f};
+            reader >> index >> name >> node_transform >> offset_matrix;
+
+            auto& bone = model.bones.emplace_back(index, std::move(name), node_transform, offset_matrix);
+            reader >> bone.position >> bone.rotation >> bone.scale;
+
+            bool has_joint {};
+            uint32_t joint_index {};
+            reader >> has_joint >> joint_index;
+            if (has_joint) {
+                bone.joint_index = joint_index;
+            }
+        }
+
+        size_t skeleton_count {};
+        reader >> skeleton_count;
+        model.skeletons.reserve(std::min(skeleton_count, reader.remaining()));
+        for (size_t i = 0; i < skeleton_count; ++i) {
+            uint32_t bone {};
+            reader >> bone;
+            readTree(reader, model.skeletons.emplace_back(bone));
+        }
+
+        size_t animation_count {};
+        reader >> animation_count;
+        model.animations.reserve(std::min(animation_count, reader.remaining()));
+        for (size_t i = 0; i < animation_count; ++i) {
+            auto& animation = model.animations.emplace_back();
+            reader >> animation.name >> animation.duration >> animation.tps;
+
+            size_t node_count {};
+            reader >> node_count;
+            animation.nodes.reserve(std::min(node_count, reader.remaining()));
+            for (size_t j = 0; j < node_count; ++j) {
+                auto& node = animation.nodes.emplace_back();
+                reader >> node.bone;
+                reader.readBlock(node.positions);
+                reader.readBlock(node.rotations);
+                reader.readBlock(node.scales);
+            }
+        }
+
+        return model;
+    }
+}
+
+uint64_t ModelCache::hash(std::string_view bytes, uint64_t seed) noexcept {
+    const auto* data = bytes.data();
+    const auto size = bytes.size();
+
+    uint64_t value = mix(seed ^ (size * PRIME));
+
+    // words are mixed independently of each other, so only one multiplication depends on previous word
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        value = rotate(value ^ mix(word), 27) * PRIME;
+    }
+
+    if (i != size) {
+        uint64_t word {};
+        std::memcpy(&word, data + i, size - i);
+        value = rotate(value ^ mix(word), 27) * PRIME;
+    }
+
+    return mix(value);
+}
+
+fs::path ModelCache::getPath(const fs::path& directory, uint64_t key) {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".lmodel";
+    return directory / name.str();
+}
+
+std::optional<ModelCache::Entry> ModelCache::load(const fs::path& path, uint64_t key) {
+    if (!fs::exists(path)) {
+        return std::nullopt;
+    }
+
+    try {
+        const MappedFile file {path};
+        auto reader = file.reader();
+
+        uint32_t magic {};
+        uint32_t version {};
+        uint64_t file_key {};
+        reader >> magic >> version >> file_key;
+
+        if (magic != MAGIC || version != VERSION || file_key != key) {
+            return std::nullopt;
+        }
+
+        Entry entry;
+        reader >> entry.content_key;
+
+        size_t source_count {};
+        reader >> source_count;
+        entry.sources.reserve(std::min(source_count, reader.remaining()));
+        for (size_t i = 0; i < source_count; ++i) {
+            auto& source = entry.sources.emplace_back();
+            reader >> source.path >> source.size >> source.stamp;
+        }
+
+        entry.model = readModel(reader);
+        return entry;
+    } catch (const std::exception&) {
+        // damaged or unreadable cache is the same as missing one, model is processed again
+        return std::nullopt;
+    }
+}
+
+void ModelCache::save(const fs::path& path, uint64_t key, const Entry& entry) {
+    ByteBuffer buffer;
+    buffer << MAGIC << VERSION << key << entry.content_key;
+
+    buffer << entry.sources.size();
+    for (const auto& source : entry.sources) {
+        buffer << source.path << source.size << source.stamp;
+    }
+
+    writeModel(buffer, entry.model);
+
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path());
+    }
+
+    const auto temporary = getTemporaryPath(path);
+
+    {
+        std::ofstream stream(temporary, std::ios::binary);
+        if (!stream) {
+            throw std::runtime_error("Failed to open " + temporary.string());
+        }
+
+        stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        stream.close();
+        if (!stream) {
+            std::error_code error;
+            fs::remove(temporary, error);
+            throw std::runtime_error("Failed to write " + temporary.string());
+        }
+    }
+
+    // whichever of concurrent saves renames last wins, files of the same key have the same contents
+    std::error_code error;
+    fs::rename(temporary, path, error);
+    if (error) {
+        fs::remove(temporary, error);
+        throw std::runtime_error("Failed to move " + temporary.string() + " to " + path.string());
+    }
+}
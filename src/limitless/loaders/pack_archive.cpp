@@ -0,0 +1,177 @@
+#include <limitless/loaders/pack_archive.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace Limitless;
+
+namespace {
+    constexpr uint64_t alignUp(uint64_t offset, uint64_t alignment) noexcept {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    void writePadding(std::ofstream& stream, uint64_t& offset, uint64_t alignment) {
+        static constexpr char zeros[PackArchive::BLOB_ALIGNMENT] {};
+
+        const auto aligned = alignUp(offset, alignment);
+        stream.write(zeros, static_cast<std::streamsize>(aligned - offset));
+        offset = aligned;
+    }
+}
+
+uint64_t PackArchive::hash(std::string_view name) noexcept {
+    uint64_t value = 0xCBF29CE484222325ull;
+    for (const auto c : name) {
+        value ^= static_cast<uint8_t>(c);
+        value *= 0x100000001B3ull;
+    }
+    return value;
+}
+
+std::string PackArchive::getName(const fs::path& path) {
+    return convertPathSeparators(path).lexically_normal().generic_string();
+}
+
+PackArchive::PackArchive(const fs::path& path)
+    : file {path} {
+    auto reader = file.reader();
+
+    Header header {};
+    try {
+        reader >> header;
+    } catch (const std::out_of_range&) {
+        throw pack_archive_exception {"Not a pack archive " + path.string()};
+    }
+
+    if (header.magic != MAGIC) {
+        throw pack_archive_exception {"Not a pack archive " + path.string()};
+    }
+
+    if (header.version != VERSION) {
+        throw pack_archive_exception {"Wrong pack archive version! " + std::to_string(VERSION) + " vs " + std::to_string(header.version)};
+    }
+
+    if (header.entry_count > reader.remaining() / sizeof(Entry)) {
+        throw pack_archive_exception {"Corrupted table of contents of pack archive " + path.string()};
+    }
+
+    entries = reinterpret_cast<const Entry*>(reader.view(header.entry_count * sizeof(Entry)).data());
+    entry_count = header.entry_count;
+
+    // checked once here, so lookups do not have to
+    const auto in_file = [size = file.size()] (uint64_t offset, uint64_t length) {
+        return offset <= size && length <= size - offset;
+    };
+
+    for (uint64_t i = 0; i < entry_count; ++i) {
+        const auto& entry = entries[i];
+
+        if (!in_file(entry.name_offset, entry.name_size) || !in_file(entry.offset, entry.size)) {
+            throw pack_archive_exception {"Corrupted entry of pack archive " + path.string()};
+        }
+
+        if (entry.compression != Compression::None) {
+            throw pack_archive_exception {"Unsupported compression of pack archive " + path.string()};
+        }
+    }
+}
+
+std::string_view PackArchive::view(uint64_t offset, uint64_t size) const noexcept {
+    return {reinterpret_cast<const char*>(file.data() + offset), static_cast<size_t>(size)};
+}
+
+std::optional<std::string_view> PackArchive::find(std::string_view name) const {
+    const auto key = hash(name);
+    const auto* last = entries + entry_count;
+
+    auto it = std::lower_bound(entries, last, key, [] (const Entry& entry, uint64_t value) {
+        return entry.hash < value;
+    });
+
+    for (; it != last && it->hash == key; ++it) {
+        if (view(it->name_offset, it->name_size) == name) {
+            return view(it->offset, it->size);
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool PackArchive::contains(const void* data) const noexcept {
+    const auto* bytes = static_cast<const std::byte*>(data);
+    return file.size() != 0 && bytes >= file.data() && bytes < file.data() + file.size();
+}
+
+void PackWriter::add(const fs::path& name, const fs::path& path) {
+    auto stored_name = PackArchive::getName(name);
+    const auto stored_hash = PackArchive::hash(stored_name);
+    sources.push_back({std::move(stored_name), path, static_cast<uint64_t>(fs::file_size(path)), stored_hash});
+}
+
+void PackWriter::addDirectory(const fs::path& directory) {
+    for (const auto& entry : fs::recursive_directory_iterator(directory)) {
+        if (entry.is_regular_file()) {
+            add(entry.path().lexically_relative(directory), entry.path());
+        }
+    }
+}
+
+void PackWriter::write(const fs::path& path) {
+    std::sort(sources.begin(), sources.end(), [] (const Source& a, const Source& b) {
+        return a.hash != b.hash ? a.hash < b.hash : a.name < b.name;
+    });
+
+    const auto duplicate = std::adjacent_find(sources.begin(), sources.end(), [] (const Source& a, const Source& b) {
+        return a.name == b.name;
+    });
+
+    if (duplicate != sources.end()) {
+        throw pack_archive_exception {"Pack archive has two files named " + duplicate->name};
+    }
+
+    // lays out names and blobs after table of contents
+    std::vector<PackArchive::Entry> entries;
+    entries.reserve(sources.size());
+
+    uint64_t offset = sizeof(PackArchive::Header) + sources.size() * sizeof(PackArchive::Entry);
+    for (const auto& source : sources) {
+        entries.push_back({source.hash, offset, source.name.size(), 0, source.size, PackArchive::Compression::None, 0});
+        offset += source.name.size();
+    }
+
+    for (auto& entry : entries) {
+        offset = alignUp(offset, PackArchive::BLOB_ALIGNMENT);
+        entry.offset = offset;
+        offset += entry.size;
+    }
+
+    std::ofstream stream;
+    stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    try {
+        stream.open(path, std::ios::binary);
+    } catch (const std::exception&) {
+        throw pack_archive_exception {"Failed to open " + path.string()};
+    }
+
+    const PackArchive::Header header {PackArchive::MAGIC, PackArchive::VERSION, entries.size()};
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackArchive::Entry)));
+
+    offset = sizeof(PackArchive::Header) + entries.size() * sizeof(PackArchive::Entry);
+    for (const auto& source : sources) {
+        stream.write(source.name.data(), static_cast<std::streamsize>(source.name.size()));
+        offset += source.name.size();
+    }
+
+    for (const auto& source : sources) {
+        writePadding(stream, offset, PackArchive::BLOB_ALIGNMENT);
+
+        const MappedFile file {source.path};
+        if (file.size() != source.size) {
+            throw pack_archive_exception {"File changed while packing " + source.path.string()};
+        }
+
+        stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+        offset += file.size();
+    }
+}
@@ -0,0 +1,73 @@
+#include <limitless/loaders/pack_archives.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+using namespace Limitless;
+
+void PackArchives::mount(const fs::path& archive, const fs::path& point) {
+    auto name = point.empty() ? std::string {} : PackArchive::getName(point);
+
+    // "assets/" is the same mount point as "assets"
+    while (!name.empty() && name.back() == '/') {
+        name.pop_back();
+    }
+
+    if (name == ".") {
+        name.clear();
+    }
+
+    auto mounted = std::make_unique<PackArchive>(archive);
+
+    std::unique_lock lock(mutex);
+    mounts.push_back({std::move(name), std::move(mounted)});
+}
+
+std::optional<std::string_view> PackArchives::find(const fs::path& path) const {
+    std::shared_lock lock(mutex);
+
+    if (mounts.empty()) {
+        return std::nullopt;
+    }
+
+    const auto name = PackArchive::getName(path);
+
+    for (auto it = mounts.rbegin(); it != mounts.rend(); ++it) {
+        const auto& point = it->point;
+
+        std::string_view entry = name;
+        if (!point.empty()) {
+            if (entry.size() <= point.size() || entry.compare(0, point.size(), point) != 0 || entry[point.size()] != '/') {
+                continue;
+            }
+            entry.remove_prefix(point.size() + 1);
+        }
+
+        if (auto contents = it->archive->find(entry)) {
+            return contents;
+        }
+    }
+
+    return std::nullopt;
+}
+
+AssetFile PackArchives::open(const fs::path& path) const {
+    if (const auto contents = find(path)) {
+        return AssetFile {*contents};
+    }
+
+    return AssetFile {path};
+}
+
+bool PackArchives::contains(const void* data) const {
+    std::shared_lock lock(mutex);
+
+    return std::any_of(mounts.begin(), mounts.end(), [data] (const Mount& mount) {
+        return mount.archive->contains(data);
+    });
+}
+
+bool PackArchives::empty() const {
+    std::shared_lock lock(mutex);
+    return mounts.empty();
+}
@@ -21,6 +21,16 @@ namespace {
     constexpr auto S3TC_EXTENSION = "GL_EXT_texture_compression_s3tc";
     constexpr auto BPTC_EXTENSION = "GL_ARB_texture_compression_bptc";
     constexpr auto RGTC_EXTENSION = "GL_ARB_texture_compression_rgtc";
+
+    // decodes image stored in mounted archive or file on disk
+    unsigned char* loadImage(const Assets& assets, const fs::path& path, int& width, int& height, int& channels) {
+        if (const auto contents = assets.archives.find(path)) {
+            const auto* bytes = reinterpret_cast<const stbi_uc*>(contents->data());
+            return stbi_load_from_memory(bytes, static_cast<int>(contents->size()), &width, &height, &channels, 0);
+        }
+
+        return stbi_load(path.string().c_str(), &width, &height, &channels, 0);
+    }
 }
 
 void TextureLoader::setFormat(Texture::Builder& builder, const TextureLoaderFlags& flags, int channels) {
@@ -148,7 +158,7 @@ std::shared_ptr<Texture> TextureLoader::load(Assets& assets, const fs::path& _pa
     stbi_set_flip_vertically_on_load(static_cast<bool>((int)flags.origin));
 
     int width = 0, height = 0, channels = 0;
-    unsigned char* data = stbi_load(path.string().c_str(), &width, &height, &channels, 0);
+    unsigned char* data = loadImage(assets, path, width, height, channels);
 
     if (!data) {
 	    throw std::runtime_error("Failed to load texture: " + path.string() + " " + stbi_failure_reason());
@@ -225,7 +235,7 @@ std::shared_ptr<Texture> TextureLoader::load(Assets& assets, const std::string&
     return texture;
 }
 
-std::shared_ptr<Texture> TextureLoader::loadCubemap([[maybe_unused]] Assets& assets, const fs::path& _path, const TextureLoaderFlags& flags) {
+std::shared_ptr<Texture> TextureLoader::loadCubemap(Assets& assets, const fs::path& _path, const TextureLoaderFlags& flags) {
     auto path = convertPathSeparators(_path);
 
     stbi_set_flip_vertically_on_load(static_cast<bool>((int)flags.origin));
@@ -237,7 +247,7 @@ std::shared_ptr<Texture> TextureLoader::loadCubemap([[maybe_unused]] Assets& ass
 
     for (size_t i = 0; i < data.size(); ++i) {
         std::string p = path.parent_path().string() + PATH_SEPARATOR + path.stem().string() + ext[i] + path.extension().string();
-        data[i] = stbi_load(p.c_str(), &width, &height, &channels, 0);
+        data[i] = loadImage(assets, p, width, height, channels);
 
         if (!data[i]) {
             throw std::runtime_error("Failed to load texture: " + path.string() + " " + stbi_failure_reason());
@@ -267,13 +277,13 @@ std::shared_ptr<Texture> TextureLoader::loadCubemap([[maybe_unused]] Assets& ass
     return texture;
 }
 
-GLFWimage TextureLoader::loadGLFWImage([[maybe_unused]] Assets& assets, const fs::path& _path, const TextureLoaderFlags& flags) {
+GLFWimage TextureLoader::loadGLFWImage(Assets& assets, const fs::path& _path, const TextureLoaderFlags& flags) {
     auto path = convertPathSeparators(_path);
 
     stbi_set_flip_vertically_on_load(static_cast<bool>(flags.origin));
 
     int width = 0, height = 0, channels = 0;
-    unsigned char* data = stbi_load(path.string().c_str(), &width, &height, &channels, 0);
+    unsigned char* data = loadImage(assets, path, width, height, channels);
 
     if (data) {
         return GLFWimage{ width, height, data };
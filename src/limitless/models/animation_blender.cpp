@@ -0,0 +1,272 @@
+#include <limitless/models/animation_blender.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+namespace {
+    /**
+     * Returns quaternion from the same hemisphere as reference, so weighted sum takes the shortest path
+     */
+    inline glm::fquat align(const glm::fquat& reference, const glm::fquat& q) noexcept {
+        return glm::dot(reference, q) < 0.0f ? -q : q;
+    }
+
+    inline glm::fquat nlerp(const glm::fquat& a, const glm::fquat& b, float t) noexcept {
+        return glm::normalize(a * (1.0f - t) + align(a, b) * t);
+    }
+
+    inline double getTicks(const Animation& animation, double seconds) noexcept {
+        return animation.duration > 0.0 ? glm::mod(seconds * animation.tps, animation.duration) : 0.0;
+    }
+}
+
+void LocalPose::resize(size_t count) {
+    translations.resize(count);
+    rotations.resize(count);
+    scales.resize(count);
+}
+
+BoneMask::BoneMask(size_t count, float weight)
+    : weights(count, weight) {
+}
+
+BoneMask BoneMask::subtree(const SkeletalModel& model, const std::string& bone, float weight) {
+    const auto& bone_map = model.getBoneMap();
+    const auto found = bone_map.find(bone);
+    if (found == bone_map.end()) {
+        throw bone_not_found(bone);
+    }
+
+    // parents precede children, so subtree membership propagates in single pass
+    const auto& skeleton = model.getFlatSkeleton();
+    BoneMask mask {skeleton.size()};
+    for (size_t i = 0; i < skeleton.size(); ++i) {
+        const auto& node = skeleton[i];
+        if (node.bone == found->second || (node.parent >= 0 && mask.weights[node.parent] > 0.0f)) {
+            mask.weights[i] = weight;
+        }
+    }
+
+    return mask;
+}
+
+BoneMask& BoneMask::set(size_t node, float weight) {
+    weights.at(node) = weight;
+    return *this;
+}
+
+void AnimationBlender::initialize(const SkeletalModel& model) {
+    const auto& skeleton = model.getFlatSkeleton();
+    const auto& bones = model.getBones();
+
+    bind_pose.resize(skeleton.size());
+    pose.resize(skeleton.size());
+    weight_sum.resize(skeleton.size());
+    animated.resize(skeleton.size());
+
+    for (size_t i = 0; i < skeleton.size(); ++i) {
+        const auto& bone = bones[skeleton[i].bone];
+        bind_pose.translations[i] = bone.position;
+        bind_pose.rotations[i] = bone.rotation;
+        bind_pose.scales[i] = bone.scale;
+    }
+}
+
+size_t AnimationBlender::add(const Animation& animation, float weight, std::shared_ptr<const BoneMask> mask, bool additive) {
+    auto& layer = layers.emplace_back();
+    layer.animation = &animation;
+    layer.cursors.assign(animation.nodes.size(), {});
+    layer.mask = std::move(mask);
+    layer.weight = weight;
+    layer.target_weight = weight;
+    layer.additive = additive;
+    return layers.size() - 1;
+}
+
+void AnimationBlender::remove(size_t index) {
+    layers.erase(layers.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+void AnimationBlender::clear() noexcept {
+    layers.clear();
+}
+
+void AnimationBlender::fade(size_t index, float target, double duration) {
+    auto& layer = layers.at(index);
+    layer.target_weight = target;
+
+    if (duration <= 0.0) {
+        layer.weight = target;
+        layer.fade_rate = 0.0f;
+    } else {
+        layer.fade_rate = static_cast<float>(std::abs(target - layer.weight) / duration);
+    }
+}
+
+size_t AnimationBlender::crossfade(const Animation& animation, double duration) {
+    for (size_t i = 0; i < layers.size(); ++i) {
+        if (!layers[i].additive) {
+            fade(i, 0.0f, duration);
+        }
+    }
+
+    const auto index = add(animation, 0.0f);
+    fade(index, 1.0f, duration);
+    return index;
+}
+
+void AnimationBlender::advance(double delta) {
+    for (auto& layer : layers) {
+        layer.time += delta * layer.speed;
+
+        if (layer.weight != layer.target_weight) {
+            const auto step = layer.fade_rate * static_cast<float>(delta);
+            layer.weight = layer.weight < layer.target_weight
+                    ? std::min(layer.weight + step, layer.target_weight)
+                    : std::max(layer.weight - step, layer.target_weight);
+        }
+    }
+
+    // faded out layers are dropped, erase keeps capacity so no reallocation happens
+    layers.erase(std::remove_if(layers.begin(), layers.end(), [] (const auto& layer) {
+        return layer.target_weight <= 0.0f && layer.weight <= 0.0f;
+    }), layers.end());
+}
+
+void AnimationBlender::accumulate(const SkeletalModel& model, AnimationLayer& layer) {
+    const auto& skeleton = model.getFlatSkeleton();
+    const auto& anim = *layer.animation;
+    const auto time = getTicks(anim, layer.time);
+
+    for (size_t i = 0; i < skeleton.size(); ++i) {
+        const auto channel = anim.bone_channels[skeleton[i].bone];
+        const auto w = layer.mask ? layer.weight * (*layer.mask)[i] : layer.weight;
+
+        // bones without channel keep bind pose, which receives the remaining weight in normalize
+        if (channel < 0 || w <= 0.0f) {
+            continue;
+        }
+
+        const auto& node = anim.nodes[channel];
+        auto& cursor = layer.cursors[channel];
+
+        const auto position = node.positionLerp(time, cursor);
+        const auto rotation = node.rotationLerp(time, cursor);
+        const auto scale = node.scalingLerp(time, cursor);
+
+        pose.translations[i] += w * (position ? *position : bind_pose.translations[i]);
+        pose.rotations[i] = pose.rotations[i] + align(bind_pose.rotations[i], rotation ? *rotation : bind_pose.rotations[i]) * w;
+        pose.scales[i] += w * (scale ? *scale : bind_pose.scales[i]);
+
+        weight_sum[i] += w;
+        animated[i] = 1;
+    }
+}
+
+void AnimationBlender::normalize() {
+    for (size_t i = 0; i < pose.size(); ++i) {
+        const auto rest = std::max(0.0f, 1.0f - weight_sum[i]);
+        const auto total = std::max(1.0f, weight_sum[i]);
+
+        pose.translations[i] = (pose.translations[i] + bind_pose.translations[i] * rest) / total;
+        pose.rotations[i] = glm::normalize(pose.rotations[i] + bind_pose.rotations[i] * rest);
+        pose.scales[i] = (pose.scales[i] + bind_pose.scales[i] * rest) / total;
+    }
+}
+
+void AnimationBlender::applyAdditive(const SkeletalModel& model, AnimationLayer& layer) {
+    const auto& skeleton = model.getFlatSkeleton();
+    const auto& anim = *layer.animation;
+    const auto time = getTicks(anim, layer.time);
+    const auto identity = glm::fquat {1.0f, 0.0f, 0.0f, 0.0f};
+
+    for (size_t i = 0; i < skeleton.size(); ++i) {
+        const auto channel = anim.bone_channels[skeleton[i].bone];
+        const auto w = layer.mask ? layer.weight * (*layer.mask)[i] : layer.weight;
+
+        if (channel < 0 || w <= 0.0f) {
+            continue;
+        }
+
+        const auto& node = anim.nodes[channel];
+        auto& cursor = layer.cursors[channel];
+
+        // difference between clip and bind pose is added on top
+        if (const auto position = node.positionLerp(time, cursor); position) {
+            pose.translations[i] += w * (*position - bind_pose.translations[i]);
+        }
+
+        if (const auto rotation = node.rotationLerp(time, cursor); rotation) {
+            const auto delta = *rotation * glm::inverse(bind_pose.rotations[i]);
+            pose.rotations[i] = glm::normalize(nlerp(identity, delta, w) * pose.rotations[i]);
+        }
+
+        if (const auto scale = node.scalingLerp(time, cursor); scale) {
+            pose.scales[i] *= glm::mix(glm::vec3{1.0f}, *scale / bind_pose.scales[i], w);
+        }
+
+        animated[i] = 1;
+    }
+}
+
+void AnimationBlender::compose(const SkeletalModel& model, std::vector<glm::mat4>& global_transform, std::vector<glm::mat4>& bone_transform) const {
+    const auto& skeleton = model.getFlatSkeleton();
+    const auto& bones = model.getBones();
+
+    for (size_t i = 0; i < skeleton.size(); ++i) {
+        const auto& node = skeleton[i];
+        const auto& bone = bones[node.bone];
+
+        glm::mat4 local_transform;
+        if (animated[i]) {
+            // translate * rotate * scale without intermediate matrix products
+            local_transform = glm::mat4_cast(pose.rotations[i]);
+            local_transform[0] *= pose.scales[i].x;
+            local_transform[1] *= pose.scales[i].y;
+            local_transform[2] *= pose.scales[i].z;
+            local_transform[3] = glm::vec4(pose.translations[i], 1.0f);
+        } else {
+            local_transform = bone.node_transform;
+        }
+
+        global_transform[i] = node.parent < 0 ? local_transform : global_transform[node.parent] * local_transform;
+
+        if (bone.joint_index) {
+            bone_transform[*bone.joint_index] = global_transform[i] * bone.offset_matrix;
+        }
+    }
+}
+
+void AnimationBlender::evaluate(const SkeletalModel& model, std::vector<glm::mat4>& global_transform, std::vector<glm::mat4>& bone_transform) {
+    std::fill(pose.translations.begin(), pose.translations.end(), glm::vec3{0.0f});
+    std::fill(pose.rotations.begin(), pose.rotations.end(), glm::fquat{0.0f, 0.0f, 0.0f, 0.0f});
+    std::fill(pose.scales.begin(), pose.scales.end(), glm::vec3{0.0f});
+    std::fill(weight_sum.begin(), weight_sum.end(), 0.0f);
+    std::fill(animated.begin(), animated.end(), uint8_t{0});
+
+    for (auto& layer : layers) {
+        if (!layer.additive) {
+            accumulate(model, layer);
+        }
+    }
+
+    normalize();
+
+    for (auto& layer : layers) {
+        if (layer.additive) {
+            applyAdditive(model, layer);
+        }
+    }
+
+    compose(model, global_transform, bone_transform);
+}
+
+bool AnimationBlender::isSingleClip() const noexcept {
+    if (layers.size() != 1) {
+        return false;
+    }
+
+    const auto& layer = layers.front();
+    return !layer.additive && !layer.mask && layer.speed == 1.0f && layer.weight == 1.0f && layer.target_weight == 1.0f;
+}
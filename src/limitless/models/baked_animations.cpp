@@ -0,0 +1,80 @@
+#include <limitless/models/baked_animations.hpp>
+#include <limitless/models/skeletal_model.hpp>
+#include <limitless/instances/skeletal_instance.hpp>
+#include <limitless/core/buffer/buffer_builder.hpp>
+#include <limitless/core/context.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Limitless;
+
+[[maybe_unused]] constexpr auto BAKED_PALETTE_BUFFER_NAME = "baked_palette_buffer";
+[[maybe_unused]] constexpr auto BAKED_CLIP_BUFFER_NAME = "baked_clip_buffer";
+
+BakedAnimations::BakedAnimations(const SkeletalModel& model, double _sample_rate)
+    : sample_rate {_sample_rate} {
+    bake(model);
+}
+
+void BakedAnimations::bake(const SkeletalModel& model) {
+    const auto& bones = model.getBones();
+    joint_count = static_cast<uint32_t>(std::count_if(bones.begin(), bones.end(), [](const auto& bone) {
+        return bone.joint_index.has_value();
+    }));
+
+    std::vector<AnimationNode::Cursor> cursors;
+    std::vector<glm::mat4> global_transform(model.getFlatSkeleton().size(), glm::mat4(1.0f));
+    std::vector<glm::mat4> bone_transform(joint_count, glm::mat4(1.0f));
+
+    for (const auto& animation : model.getAnimations()) {
+        const auto tps = animation.tps > 0.0 ? animation.tps : 1.0;
+        const auto duration = animation.duration / tps;
+
+        // last frame samples the very end of animation, so blending never wraps in shader
+        const auto frame_count = static_cast<uint32_t>(std::ceil(duration * sample_rate)) + 1;
+
+        clips.push_back({static_cast<uint32_t>(palettes.size() / std::max(joint_count, 1u)), frame_count, joint_count, static_cast<float>(sample_rate)});
+        durations.emplace_back(duration);
+        names.emplace_back(animation.name);
+
+        // frames are sampled in order, so cursors advance sequentially
+        cursors.assign(animation.nodes.size(), {});
+        for (uint32_t frame = 0; frame < frame_count; ++frame) {
+            const auto time = std::min(static_cast<double>(frame) / sample_rate * tps, animation.duration);
+            model.evaluatePose(animation, time, cursors, global_transform, bone_transform);
+            palettes.insert(palettes.end(), bone_transform.begin(), bone_transform.end());
+        }
+    }
+}
+
+void BakedAnimations::initializeBuffers() {
+    palette_buffer = Buffer::builder()
+            .target(Buffer::Type::ShaderStorage)
+            .usage(Buffer::Usage::StaticDraw)
+            .access(Buffer::MutableAccess::None)
+            .data(palettes.data())
+            .size(std::max<size_t>(palettes.size(), 1) * sizeof(glm::mat4))
+            .build();
+
+    clip_buffer = Buffer::builder()
+            .target(Buffer::Type::ShaderStorage)
+            .usage(Buffer::Usage::StaticDraw)
+            .access(Buffer::MutableAccess::None)
+            .data(clips.data())
+            .size(std::max<size_t>(clips.size(), 1) * sizeof(Clip))
+            .build();
+}
+
+void BakedAnimations::bind(Context& ctx) const {
+    palette_buffer->bindBase(ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, BAKED_PALETTE_BUFFER_NAME));
+    clip_buffer->bindBase(ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, BAKED_CLIP_BUFFER_NAME));
+}
+
+uint32_t BakedAnimations::getAnimationIndex(const std::string& name) const {
+    const auto found = std::find(names.begin(), names.end(), name);
+    if (found == names.end()) {
+        throw no_such_animation("with name " + name);
+    }
+    return static_cast<uint32_t>(std::distance(names.begin(), found));
+}
@@ -0,0 +1,255 @@
+#include <limitless/models/compressed_track.hpp>
+#include <limitless/models/skeletal_model.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Limitless;
+
+namespace {
+    constexpr float SQRT2 = 1.41421356f;
+    constexpr uint64_t COMPONENT_MASK = 0x7fff;
+    constexpr float COMPONENT_MAX = static_cast<float>(COMPONENT_MASK);
+    constexpr float SAMPLE_MAX = 65535.0f;
+
+    glm::vec3 interpolate(const glm::vec3& a, const glm::vec3& b, float t) noexcept {
+        return glm::mix(a, b, t);
+    }
+
+    glm::fquat interpolate(const glm::fquat& a, const glm::fquat& b, float t) noexcept {
+        return glm::normalize(glm::slerp(a, b, t));
+    }
+
+    /**
+     * Evaluates source track the same way AnimationNode does, clamping outside of key range
+     */
+    template<typename T>
+    T evaluate(const std::vector<KeyFrame<T>>& keys, double time) {
+        if (time <= keys.front().time) {
+            return keys.front().data;
+        }
+        if (time >= keys.back().time) {
+            return keys.back().data;
+        }
+
+        const auto it = std::lower_bound(keys.begin(), keys.end(), time, [] (const auto& key, double t) {
+            return key.time < t;
+        });
+        const auto& b = *it;
+        const auto& a = *(it - 1);
+        return interpolate(a.data, b.data, static_cast<float>((time - a.time) / (b.time - a.time)));
+    }
+
+    float distance(const glm::vec3& a, const glm::vec3& b) noexcept {
+        const auto d = glm::abs(a - b);
+        return std::max(d.x, std::max(d.y, d.z));
+    }
+
+    float distance(const glm::fquat& a, const glm::fquat& b) noexcept {
+        return 2.0f * std::acos(std::min(1.0f, std::abs(glm::dot(a, b))));
+    }
+
+    /**
+     * Maximum error of compressed track at source keys and in the middle of source segments
+     */
+    template<typename T, typename Track>
+    float measureError(const std::vector<KeyFrame<T>>& keys, const Track& track) {
+        float error = 0.0f;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            error = std::max(error, distance(keys[i].data, track.sample(keys[i].time)));
+
+            if (i + 1 < keys.size()) {
+                const auto middle = (keys[i].time + keys[i + 1].time) * 0.5;
+                error = std::max(error, distance(evaluate(keys, middle), track.sample(middle)));
+            }
+        }
+        return error;
+    }
+
+    bool isConstant(const std::vector<KeyFrame<glm::vec3>>& keys, float error) {
+        return std::all_of(keys.begin(), keys.end(), [&] (const auto& key) { return distance(key.data, keys.front().data) <= error; });
+    }
+
+    bool isConstant(const std::vector<KeyFrame<glm::fquat>>& keys, float error) {
+        return std::all_of(keys.begin(), keys.end(), [&] (const auto& key) { return distance(key.data, keys.front().data) <= error; });
+    }
+
+    /**
+     * Tries sample counts 2, 3, 5, 9, ... until error is within threshold
+     *
+     * count is limited by twice the source key count; unevenly spaced keys may still not fit,
+     * then there is no track and keys are kept as they are
+     */
+    template<typename T, typename Track, typename Build>
+    std::optional<Track> compressUniform(const std::vector<KeyFrame<T>>& keys, float error, Build&& build) {
+        if (keys.empty()) {
+            return Track {};
+        }
+
+        if (keys.size() == 1 || keys.back().time <= keys.front().time || isConstant(keys, error * 0.5f)) {
+            return build(keys, 1);
+        }
+
+        const auto limit = keys.size() * 2;
+        for (size_t count = 2; ; count = (count - 1) * 2 + 1) {
+            auto track = build(keys, std::min(count, limit));
+            if (measureError(keys, track) <= error) {
+                return track;
+            }
+
+            if (count >= limit) {
+                return std::nullopt;
+            }
+        }
+    }
+}
+
+QuantizedQuat QuantizedQuat::encode(const glm::fquat& q) noexcept {
+    const float v[4] = {q.x, q.y, q.z, q.w};
+
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; ++i) {
+        if (std::abs(v[i]) > std::abs(v[largest])) {
+            largest = i;
+        }
+    }
+
+    // q and -q are the same rotation, so largest component is always positive
+    const auto sign = v[largest] < 0.0f ? -1.0f : 1.0f;
+
+    uint64_t bits = largest;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+
+        const auto normalized = glm::clamp((v[i] * sign * SQRT2 + 1.0f) * 0.5f, 0.0f, 1.0f);
+        bits = (bits << 15) | static_cast<uint64_t>(std::lround(normalized * COMPONENT_MAX));
+    }
+
+    return {{
+        static_cast<uint16_t>(bits & 0xffff),
+        static_cast<uint16_t>((bits >> 16) & 0xffff),
+        static_cast<uint16_t>((bits >> 32) & 0xffff)
+    }};
+}
+
+glm::fquat QuantizedQuat::decode() const noexcept {
+    const auto bits = static_cast<uint64_t>(data[0]) | (static_cast<uint64_t>(data[1]) << 16) | (static_cast<uint64_t>(data[2]) << 32);
+    const auto largest = static_cast<uint32_t>((bits >> 45) & 0x3);
+
+    float v[4];
+    float sum = 0.0f;
+    uint32_t shift = 30;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+
+        const auto component = static_cast<float>((bits >> shift) & COMPONENT_MASK) / COMPONENT_MAX;
+        v[i] = (component * 2.0f - 1.0f) / SQRT2;
+        sum += v[i] * v[i];
+        shift -= 15;
+    }
+    v[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+
+    return glm::normalize(glm::fquat{v[3], v[0], v[1], v[2]});
+}
+
+glm::vec3 CompressedVec3Track::decode(size_t index) const noexcept {
+    const auto& s = samples[index];
+    return min + extent * glm::vec3(s[0], s[1], s[2]) / SAMPLE_MAX;
+}
+
+std::optional<CompressedVec3Track> CompressedVec3Track::compress(const std::vector<KeyFrame<glm::vec3>>& keys, float error) {
+    return compressUniform<glm::vec3, CompressedVec3Track>(keys, error, [] (const auto& source, size_t count) {
+        CompressedVec3Track track;
+        track.start = static_cast<float>(source.front().time);
+        track.inv_step = count > 1 ? static_cast<float>((count - 1) / (source.back().time - source.front().time)) : 0.0f;
+
+        std::vector<glm::vec3> values(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto time = count > 1 ? source.front().time + static_cast<double>(i) / track.inv_step : source.front().time;
+            values[i] = evaluate(source, time);
+        }
+
+        glm::vec3 max = values.front();
+        track.min = values.front();
+        for (const auto& value : values) {
+            track.min = glm::min(track.min, value);
+            max = glm::max(max, value);
+        }
+        track.extent = max - track.min;
+
+        track.samples.reserve(count);
+        for (const auto& value : values) {
+            const auto normalized = glm::vec3 {
+                track.extent.x > 0.0f ? (value.x - track.min.x) / track.extent.x : 0.0f,
+                track.extent.y > 0.0f ? (value.y - track.min.y) / track.extent.y : 0.0f,
+                track.extent.z > 0.0f ? (value.z - track.min.z) / track.extent.z : 0.0f
+            };
+            track.samples.push_back({
+                static_cast<uint16_t>(std::lround(normalized.x * SAMPLE_MAX)),
+                static_cast<uint16_t>(std::lround(normalized.y * SAMPLE_MAX)),
+                static_cast<uint16_t>(std::lround(normalized.z * SAMPLE_MAX))
+            });
+        }
+
+        return track;
+    });
+}
+
+glm::vec3 CompressedVec3Track::sample(double time) const noexcept {
+    if (samples.size() == 1) {
+        return decode(0);
+    }
+
+    const auto position = glm::clamp(static_cast<float>(time - start) * inv_step, 0.0f, static_cast<float>(samples.size() - 1));
+    const auto index = std::min(static_cast<size_t>(position), samples.size() - 2);
+    const auto factor = position - static_cast<float>(index);
+
+    return glm::mix(decode(index), decode(index + 1), factor);
+}
+
+size_t CompressedVec3Track::getMemoryUsage() const noexcept {
+    return sizeof(CompressedVec3Track) + samples.capacity() * sizeof(samples[0]);
+}
+
+std::optional<CompressedQuatTrack> CompressedQuatTrack::compress(const std::vector<KeyFrame<glm::fquat>>& keys, float error) {
+    return compressUniform<glm::fquat, CompressedQuatTrack>(keys, error, [] (const auto& source, size_t count) {
+        CompressedQuatTrack track;
+        track.start = static_cast<float>(source.front().time);
+        track.inv_step = count > 1 ? static_cast<float>((count - 1) / (source.back().time - source.front().time)) : 0.0f;
+
+        track.samples.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto time = count > 1 ? source.front().time + static_cast<double>(i) / track.inv_step : source.front().time;
+            track.samples.push_back(QuantizedQuat::encode(evaluate(source, time)));
+        }
+
+        return track;
+    });
+}
+
+glm::fquat CompressedQuatTrack::sample(double time) const noexcept {
+    if (samples.size() == 1) {
+        return samples[0].decode();
+    }
+
+    const auto position = glm::clamp(static_cast<float>(time - start) * inv_step, 0.0f, static_cast<float>(samples.size() - 1));
+    const auto index = std::min(static_cast<size_t>(position), samples.size() - 2);
+    const auto factor = position - static_cast<float>(index);
+
+    // decoded quaternions may lie in opposite hemispheres, nlerp takes the shortest path
+    const auto a = samples[index].decode();
+    auto b = samples[index + 1].decode();
+    if (glm::dot(a, b) < 0.0f) {
+        b = -b;
+    }
+
+    return glm::normalize(a * (1.0f - factor) + b * factor);
+}
+
+size_t CompressedQuatTrack::getMemoryUsage() const noexcept {
+    return sizeof(CompressedQuatTrack) + samples.capacity() * sizeof(QuantizedQuat);
+}
@@ -0,0 +1,85 @@
+#include <limitless/models/pose_cache.hpp>
+#include <limitless/models/skeletal_model.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Limitless;
+
+PoseCache::PoseCache(double _sample_rate) noexcept
+    : released {std::make_shared<std::vector<std::unique_ptr<Pose>>>()}
+    , sample_rate {_sample_rate} {
+}
+
+uint64_t PoseCache::getFrame(const Animation& animation, double time) const noexcept {
+    const auto tps = animation.tps > 0.0 ? animation.tps : 1.0;
+    return static_cast<uint64_t>(std::floor(time / tps * sample_rate));
+}
+
+double PoseCache::getFrameTime(const Animation& animation, uint64_t frame) const noexcept {
+    const auto tps = animation.tps > 0.0 ? animation.tps : 1.0;
+    return static_cast<double>(frame) / sample_rate * tps;
+}
+
+std::shared_ptr<PoseCache::Pose> PoseCache::find(const Animation& animation, uint64_t frame) {
+    if (const auto found = poses.find({&animation, frame}); found != poses.end()) {
+        if (auto pose = found->second.lock()) {
+            ++stats.hits;
+            return pose;
+        }
+        poses.erase(found);
+    }
+
+    ++stats.misses;
+    return nullptr;
+}
+
+std::shared_ptr<PoseCache::Pose> PoseCache::acquire() {
+    std::unique_ptr<Pose> pose;
+    if (released->empty()) {
+        pose = std::make_unique<Pose>();
+        ++stats.allocations;
+    } else {
+        pose = std::move(released->back());
+        released->pop_back();
+    }
+
+    // last user returns pose to cache; it is deleted if cache is gone by then
+    return {pose.release(), [pool = std::weak_ptr {released}] (Pose* p) {
+        if (auto list = pool.lock()) {
+            list->emplace_back(p);
+        } else {
+            delete p;
+        }
+    }};
+}
+
+void PoseCache::insert(const Animation& animation, uint64_t frame, const std::shared_ptr<Pose>& pose) {
+    poses[{&animation, frame}] = pose;
+
+    if (poses.size() >= cleanup_threshold) {
+        removeExpired();
+        cleanup_threshold = std::max<size_t>(64, poses.size() * 2);
+    }
+}
+
+void PoseCache::removeExpired() {
+    for (auto it = poses.begin(); it != poses.end(); ) {
+        if (it->second.expired()) {
+            it = poses.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PoseCache::setSampleRate(double rate) noexcept {
+    sample_rate = rate;
+    clear();
+}
+
+void PoseCache::clear() noexcept {
+    poses.clear();
+    released->clear();
+    cleanup_threshold = 64;
+}
@@ -1,5 +1,7 @@
 #include <limitless/models/skeletal_model.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 #include <stdexcept>
+#include <algorithm>
 
 using namespace Limitless;
 
@@ -10,101 +12,228 @@ AnimationNode::AnimationNode(decltype(positions) _positions, decltype(rotations)
     , bone(_bone) {
 }
 
-size_t AnimationNode::findPositionKeyframe(double anim_time) const {
-    for (size_t i = 0; i < positions.size() - 1; ++i) {
-        if (anim_time <= positions[i + 1].time) {
-            return i;
+namespace {
+    /**
+     * Returns index of the first keyframe of segment [i, i + 1] containing time
+     *
+     * time past the last keyframe maps to the first segment
+     */
+    template<typename T>
+    size_t searchKeyframe(const std::vector<KeyFrame<T>>& keys, double time) {
+        const auto it = std::lower_bound(keys.begin() + 1, keys.end(), time, [] (const auto& key, double t) {
+            return key.time < t;
+        });
+
+        if (it == keys.end()) {
+            return 0;
+        }
+
+        return static_cast<size_t>(std::distance(keys.begin(), it)) - 1;
+    }
+
+    template<typename T>
+    bool isInSegment(const std::vector<KeyFrame<T>>& keys, size_t i, double time) {
+        return time <= keys[i + 1].time && (i == 0 || time > keys[i].time);
+    }
+
+    template<typename T>
+    size_t findKeyframe(const std::vector<KeyFrame<T>>& keys, double time, size_t& cursor) {
+        const auto last = keys.size() - 2;
+
+        if (cursor <= last) {
+            if (isInSegment(keys, cursor, time)) {
+                return cursor;
+            }
+
+            if (cursor < last && isInSegment(keys, cursor + 1, time)) {
+                return ++cursor;
+            }
+        }
+
+        cursor = searchKeyframe(keys, time);
+        return cursor;
+    }
+
+    /**
+     * Gets value of the first or the last keyframe when time is outside of track
+     *
+     * tracks are clamped at their ends, the same as compressed ones
+     */
+    template<typename T>
+    std::optional<T> getClampedValue(const std::vector<KeyFrame<T>>& keys, double time) {
+        if (time <= keys.front().time) {
+            return keys.front().data;
+        }
+
+        if (time >= keys.back().time) {
+            return keys.back().data;
         }
+
+        return std::nullopt;
     }
-    return 0;
-    throw std::out_of_range("no position keyframe for time " + std::to_string(anim_time));
+
+    // keyframes of compressed tracks are released by compress, compressed tracks are sampled only by lerp functions
+    template<typename T>
+    void checkKeyframes(const AnimationNode& node, const std::vector<KeyFrame<T>>& keys) {
+        if (node.compressed && keys.empty()) {
+            throw std::logic_error("Keyframes of compressed animation node are released");
+        }
+    }
+
+    template<typename T>
+    double getSegmentFactor(const std::vector<KeyFrame<T>>& keys, size_t index, double time) {
+        const auto& a = keys[index];
+        const auto& b = keys[index + 1];
+        return (time - a.time) / (b.time - a.time);
+    }
+}
+
+size_t AnimationNode::findPositionKeyframe(double anim_time) const {
+    checkKeyframes(*this, positions);
+    return searchKeyframe(positions, anim_time);
 }
 
 size_t AnimationNode::findRotationKeyframe(double anim_time) const {
-    for (size_t i = 0; i < rotations.size() - 1; ++i) {
-        if (anim_time <= rotations[i + 1].time)
-            return i;
-    }
-	return 0;
-    throw std::out_of_range("no rotation keyframe for time " + std::to_string(anim_time));
+    checkKeyframes(*this, rotations);
+    return searchKeyframe(rotations, anim_time);
 }
 
 size_t AnimationNode::findScalingKeyframe(double anim_time) const {
-    for (size_t i = 0; i < scales.size() - 1; ++i) {
-        if (anim_time <= scales[i + 1].time)
-            return i;
-    }
-    return 0;
-    throw std::out_of_range("no scaling keyframe for time " + std::to_string(anim_time));
+    checkKeyframes(*this, scales);
+    return searchKeyframe(scales, anim_time);
+}
+
+size_t AnimationNode::findPositionKeyframe(double anim_time, size_t& cursor) const {
+    checkKeyframes(*this, positions);
+    return findKeyframe(positions, anim_time, cursor);
+}
+
+size_t AnimationNode::findRotationKeyframe(double anim_time, size_t& cursor) const {
+    checkKeyframes(*this, rotations);
+    return findKeyframe(rotations, anim_time, cursor);
+}
+
+size_t AnimationNode::findScalingKeyframe(double anim_time, size_t& cursor) const {
+    checkKeyframes(*this, scales);
+    return findKeyframe(scales, anim_time, cursor);
 }
 
 std::optional<glm::vec3> AnimationNode::positionLerp(double anim_time) const {
+    Cursor cursor {positions.size(), rotations.size(), scales.size()};
+    return positionLerp(anim_time, cursor);
+}
+
+std::optional<glm::fquat> AnimationNode::rotationLerp(double anim_time) const {
+    Cursor cursor {positions.size(), rotations.size(), scales.size()};
+    return rotationLerp(anim_time, cursor);
+}
+
+std::optional<glm::vec3> AnimationNode::scalingLerp(double anim_time) const {
+    Cursor cursor {positions.size(), rotations.size(), scales.size()};
+    return scalingLerp(anim_time, cursor);
+}
+
+std::optional<glm::vec3> AnimationNode::positionLerp(double anim_time, Cursor& cursor) const {
+    if (compressed && positions.empty()) {
+        return compressed_positions.empty() ? std::nullopt : std::make_optional(compressed_positions.sample(anim_time));
+    }
+
     if (positions.empty()) {
         return std::nullopt;
     }
 
-    if (positions.size() == 1) {
-        return positions[0].data;
+    if (const auto clamped = getClampedValue(positions, anim_time)) {
+        return clamped;
     }
 
-    auto index = findPositionKeyframe(anim_time);
-    auto& a = positions[index];
-    auto& b = positions[index + 1];
-
-    double dt = b.time - a.time;
-    double norm = (anim_time - a.time) / dt;
+    const auto index = findPositionKeyframe(anim_time, cursor.position);
+    const auto norm = getSegmentFactor(positions, index, anim_time);
 
-//    if (!(norm >= 0.f && norm <= 1.f)) {
-//        throw std::runtime_error("norm >= 0.f && norm <= 1.f");
-//    }
-
-//    return glm::mix(a.data, b.data, norm);
-    return a.data * (float)(1.0 - norm) + b.data * (float)norm;
+    return positions[index].data * (float)(1.0 - norm) + positions[index + 1].data * (float)norm;
 }
 
-std::optional<glm::fquat> AnimationNode::rotationLerp(double anim_time) const {
+std::optional<glm::fquat> AnimationNode::rotationLerp(double anim_time, Cursor& cursor) const {
+    if (compressed && rotations.empty()) {
+        return compressed_rotations.empty() ? std::nullopt : std::make_optional(compressed_rotations.sample(anim_time));
+    }
+
     if (rotations.empty()) {
         return std::nullopt;
     }
-    if (rotations.size() == 1) {
-        return rotations[0].data;
-    }
-
-    auto index = findRotationKeyframe(anim_time);
-    auto& a = rotations[index];
-    auto& b = rotations[index + 1];
 
-    double dt = b.time - a.time;
-    double norm = (anim_time - a.time) / dt;
+    if (const auto clamped = getClampedValue(rotations, anim_time)) {
+        return clamped;
+    }
 
-//    if (!(norm >= 0.f && norm <= 1.f)) {
-//        throw std::runtime_error("norm >= 0.f && norm <= 1.f");
-//    }
+    const auto index = findRotationKeyframe(anim_time, cursor.rotation);
+    const auto norm = getSegmentFactor(rotations, index, anim_time);
 
-    return glm::normalize(glm::slerp(a.data, b.data, static_cast<float>(norm)));
+    return glm::normalize(glm::slerp(rotations[index].data, rotations[index + 1].data, static_cast<float>(norm)));
 }
 
-std::optional<glm::vec3> AnimationNode::scalingLerp(double anim_time) const {
+std::optional<glm::vec3> AnimationNode::scalingLerp(double anim_time, Cursor& cursor) const {
+    if (compressed && scales.empty()) {
+        return compressed_scales.empty() ? std::nullopt : std::make_optional(compressed_scales.sample(anim_time));
+    }
+
     if (scales.empty()) {
         return std::nullopt;
     }
 
-    if (scales.size() == 1) {
-        return scales[0].data;
+    if (const auto clamped = getClampedValue(scales, anim_time)) {
+        return clamped;
     }
 
-    auto index = findScalingKeyframe(anim_time);
-    auto a = scales[index];
-    auto b = scales[index + 1];
+    const auto index = findScalingKeyframe(anim_time, cursor.scaling);
+    const auto norm = getSegmentFactor(scales, index, anim_time);
 
-    double dt = b.time - a.time;
-    double norm = (anim_time - a.time) / dt;
+    return glm::mix(scales[index].data, scales[index + 1].data, norm);
+}
 
-//    if (!(norm >= 0.f && norm <= 1.f)) {
-//        throw std::runtime_error("norm >= 0.f && norm <= 1.f");
-//    }
+void AnimationNode::compress(const CompressionSettings& settings) {
+    // tracks that cannot be compressed within error keep their keyframes
+    if (auto track = CompressedVec3Track::compress(positions, settings.position_error)) {
+        compressed_positions = std::move(*track);
+        decltype(positions){}.swap(positions);
+    }
 
-    return glm::mix(a.data, b.data, norm);
+    if (auto track = CompressedQuatTrack::compress(rotations, settings.rotation_error)) {
+        compressed_rotations = std::move(*track);
+        decltype(rotations){}.swap(rotations);
+    }
+
+    if (auto track = CompressedVec3Track::compress(scales, settings.scale_error)) {
+        compressed_scales = std::move(*track);
+        decltype(scales){}.swap(scales);
+    }
+
+    compressed = true;
+}
+
+size_t AnimationNode::getMemoryUsage() const noexcept {
+    return sizeof(AnimationNode)
+         + positions.capacity() * sizeof(KeyFrame<glm::vec3>)
+         + rotations.capacity() * sizeof(KeyFrame<glm::fquat>)
+         + scales.capacity() * sizeof(KeyFrame<glm::vec3>)
+         + compressed_positions.getMemoryUsage() - sizeof(CompressedVec3Track)
+         + compressed_rotations.getMemoryUsage() - sizeof(CompressedQuatTrack)
+         + compressed_scales.getMemoryUsage() - sizeof(CompressedVec3Track);
+}
+
+void Animation::compress(const CompressionSettings& settings) {
+    for (auto& node : nodes) {
+        if (!node.compressed) {
+            node.compress(settings);
+        }
+    }
+}
+
+size_t Animation::getMemoryUsage() const noexcept {
+    size_t usage = sizeof(Animation) + bone_channels.capacity() * sizeof(int32_t);
+    for (const auto& node : nodes) {
+        usage += node.getMemoryUsage();
+    }
+    return usage;
 }
 
 SkeletalModel::SkeletalModel(
@@ -121,4 +250,94 @@ SkeletalModel::SkeletalModel(
     , animations {std::move(_animations)}
     , bones {std::move(_bones)}
     , skeletons {std::move(_skeletons)} {
+    initializeSkeleton();
+}
+
+void SkeletalModel::initializeSkeleton() {
+    flat_skeleton.clear();
+    flat_skeleton.reserve(bones.size());
+
+    // explicit stack instead of recursion, parent is pushed before children
+    std::vector<std::pair<const Tree<uint32_t>*, int32_t>> stack;
+    for (auto it = skeletons.rbegin(); it != skeletons.rend(); ++it) {
+        stack.emplace_back(&*it, -1);
+    }
+
+    while (!stack.empty()) {
+        const auto [node, parent] = stack.back();
+        stack.pop_back();
+
+        const auto index = static_cast<int32_t>(flat_skeleton.size());
+        flat_skeleton.push_back({**node, parent, node->size() == 0});
+
+        for (auto i = node->size(); i > 0; --i) {
+            stack.emplace_back(&(*node)[i - 1], index);
+        }
+    }
+
+    for (auto& animation : animations) {
+        animation.bone_channels.assign(bones.size(), -1);
+
+        for (size_t i = 0; i < animation.nodes.size(); ++i) {
+            const auto bone = &animation.nodes[i].bone - bones.data();
+            if (bone >= 0 && static_cast<size_t>(bone) < bones.size()) {
+                animation.bone_channels[bone] = static_cast<int32_t>(i);
+            }
+        }
+    }
+}
+
+size_t SkeletalModel::evaluatePose(
+    const Animation& anim,
+    double animation_time,
+    std::vector<AnimationNode::Cursor>& cursors,
+    std::vector<glm::mat4>& global_transform,
+    std::vector<glm::mat4>& bone_transform,
+    bool skip_leaves
+) const {
+    size_t sampled = 0;
+
+    // parents precede children in flattened skeleton, so single pass computes all global transforms
+    for (size_t i = 0; i < flat_skeleton.size(); ++i) {
+        const auto& node = flat_skeleton[i];
+        const auto& bone = bones[node.bone];
+
+        glm::mat4 local_transform;
+        if (const auto channel = anim.bone_channels[node.bone]; channel >= 0 && !(skip_leaves && node.leaf)) {
+            ++sampled;
+
+            const auto& anim_node = anim.nodes[channel];
+            auto& cursor = cursors[channel];
+
+            auto maybe_anim_position = anim_node.positionLerp(animation_time, cursor);
+            auto maybe_anim_rotation = anim_node.rotationLerp(animation_time, cursor);
+            auto maybe_anim_scale = anim_node.scalingLerp(animation_time, cursor);
+
+            auto position = maybe_anim_position? *maybe_anim_position : bone.position;
+            auto rotation = maybe_anim_rotation? *maybe_anim_rotation : bone.rotation;
+            auto scale = maybe_anim_scale? *maybe_anim_scale : bone.scale;
+
+            auto translate = glm::translate(glm::mat4(1.f), position);
+            auto rotate = glm::mat4_cast(rotation);
+            auto scale_mat = glm::scale(glm::mat4(1.f), scale);
+
+            local_transform = translate * rotate * scale_mat;
+        } else {
+            local_transform = bone.node_transform;
+        }
+
+        global_transform[i] = node.parent < 0 ? local_transform : global_transform[node.parent] * local_transform;
+
+        if (bone.joint_index) {
+            bone_transform[*bone.joint_index] = global_transform[i] * bone.offset_matrix;
+        }
+    }
+
+    return sampled;
+}
+
+void SkeletalModel::compressAnimations(const CompressionSettings& settings) {
+    for (auto& animation : animations) {
+        animation.compress(settings);
+    }
 }
@@ -53,6 +53,14 @@ bool InstanceRenderer::shouldBeRendered(const Instance &instance, const DrawPara
         return false;
     }
 
+    if (drawp.filter == GeometryFilter::Static && !instance.isStatic()) {
+        return false;
+    }
+
+    if (drawp.filter == GeometryFilter::Dynamic && instance.isStatic()) {
+        return false;
+    }
+
     return true;
 }
 
@@ -64,6 +72,15 @@ void InstanceRenderer::renderScene(const DrawParameters& drawp) {
     }
 
     // renders batched effect instances
+    // effects are always considered dynamic
+    if (drawp.filter == GeometryFilter::Static) {
+        return;
+    }
+
+    renderEffects(drawp);
+}
+
+void InstanceRenderer::renderEffects(const DrawParameters& drawp) {
     effect_renderer.draw(drawp.ctx, drawp.assets, drawp.type, drawp.blending, drawp.setter);
 }
 
@@ -75,6 +92,74 @@ void InstanceRenderer::renderDecals(const DrawParameters& drawp) {
     }
 }
 
+void InstanceRenderer::renderIntersectingInstancedInstance(InstancedInstance& instance, const Frustum& frustum, const DrawParameters& drawp) {
+    if (!shouldBeRendered(instance, drawp)) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<ModelInstance>> intersecting;
+    for (const auto& i : instance.getInstances()) {
+        if (frustum.intersects(*i)) {
+            intersecting.emplace_back(i);
+        }
+    }
+
+    if (intersecting.empty()) {
+        return;
+    }
+
+    // visible subset is set again by frustum culling in next camera pass
+    instance.setVisible(intersecting);
+
+    if (instance.getInstanceType() == InstanceType::SkeletalInstanced) {
+        render(static_cast<SkeletalInstancedInstance&>(instance), drawp); //NOLINT
+    } else {
+        render(instance, drawp);
+    }
+}
+
+void InstanceRenderer::renderIntersecting(Scene& scene, const Frustum& frustum, const DrawParameters& drawp) {
+    for (const auto& instance : scene.getInstances()) {
+        // filter is checked before intersection, which is the costly part
+        if (!shouldBeRendered(*instance, drawp)) {
+            continue;
+        }
+
+        switch (instance->getInstanceType()) {
+            case InstanceType::Instanced:
+            case InstanceType::SkeletalInstanced:
+                renderIntersectingInstancedInstance(static_cast<InstancedInstance&>(*instance), frustum, drawp); //NOLINT
+                break;
+            case InstanceType::Terrain: {
+                auto& terrain = static_cast<TerrainInstance&>(*instance); //NOLINT
+
+                // terrain parts follow static state of terrain itself
+                auto parts_drawp = drawp;
+                parts_drawp.filter = GeometryFilter::All;
+
+                renderIntersectingInstancedInstance(*terrain.mesh.tiles, frustum, parts_drawp);
+                renderIntersectingInstancedInstance(*terrain.mesh.fillers, frustum, parts_drawp);
+                renderIntersectingInstancedInstance(*terrain.mesh.trims, frustum, parts_drawp);
+                renderIntersectingInstancedInstance(*terrain.mesh.seams, frustum, parts_drawp);
+
+                if (frustum.intersects(*terrain.mesh.cross)) {
+                    render(*terrain.mesh.cross, parts_drawp);
+                }
+                break;
+            }
+            case InstanceType::Model:
+            case InstanceType::Skeletal:
+                if (frustum.intersects(*instance)) {
+                    render(*instance, drawp);
+                }
+                break;
+            case InstanceType::Effect:
+            case InstanceType::Decal:
+                break;
+        }
+    }
+}
+
 void InstanceRenderer::render(ModelInstance& instance, const DrawParameters& drawp) {
     if (!shouldBeRendered(instance, drawp)) {
         return;
@@ -101,12 +186,22 @@ void InstanceRenderer::render(SkeletalInstance& instance, const DrawParameters&
 
     instance.getBoneBuffer()->bindBase(drawp.ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, "bone_buffer"));
 
+    const auto* skinned = instance.findSkinnedVertices();
+
     for (const auto& [_, mesh]: instance.getMeshes()) {
         // skip mesh if blending is different
         if (mesh.getMaterial()->getBlending() != drawp.blending) {
             return;
         }
 
+        // vertices already skinned by SkinningPass this frame, otherwise vertex shader skins them itself
+        const auto output = skinned && skinned->isCurrent() ? skinned->findOutput(*mesh.getMesh()) : nullptr;
+        if (output) {
+            output->bindBase(drawp.ctx.getIndexedBuffers().getBindingPoint(IndexedBuffer::Type::ShaderStorage, "skinned_vertex_buffer"));
+        }
+        drawp.assets.shaders.get(drawp.type, instance.getInstanceType(), mesh.getMaterial()->getShaderIndex())
+            .setUniform("_compute_skinned", static_cast<uint32_t>(output != nullptr));
+
         // set render state: shaders, material, blending, etc
         setRenderState(instance, mesh, drawp);
 
@@ -151,7 +246,7 @@ void InstanceRenderer::render(Instance& instance, const DrawParameters& drawp) {
         case InstanceType::Model: render(static_cast<ModelInstance&>(instance), drawp); break; //NOLINT
         case InstanceType::Skeletal: render(static_cast<SkeletalInstance&>(instance), drawp); break;//NOLINT
         case InstanceType::Instanced: render(static_cast<InstancedInstance&>(instance), drawp); break;//NOLINT
-        case InstanceType::SkeletalInstanced: break; //NOLINT
+        case InstanceType::SkeletalInstanced: render(static_cast<SkeletalInstancedInstance&>(instance), drawp); break;//NOLINT
         case InstanceType::Effect: break; //NOLINT
         case InstanceType::Decal: render(static_cast<DecalInstance&>(instance), drawp); break; //NOLINT
         case InstanceType::Terrain: render(static_cast<TerrainInstance&>(instance), drawp); break; //NOLINT
@@ -168,7 +263,11 @@ void InstanceRenderer::renderVisibleInstancedInstance(InstancedInstance& instanc
     // set instanced subset (visible for current frame path)
     instance.setVisible(frustum_culling.getVisibleModelInstanced(instance));
 
-    render(instance, drawp);
+    if (instance.getInstanceType() == InstanceType::SkeletalInstanced) {
+        render(static_cast<SkeletalInstancedInstance&>(instance), drawp); //NOLINT
+    } else {
+        render(instance, drawp);
+    }
 }
 
 void InstanceRenderer::renderVisibleTerrain(TerrainInstance &instance, const DrawParameters &drawp) {
@@ -176,15 +275,19 @@ void InstanceRenderer::renderVisibleTerrain(TerrainInstance &instance, const Dra
         return;
     }
 
-    renderVisibleInstancedInstance(*instance.mesh.tiles, drawp);
-    renderVisibleInstancedInstance(*instance.mesh.fillers, drawp);
-    renderVisibleInstancedInstance(*instance.mesh.trims, drawp);
-    renderVisibleInstancedInstance(*instance.mesh.seams, drawp);
+    // terrain parts follow static state of terrain itself
+    auto parts_drawp = drawp;
+    parts_drawp.filter = GeometryFilter::All;
+
+    renderVisibleInstancedInstance(*instance.mesh.tiles, parts_drawp);
+    renderVisibleInstancedInstance(*instance.mesh.fillers, parts_drawp);
+    renderVisibleInstancedInstance(*instance.mesh.trims, parts_drawp);
+    renderVisibleInstancedInstance(*instance.mesh.seams, parts_drawp);
 
 //    std::cout << "total :" << instance.mesh.trims->getInstances().size() << " visible " << frustum_culling.getVisibleModelInstanced(*instance.mesh.trims).size() << std::endl;
 
     if (auto instances = frustum_culling.getVisibleModelInstanced(instance.getId()); !instances.empty()) {
-        render(*instances[0], drawp);
+        render(*instances[0], parts_drawp);
     }
 }
 
@@ -210,6 +313,17 @@ void InstanceRenderer::render(InstancedInstance &instance, const DrawParameters
     }
 }
 
+void InstanceRenderer::render(SkeletalInstancedInstance& instance, const DrawParameters& drawp) {
+    if (!shouldBeRendered(instance, drawp)) {
+        return;
+    }
+
+    // bind baked palettes and per-instance animation data
+    instance.bind(drawp.ctx);
+
+    render(static_cast<InstancedInstance&>(instance), drawp);
+}
+
 void InstanceRenderer::render(TerrainInstance &instance, const DrawParameters &drawp) {
     if (!shouldBeRendered(instance, drawp)) {
         return;
@@ -263,7 +377,7 @@ void InstanceRenderer::renderVisible(Instance &instance, const DrawParameters &d
         case InstanceType::Model: render(static_cast<ModelInstance&>(instance), drawp); break; //NOLINT
         case InstanceType::Skeletal: render(static_cast<SkeletalInstance&>(instance), drawp); break; //NOLINT
         case InstanceType::Instanced: renderVisibleInstancedInstance(static_cast<InstancedInstance&>(instance), drawp); break; //NOLINT
-        case InstanceType::SkeletalInstanced: break; //NOLINT
+        case InstanceType::SkeletalInstanced: renderVisibleInstancedInstance(static_cast<InstancedInstance&>(instance), drawp); break; //NOLINT
         case InstanceType::Effect: break; //NOLINT
         case InstanceType::Decal: break; //NOLINT
         case InstanceType::Terrain: renderVisibleTerrain(static_cast<TerrainInstance&>(instance), drawp); break; //NOLINT
@@ -271,7 +385,7 @@ void InstanceRenderer::renderVisible(Instance &instance, const DrawParameters &d
     }
 }
 
-void InstanceRenderer::update(Scene& scene, Camera& camera) {
+void InstanceRenderer::update(Scene& scene, Camera& camera, glm::uvec2 resolution, const RendererSettings& settings) {
     frustum_culling.update(scene, camera);
-    effect_renderer.update(frustum_culling.getVisibleInstances());
+    effect_renderer.update(frustum_culling.getVisibleInstances(), camera, resolution, settings.gpu_beams);
 }
@@ -0,0 +1,30 @@
+#include <limitless/renderer/local_shadow_pass.hpp>
+
+#include <limitless/scene.hpp>
+#include <limitless/core/uniform/uniform_setter.hpp>
+#include <limitless/renderer/instance_renderer.hpp>
+#include <limitless/renderer/renderer.hpp>
+
+using namespace Limitless;
+
+LocalShadowPass::LocalShadowPass(Renderer& renderer)
+    : RendererPass {renderer}
+    , shadows {renderer.getSettings()} {
+}
+
+void LocalShadowPass::update(const RendererSettings& settings) {
+    shadows.update(settings);
+}
+
+void LocalShadowPass::render(InstanceRenderer &renderer, Scene &scene,
+                             Context &ctx, const Assets &assets,
+                             const Camera &camera, [[maybe_unused]] UniformSetter &setter) {
+    shadows.draw(renderer, scene, ctx, assets, camera);
+    shadows.mapData();
+}
+
+void LocalShadowPass::addUniformSetter(UniformSetter& setter) {
+    setter.add([&] (ShaderProgram& shader) {
+        shadows.setUniform(shader);
+    });
+}
@@ -0,0 +1,61 @@
+#include <limitless/renderer/particle_simulation_pass.hpp>
+
+#include <limitless/instances/effect_instance.hpp>
+#include <limitless/fx/emitters/sprite_emitter.hpp>
+#include <limitless/fx/sprite_gpu_simulation.hpp>
+#include <limitless/core/shader/shader_program.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/assets.hpp>
+
+using namespace Limitless;
+
+ParticleSimulationPass::ParticleSimulationPass(Renderer& renderer)
+    : RendererPass {renderer}
+    , dispatcher {std::make_shared<char>()} {
+}
+
+void ParticleSimulationPass::simulate(Instance& instance, Context& ctx, const Assets& assets) {
+    if (instance.getInstanceType() == InstanceType::Effect) {
+        auto& effect = static_cast<EffectInstance&>(instance); //NOLINT
+
+        for (auto& [_, emitter] : effect.getEmitters()) {
+            // culled emitters accumulate simulation time until they are in view again
+            if (emitter->getType() != fx::AbstractEmitter::Type::Sprite || emitter->isCulled()) {
+                continue;
+            }
+
+            auto& sprite = static_cast<fx::SpriteEmitter&>(*emitter); //NOLINT
+            const auto& shaders = assets.shaders.getCommonShaders();
+            const auto shader = sprite.isGpuSimulationSupported()
+                    ? shaders.find(fx::SpriteGpuSimulation::getShaderName(sprite))
+                    : shaders.end();
+
+            // emitters without compiled simulation stay on CPU
+            if (shader == shaders.end()) {
+                if (sprite.getGpuSimulation()) {
+                    sprite.disableGpuSimulation();
+                }
+                continue;
+            }
+
+            if (!sprite.getGpuSimulation() || sprite.isGpuSimulationOrphaned()) {
+                sprite.enableGpuSimulation(dispatcher);
+            }
+
+            sprite.simulateOnGpu(ctx, *shader->second);
+        }
+    }
+
+    for (const auto& [_, attachment] : instance.getAttachments()) {
+        simulate(*attachment, ctx, assets);
+    }
+}
+
+void ParticleSimulationPass::render([[maybe_unused]] InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, [[maybe_unused]] const Camera& camera, [[maybe_unused]] UniformSetter& setter) {
+    for (const auto& instance : scene.getInstances()) {
+        simulate(*instance, ctx, assets);
+    }
+
+    // outputs are read as vertex attributes and draw commands by sprite renderer
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+}
@@ -22,6 +22,14 @@ std::string RenderSettingsShaderDefiner::getDefine(const RendererSettings &setti
         }
     }
 
+    if (settings.local_shadow_maps) {
+        s.append("#define ENGINE_SETTINGS_LOCAL_SHADOWS\n");
+
+        if (settings.csm_pcf) {
+            s.append("#define ENGINE_SETTINGS_LOCAL_SHADOWS_PCF\n");
+        }
+    }
+
     if (settings.screen_space_ambient_occlusion) {
         s.append("#define ENGINE_SETTINGS_SSAO\n");
     }
@@ -68,5 +76,13 @@ std::string RenderSettingsShaderDefiner::getDefine(const RendererSettings &setti
         s.append("#define ENGINE_SETTINGS_SPECULAR_AA_VARIANCE " + std::to_string(settings.specular_aa_variance) + '\n');
     }
 
+    if (settings.compute_skinning) {
+        s.append("#define ENGINE_SETTINGS_COMPUTE_SKINNING\n");
+    }
+
+    if (settings.gpu_beams) {
+        s.append("#define ENGINE_SETTINGS_GPU_BEAMS\n");
+    }
+
     return s;
 }
@@ -8,7 +8,10 @@
 
 #include <limitless/core/profiler.hpp>
 #include <limitless/renderer/sceneupdate_pass.hpp>
+#include <limitless/renderer/skinning_pass.hpp>
+#include <limitless/renderer/particle_simulation_pass.hpp>
 #include <limitless/renderer/shadow_pass.hpp>
+#include <limitless/renderer/local_shadow_pass.hpp>
 #include <limitless/renderer/depth_pass.hpp>
 #include <limitless/renderer/gbuffer_pass.hpp>
 #include <limitless/renderer/decal_pass.hpp>
@@ -29,7 +32,7 @@
 using namespace Limitless;
 
 void Renderer::render(Context& context, const Assets& assets, Scene& scene, Camera& camera) {
-    instance_renderer.update(scene, camera);
+    instance_renderer.update(scene, camera, resolution, settings);
 
     for (const auto& pass: passes) {
         pass->update(scene, camera);
@@ -67,11 +70,26 @@ Renderer::Builder& Renderer::Builder::addSceneUpdatePass() {
     return *this;
 }
 
+Renderer::Builder &Renderer::Builder::addSkinningPass() {
+    renderer->passes.emplace_back(std::make_unique<SkinningPass>(*renderer));
+    return *this;
+}
+
+Renderer::Builder &Renderer::Builder::addParticleSimulationPass() {
+    renderer->passes.emplace_back(std::make_unique<ParticleSimulationPass>(*renderer));
+    return *this;
+}
+
 Renderer::Builder &Renderer::Builder::addDirectionalShadowPass() {
     renderer->passes.emplace_back(std::make_unique<DirectionalShadowPass>(*renderer));
     return *this;
 }
 
+Renderer::Builder &Renderer::Builder::addLocalShadowPass() {
+    renderer->passes.emplace_back(std::make_unique<LocalShadowPass>(*renderer));
+    return *this;
+}
+
 Renderer::Builder &Renderer::Builder::addDeferredFramebufferPass() {
     renderer->passes.emplace_back(std::make_unique<DeferredFramebufferPass>(*renderer));
     return *this;
@@ -159,9 +177,18 @@ Renderer::Builder &Renderer::Builder::addRenderDebugPass() {
 
 Renderer::Builder &Renderer::Builder::deferred() {
     addSceneUpdatePass();
+    if (renderer->settings.compute_skinning) {
+        addSkinningPass();
+    }
+    if (renderer->settings.gpu_particles) {
+        addParticleSimulationPass();
+    }
     if (renderer->settings.cascade_shadow_maps) {
         addDirectionalShadowPass();
     }
+    if (renderer->settings.local_shadow_maps) {
+        addLocalShadowPass();
+    }
     addDeferredFramebufferPass();
     addDepthPass();
     addColorPicker();
@@ -216,14 +243,39 @@ Renderer::Builder::Builder()
 Renderer::Builder & Renderer::Builder::update() {
     auto& settings = renderer->settings;
 
+    // optional passes before drawing follow each other in order of deferred()
+    if (settings.compute_skinning) {
+        if (!renderer->isPresent<SkinningPass>()) {
+            addAfter<SceneUpdatePass, SkinningPass>();
+        }
+    } else {
+        remove<SkinningPass>();
+    }
+
+    if (settings.gpu_particles) {
+        if (!renderer->isPresent<ParticleSimulationPass>()) {
+            addAfterLast<ParticleSimulationPass, SceneUpdatePass, SkinningPass>();
+        }
+    } else {
+        remove<ParticleSimulationPass>();
+    }
+
     if (settings.cascade_shadow_maps) {
         if (!renderer->isPresent<DirectionalShadowPass>()) {
-            addAfter<SceneUpdatePass, DirectionalShadowPass>();
+            addAfterLast<DirectionalShadowPass, SceneUpdatePass, SkinningPass, ParticleSimulationPass>();
         }
     } else {
         remove<DirectionalShadowPass>();
     }
 
+    if (settings.local_shadow_maps) {
+        if (!renderer->isPresent<LocalShadowPass>()) {
+            addAfterLast<LocalShadowPass, SceneUpdatePass, SkinningPass, ParticleSimulationPass, DirectionalShadowPass>();
+        }
+    } else {
+        remove<LocalShadowPass>();
+    }
+
 //    if (settings.screen_space_ambient_occlusion) {
 //        if (!renderer->isPresent<SSAOPass>()) {
 //            addAfter<SkyboxPass>(std::make_unique<SSAOPass>(*renderer));
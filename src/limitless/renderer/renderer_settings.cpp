@@ -80,6 +80,15 @@ RendererSettings RendererSettings::Builder::build() {
     settings.csm_split_count = csm_split_count;
     settings.csm_pcf = csm_pcf;
     settings.csm_micro_shadowing = csm_micro_shadowing;
+    settings.csm_static_cache = csm_static_cache;
+    settings.csm_static_cache_margin = csm_cache_margin;
+
+    settings.local_shadow_maps = local_shadow_maps;
+    settings.local_shadows_atlas_resolution = local_atlas_resolution;
+    settings.local_shadows_min_resolution = local_min_resolution;
+    settings.local_shadows_max_resolution = local_max_resolution;
+    settings.local_shadows_texel_budget = local_texel_budget;
+    settings.local_shadows_update_budget = local_update_budget;
 
     settings.bloom = bloom;
     settings.bloom_extract_threshold = bloom_ex_threshold;
@@ -90,6 +99,10 @@ RendererSettings RendererSettings::Builder::build() {
     settings.specular_aa_threshold = specular_threshold;
     settings.specular_aa_variance = specular_variance;
 
+    settings.compute_skinning = compute_skinning;
+    settings.gpu_particles = gpu_particles;
+    settings.gpu_beams = gpu_beams;
+
     settings.light_radius = light_radius;
     settings.coordinate_system_axes = coordinate_system_axes;
     settings.bounding_box = bounding_box;
@@ -147,6 +160,52 @@ RendererSettings::Builder &RendererSettings::Builder::csm_disable_micro_shadowin
     return *this;
 }
 
+RendererSettings::Builder &RendererSettings::Builder::csm_enable_static_cache() {
+    csm_static_cache = true;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::csm_disable_static_cache() {
+    csm_static_cache = false;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::csm_static_cache_margin(float margin) {
+    csm_cache_margin = margin;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::enable_local_shadows() {
+    local_shadow_maps = true;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::disable_local_shadows() {
+    local_shadow_maps = false;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::local_shadows_atlas_resolution(uint32_t resolution) {
+    local_atlas_resolution = resolution;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::local_shadows_resolution(uint32_t min, uint32_t max) {
+    local_min_resolution = min;
+    local_max_resolution = max;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::local_shadows_texel_budget(uint64_t texels) {
+    local_texel_budget = texels;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::local_shadows_update_budget(uint32_t views) {
+    local_update_budget = views;
+    return *this;
+}
+
 RendererSettings::Builder &RendererSettings::Builder::enable_bloom() {
     bloom = true;
     return *this;
@@ -192,6 +251,36 @@ RendererSettings::Builder &RendererSettings::Builder::specular_aa_variance(float
     return *this;
 }
 
+RendererSettings::Builder &RendererSettings::Builder::enable_compute_skinning() {
+    compute_skinning = true;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::disable_compute_skinning() {
+    compute_skinning = false;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::enable_gpu_particles() {
+    gpu_particles = true;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::disable_gpu_particles() {
+    gpu_particles = false;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::enable_gpu_beams() {
+    gpu_beams = true;
+    return *this;
+}
+
+RendererSettings::Builder &RendererSettings::Builder::disable_gpu_beams() {
+    gpu_beams = false;
+    return *this;
+}
+
 RendererSettings::Builder &RendererSettings::Builder::debug_light_radius() {
     light_radius = true;
     return *this;
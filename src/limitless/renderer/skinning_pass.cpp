@@ -0,0 +1,86 @@
+#include <limitless/renderer/skinning_pass.hpp>
+
+#include <limitless/instances/skeletal_instance.hpp>
+#include <limitless/core/skeletal_stream.hpp>
+#include <limitless/core/shader/shader_program.hpp>
+#include <limitless/core/buffer/buffer.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/util/frustum.hpp>
+#include <limitless/models/mesh.hpp>
+#include <limitless/assets.hpp>
+
+using namespace Limitless;
+
+SkinningPass::SkinningPass(Renderer& renderer)
+    : RendererPass {renderer} {
+}
+
+void SkinningPass::skin(SkeletalInstance& instance, Context& ctx, ShaderProgram& shader) {
+    auto& output = instance.getSkinnedVertices();
+    auto& buffers = ctx.getIndexedBuffers();
+
+    // CPU copy of the previous frame is taken before outputs are overwritten
+    output.fetch();
+    output.setCurrent(true);
+
+    instance.getBoneBuffer()->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "bone_buffer"));
+
+    for (const auto& [_, mesh] : instance.getMeshes()) {
+        const auto& stream = dynamic_cast<const SkinnedVertexStream<VertexNormalTangent>&>(static_cast<const Mesh&>(*mesh.getMesh()).getVertexStream()); //NOLINT
+        const auto vertex_count = static_cast<uint32_t>(stream.getVertices().size());
+
+        if (vertex_count == 0) {
+            continue;
+        }
+
+        // source streams are bound as storage buffers, their data is not duplicated
+        stream.getVertexBuffer()->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "skinning_vertex_buffer"));
+        stream.getBoneBuffer()->bindBaseAs(Buffer::Type::ShaderStorage, buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "skinning_weight_buffer"));
+        output.getOutput(*mesh.getMesh(), vertex_count)->bindBase(buffers.getBindingPoint(IndexedBuffer::Type::ShaderStorage, "skinned_vertex_buffer"));
+
+        shader.setUniform("_vertex_count", vertex_count);
+        shader.use();
+
+        glDispatchCompute((vertex_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+    }
+
+    instance.getBoneBuffer()->fence();
+}
+
+void SkinningPass::render([[maybe_unused]] InstanceRenderer& renderer, Scene& scene, Context& ctx, const Assets& assets, const Camera& camera, [[maybe_unused]] UniformSetter& setter) {
+    auto& shader = assets.shaders.get("skinning");
+    const auto frustum = Frustum::fromCamera(camera);
+
+    std::vector<SkeletalInstance*> skinned;
+    for (const auto& instance : scene.getInstances()) {
+        if (instance->getInstanceType() != InstanceType::Skeletal || instance->isHidden()) {
+            continue;
+        }
+
+        auto& skeletal = static_cast<SkeletalInstance&>(*instance); //NOLINT
+
+        // culled instances are skinned in vertex shader by passes that still draw them (e.g. shadows),
+        // unless mesh emitters read their vertices back
+        const auto* output = skeletal.findSkinnedVertices();
+        if (frustum.intersects(skeletal) || (output && output->isReadbackEnabled())) {
+            skinned.push_back(&skeletal);
+        } else if (output) {
+            skeletal.getSkinnedVertices().setCurrent(false);
+        }
+    }
+
+    if (skinned.empty()) {
+        return;
+    }
+
+    for (auto* instance : skinned) {
+        skin(*instance, ctx, shader);
+    }
+
+    // outputs are read as storage buffers by vertex shaders and copied to CPU for readback
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    for (auto* instance : skinned) {
+        instance->getSkinnedVertices().fence();
+    }
+}
@@ -114,17 +114,61 @@ void Scene::update(const Camera& camera) {
 
     removeDeadInstances();
 
+    animation_lod.beginFrame(camera);
+
     for (auto& [_, instance] : instances) {
-        if (instance->getInstanceType() != InstanceType::Effect) {
+        if (instance->getInstanceType() == InstanceType::Skeletal) {
+            static_cast<SkeletalInstance&>(*instance).update(camera, animation_lod); //NOLINT
+        } else if (instance->getInstanceType() != InstanceType::Effect) {
             instance->update(camera);
         }
     }
 
+    updateEffects(camera);
+}
+
+void Scene::updateEffects(const Camera& camera) {
+    effect_culling.beginFrame(camera);
+    particle_lod.beginFrame(camera);
+
+    updated_effects.clear();
+    updated_emitters.clear();
+
+    // instances are updated on this thread, they update GPU buffers
     for (auto& [_, instance] : instances) {
         if (instance->getInstanceType() == InstanceType::Effect) {
-            instance->update(camera);
+            auto& effect = static_cast<EffectInstance&>(*instance); //NOLINT
+            effect.prepareUpdate(camera);
+
+            updated_effects.emplace_back(&effect);
+            for (auto& [name, emitter] : effect.getEmitters()) {
+                if (effect_culling.select(*emitter)) {
+                    particle_lod.select(*emitter);
+                    updated_emitters.emplace_back(emitter.get());
+                }
+            }
         }
     }
+
+    particle_lod.applyBudget();
+
+    if (effect_pool) {
+        effect_pool->parallelFor(updated_emitters.size(), [&] (size_t i) {
+            updated_emitters[i]->update(camera, *effect_pool);
+        });
+    } else {
+        for (auto* emitter : updated_emitters) {
+            emitter->update(camera);
+        }
+    }
+
+    for (auto* effect : updated_effects) {
+        effect->finishUpdate();
+    }
+}
+
+void Scene::setEffectUpdateThreads(uint32_t count) {
+    effect_pool = count != 0 ? std::make_unique<ThreadPool>(count) : nullptr;
 }
 
 Instances Scene::getInstances() const noexcept {
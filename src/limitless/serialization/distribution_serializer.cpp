@@ -31,7 +31,7 @@ ByteBuffer DistributionSerializer::serialize(const Distribution<T>& distr) {
 }
 
 template<typename T>
-std::unique_ptr<Distribution<T>> DistributionSerializer::deserialize(ByteBuffer& buffer) {
+std::unique_ptr<Distribution<T>> DistributionSerializer::deserialize(ByteReader& buffer) {
     uint8_t version {};
 
     buffer >> version;
@@ -74,7 +74,7 @@ ByteBuffer& Limitless::operator<<(ByteBuffer& buffer, const Distribution<T>& dis
 }
 
 template<typename T>
-ByteBuffer& Limitless::operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<T>>& distr) {
+ByteReader& Limitless::operator>>(ByteReader& buffer, std::unique_ptr<Distribution<T>>& distr) {
     DistributionSerializer serializer;
     distr = serializer.deserialize<T>(buffer);
     return buffer;
@@ -86,8 +86,8 @@ namespace Limitless {
     template ByteBuffer& operator<<(ByteBuffer& buffer, const Distribution<glm::vec3>& distr);
     template ByteBuffer& operator<<(ByteBuffer& buffer, const Distribution<glm::vec4>& distr);
 
-    template ByteBuffer& operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<float>>& distr);
-    template ByteBuffer& operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<uint32_t>>& distr);
-    template ByteBuffer& operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<glm::vec3>>& distr);
-    template ByteBuffer& operator>>(ByteBuffer& buffer, std::unique_ptr<Distribution<glm::vec4>>& distr);
+    template ByteReader& operator>>(ByteReader& buffer, std::unique_ptr<Distribution<float>>& distr);
+    template ByteReader& operator>>(ByteReader& buffer, std::unique_ptr<Distribution<uint32_t>>& distr);
+    template ByteReader& operator>>(ByteReader& buffer, std::unique_ptr<Distribution<glm::vec3>>& distr);
+    template ByteReader& operator>>(ByteReader& buffer, std::unique_ptr<Distribution<glm::vec4>>& distr);
 }
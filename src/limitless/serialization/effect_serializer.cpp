@@ -17,7 +17,7 @@ ByteBuffer EffectSerializer::serialize(const EffectInstance& instance) {
     return buffer;
 }
 
-std::shared_ptr<EffectInstance> EffectSerializer::deserialize(Assets& assets, ByteBuffer& buffer) {
+std::shared_ptr<EffectInstance> EffectSerializer::deserialize(Assets& assets, ByteReader& buffer) {
     uint8_t version {};
 
     buffer >> version;
@@ -48,7 +48,7 @@ ByteBuffer& Limitless::operator<<(ByteBuffer& buffer, const EffectInstance& effe
     return buffer;
 }
 
-ByteBuffer& Limitless::operator>>(ByteBuffer& buffer, const AssetDeserializer<std::shared_ptr<EffectInstance>>& asset) {
+ByteReader& Limitless::operator>>(ByteReader& buffer, const AssetDeserializer<std::shared_ptr<EffectInstance>>& asset) {
     EffectSerializer serializer;
     auto& [assets, effect] = asset;
     effect = serializer.deserialize(assets, buffer);
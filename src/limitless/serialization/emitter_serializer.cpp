@@ -27,6 +27,23 @@ ByteBuffer EmitterSerializer::serialize(const AbstractEmitter& emitter) {
            << emitter.getSpawn()
            << emitter.getDuration().count();
 
+    const auto& fixed_bounds = emitter.getFixedBounds();
+    buffer << fixed_bounds.has_value();
+    if (fixed_bounds) {
+        buffer << fixed_bounds->center
+               << fixed_bounds->size;
+    }
+
+    const auto& lod = emitter.getLod();
+    buffer << lod.has_value();
+    if (lod) {
+        for (const auto& level : lod->levels) {
+            buffer << level.spawn_rate
+                   << level.max_count
+                   << level.dropped_modules;
+        }
+    }
+
     switch (emitter.getType()) {
         case AbstractEmitter::Type::Sprite: {
             const auto& sprite_emitter = static_cast<const SpriteEmitter&>(emitter);
@@ -52,7 +69,7 @@ ByteBuffer EmitterSerializer::serialize(const AbstractEmitter& emitter) {
     return buffer;
 }
 
-void EmitterSerializer::deserialize(Assets& assets, ByteBuffer& buffer, EffectBuilder& builder) {
+void EmitterSerializer::deserialize(Assets& assets, ByteReader& buffer, EffectBuilder& builder) {
     std::string name;
     AbstractEmitter::Type type;
     glm::vec3 local_position;
@@ -60,6 +77,10 @@ void EmitterSerializer::deserialize(Assets& assets, ByteBuffer& buffer, EffectBu
     bool local_space;
     EmitterSpawn spawn;
     float duration;
+    bool has_fixed_bounds {};
+    std::optional<Box> fixed_bounds;
+    bool has_lod {};
+    std::optional<EmitterLod> lod;
     std::shared_ptr<ms::Material> material;
 
     buffer >> name;
@@ -68,7 +89,8 @@ void EmitterSerializer::deserialize(Assets& assets, ByteBuffer& buffer, EffectBu
 
     buffer >> version;
 
-    if (version != VERSION) {
+    // files of older versions are read without fields that were added later
+    if (version == 0 || version > VERSION) {
         throw std::runtime_error("Wrong emitter serializer version! " + std::to_string(VERSION) + " vs " + std::to_string(version));
     }
 
@@ -77,8 +99,32 @@ void EmitterSerializer::deserialize(Assets& assets, ByteBuffer& buffer, EffectBu
            >> local_rotation
            >> local_space
            >> spawn
-           >> duration
-           >> AssetDeserializer<std::shared_ptr<ms::Material>>{assets, material};
+           >> duration;
+
+    if (version >= FIXED_BOUNDS_VERSION) {
+        buffer >> has_fixed_bounds;
+
+        if (has_fixed_bounds) {
+            fixed_bounds = Box {};
+            buffer >> fixed_bounds->center
+                   >> fixed_bounds->size;
+        }
+    }
+
+    if (version >= LOD_VERSION) {
+        buffer >> has_lod;
+
+        if (has_lod) {
+            lod = EmitterLod {};
+            for (auto& level : lod->levels) {
+                buffer >> level.spawn_rate
+                       >> level.max_count
+                       >> level.dropped_modules;
+            }
+        }
+    }
+
+    buffer >> AssetDeserializer<std::shared_ptr<ms::Material>>{assets, material};
 
     switch (type) {
         case AbstractEmitter::Type::Sprite: {
@@ -117,6 +163,8 @@ void EmitterSerializer::deserialize(Assets& assets, ByteBuffer& buffer, EffectBu
             .setLocalSpace(local_space)
             .setSpawn(std::move(spawn))
             .setDuration(std::chrono::duration<float>{duration})
+            .setFixedBounds(fixed_bounds)
+            .setLod(lod)
             .setMaterial(material);
 }
 
@@ -134,7 +182,7 @@ ByteBuffer& Limitless::operator<<(ByteBuffer& buffer, const EmitterSpawn& spawn)
     return buffer;
 }
 
-ByteBuffer& Limitless::operator>>(ByteBuffer& buffer, EmitterSpawn& spawn) {
+ByteReader& Limitless::operator>>(ByteReader& buffer, EmitterSpawn& spawn) {
     buffer >> spawn.mode
            >> spawn.max_count
            >> spawn.spawn_rate;
@@ -11,7 +11,7 @@
 using namespace Limitless::ms;
 using namespace Limitless;
 
-void MaterialSerializer::deserialize(ByteBuffer& buffer, Assets& assets, Material::Builder& builder) {
+void MaterialSerializer::deserialize(ByteReader& buffer, Assets& assets, Material::Builder& builder) {
     std::map<Property, std::unique_ptr<Uniform>> properties;
     std::map<std::string, std::unique_ptr<Uniform>> uniforms;
     Blending blending{};
@@ -160,7 +160,7 @@ ByteBuffer MaterialSerializer::serialize(const Material& material) {
     return buffer;
 }
 
-std::shared_ptr<Material> MaterialSerializer::deserialize(Assets& assets, ByteBuffer& buffer) {
+std::shared_ptr<Material> MaterialSerializer::deserialize(Assets& assets, ByteReader& buffer) {
     uint8_t version {};
 
     buffer >> version;
@@ -191,7 +191,7 @@ ByteBuffer& Limitless::operator<<(ByteBuffer& buffer, const Material& material)
     return buffer;
 }
 
-ByteBuffer& Limitless::operator>>(ByteBuffer& buffer, const AssetDeserializer<std::shared_ptr<Material>>& asset) {
+ByteReader& Limitless::operator>>(ByteReader& buffer, const AssetDeserializer<std::shared_ptr<Material>>& asset) {
     MaterialSerializer serializer;
     auto& [assets, material] = asset;
     material = serializer.deserialize(assets, buffer);
@@ -17,7 +17,7 @@ void UniformSerializer::serializeUniform(const Uniform& uniform, ByteBuffer& buf
            << uniform.value_type;
 }
 
-Uniform* UniformSerializer::deserializeUniformValue(ByteBuffer& buffer, std::string&& name, UniformValueType value_type) {
+Uniform* UniformSerializer::deserializeUniformValue(ByteReader& buffer, std::string&& name, UniformValueType value_type) {
     Uniform* uniform {};
     switch (value_type) {
         case UniformValueType::Float:
@@ -48,7 +48,7 @@ Uniform* UniformSerializer::deserializeUniformValue(ByteBuffer& buffer, std::str
     return uniform;
 }
 
-Uniform* UniformSerializer::deserializeUniformSampler(ByteBuffer& buffer, Assets& assets, std::string&& name) {
+Uniform* UniformSerializer::deserializeUniformSampler(ByteReader& buffer, Assets& assets, std::string&& name) {
     std::string p;
     buffer >> p;
 
@@ -64,7 +64,7 @@ Uniform* UniformSerializer::deserializeUniformSampler(ByteBuffer& buffer, Assets
     return new UniformSampler(name, std::move(texture));
 }
 
-Uniform* UniformSerializer::deserializeUniformTime(ByteBuffer& buffer, std::string&& name) {
+Uniform* UniformSerializer::deserializeUniformTime(ByteReader& buffer, std::string&& name) {
     float value{};
     buffer >> value;
 
@@ -114,7 +114,7 @@ void UniformSerializer::serializeUniformValue(const Uniform& uniform, ByteBuffer
 }
 
 template<typename T>
-Uniform* UniformSerializer::deserializeUniformValue(ByteBuffer& buffer, std::string&& name) {
+Uniform* UniformSerializer::deserializeUniformValue(ByteReader& buffer, std::string&& name) {
     T value{};
     buffer >> value;
     return new UniformValue<T>(std::move(name), std::move(value));
@@ -137,7 +137,7 @@ ByteBuffer UniformSerializer::serialize(const Uniform& uniform) {
     return buffer;
 }
 
-std::unique_ptr<Uniform> UniformSerializer::deserialize(ByteBuffer& buffer, Assets& assets) {
+std::unique_ptr<Uniform> UniformSerializer::deserialize(ByteReader& buffer, Assets& assets) {
     uint8_t version {};
 
     buffer >> version;
@@ -176,7 +176,7 @@ ByteBuffer& Limitless::operator<<(ByteBuffer& buffer, const Uniform& uniform) {
     return buffer;
 }
 
-ByteBuffer& Limitless::operator>>(ByteBuffer& buffer, const AssetDeserializer<std::unique_ptr<Uniform>>& asset) {
+ByteReader& Limitless::operator>>(ByteReader& buffer, const AssetDeserializer<std::unique_ptr<Uniform>>& asset) {
     UniformSerializer serializer;
     auto& [assets, uniform] = asset;
     uniform = serializer.deserialize(buffer, assets);
@@ -137,6 +137,10 @@ void ShaderStorage::initialize(Context& ctx, const RendererSettings& settings, c
 //	    add("dof", compiler.compile(shader_dir / "postprocessing/dof"));
 //    }
 
+    if (settings.compute_skinning) {
+        add("skinning", compiler.compile(shader_dir / "pipeline/skinning"));
+    }
+
     add("quad", compiler.compile(shader_dir / "pipeline/quad"));
 
     add("text", compiler.compile(shader_dir / "text/text"));
@@ -0,0 +1,115 @@
+#include <limitless/util/mapped_file.hpp>
+
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <fstream>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace Limitless;
+
+namespace {
+    [[noreturn]] void throwOpenError(const fs::path& path) {
+        throw std::runtime_error("Failed to open " + path.string());
+    }
+
+#ifndef _WIN32
+    class FileDescriptor final {
+    private:
+        int fd;
+    public:
+        explicit FileDescriptor(const fs::path& path)
+            : fd {::open(path.c_str(), O_RDONLY | O_CLOEXEC)} {
+            if (fd == -1) {
+                throwOpenError(path);
+            }
+        }
+
+        ~FileDescriptor() {
+            ::close(fd);
+        }
+
+        FileDescriptor(const FileDescriptor&) = delete;
+        FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+        [[nodiscard]] auto get() const noexcept { return fd; }
+    };
+#endif
+}
+
+#ifdef _WIN32
+MappedFile::MappedFile(const fs::path& path) {
+    std::ifstream stream;
+    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    try {
+        stream.open(path, std::ios::binary | std::ios::ate);
+
+        length = static_cast<size_t>(stream.tellg());
+        storage.reset(new std::byte[length]);
+
+        stream.seekg(0, std::ios::beg);
+        stream.read(reinterpret_cast<char*>(storage.get()), static_cast<std::streamsize>(length));
+    } catch (const std::exception&) {
+        throwOpenError(path);
+    }
+
+    bytes = storage.get();
+}
+
+MappedFile::~MappedFile() = default;
+#else
+MappedFile::MappedFile(const fs::path& path) {
+    const FileDescriptor file {path};
+
+    struct stat info {};
+    if (::fstat(file.get(), &info) == -1) {
+        throwOpenError(path);
+    }
+
+    length = static_cast<size_t>(info.st_size);
+
+    // empty file cannot be mapped, there is nothing to read either
+    if (length == 0) {
+        return;
+    }
+
+    auto* address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file.get(), 0);
+    if (address != MAP_FAILED) {
+        // deserializers read file once from beginning to end
+        ::madvise(address, length, MADV_SEQUENTIAL);
+
+        bytes = static_cast<const std::byte*>(address);
+        mapped = true;
+        return;
+    }
+
+    // not initialized on purpose, it is overwritten right away
+    storage.reset(new std::byte[length]);
+
+    size_t offset = 0;
+    while (offset != length) {
+        const auto count = ::read(file.get(), storage.get() + offset, length - offset);
+        if (count == -1 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            throwOpenError(path);
+        }
+        offset += static_cast<size_t>(count);
+    }
+
+    bytes = storage.get();
+}
+
+MappedFile::~MappedFile() {
+    if (mapped) {
+        ::munmap(const_cast<std::byte*>(bytes), length);
+    }
+}
+#endif
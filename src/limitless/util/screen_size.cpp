@@ -0,0 +1,21 @@
+#include <limitless/util/screen_size.hpp>
+#include <limitless/camera.hpp>
+
+#include <limits>
+
+using namespace Limitless;
+
+ScreenSize::ScreenSize(const Camera& camera)
+    : camera_position {camera.getPosition()}
+    , view_scale {std::tan(glm::radians(camera.getFov()) * 0.5f)} {
+}
+
+float ScreenSize::get(const Box& box) const noexcept {
+    const auto radius = glm::length(box.size) * 0.5f;
+    const auto distance = glm::length(box.center - camera_position);
+    if (distance <= radius) {
+        return std::numeric_limits<float>::max();
+    }
+
+    return radius / (distance * view_scale);
+}
@@ -1,5 +1,8 @@
 #include <limitless/util/thread_pool.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 using namespace Limitless;
 
 ThreadPool::ThreadPool(uint32_t pool_size) {
@@ -27,6 +30,62 @@ ThreadPool::ThreadPool(uint32_t pool_size) {
     }
 }
 
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (threads.empty() || count <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    struct State {
+        std::atomic<size_t> next {};
+        std::atomic<size_t> finished {};
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+    auto state = std::make_shared<State>();
+
+    // helpers started after all indices are taken return without touching task
+    const auto run = [state, count, &task] {
+        for (size_t i = state->next++; i < count; i = state->next++) {
+            try {
+                task(i);
+            } catch (...) {
+                std::unique_lock lock(state->mutex);
+                if (!state->exception) {
+                    state->exception = std::current_exception();
+                }
+            }
+
+            if (++state->finished == count) {
+                std::unique_lock lock(state->mutex);
+                state->done.notify_all();
+            }
+        }
+    };
+
+    const auto helpers = std::min(threads.size(), count - 1);
+    {
+        std::unique_lock lock(mutex);
+        for (size_t i = 0; i < helpers; ++i) {
+            tasks.emplace(run);
+        }
+    }
+    condition.notify_all();
+
+    run();
+
+    std::unique_lock lock(state->mutex);
+    state->done.wait(lock, [&] { return state->finished == count; });
+
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
 void ThreadPool::joinAll() {
     {
         std::unique_lock lock(mutex);
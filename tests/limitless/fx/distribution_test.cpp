@@ -0,0 +1,201 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/fx/modules/distribution.hpp>
+#include <limitless/util/thread_pool.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace Limitless;
+
+namespace {
+    constexpr size_t SAMPLE_COUNT = 1u << 20u;
+    constexpr size_t BUCKET_COUNT = 16;
+
+    // chi-square with 15 degrees of freedom at p = 0.001
+    constexpr double CHI_SQUARE_CRITICAL = 37.7;
+
+    double chiSquare(const std::vector<float>& values) {
+        std::vector<size_t> buckets(BUCKET_COUNT);
+        for (const auto value : values) {
+            // rounding of scaled values may reach upper bound
+            ++buckets[std::min(static_cast<size_t>(value * BUCKET_COUNT), BUCKET_COUNT - 1)];
+        }
+
+        const auto expected = static_cast<double>(values.size()) / BUCKET_COUNT;
+
+        double chi = 0.0;
+        for (const auto count : buckets) {
+            const auto d = static_cast<double>(count) - expected;
+            chi += d * d / expected;
+        }
+        return chi;
+    }
+}
+
+TEST_CASE("Xoshiro128 fills uniform floats in [0, 1)") {
+    Xoshiro128 engine {42};
+
+    // count that is not multiple of lanes
+    std::vector<float> values(SAMPLE_COUNT + 3);
+    engine.fill(values.data(), values.size());
+
+    double sum = 0.0;
+    double square_sum = 0.0;
+    for (const auto value : values) {
+        REQUIRE(value >= 0.0f);
+        REQUIRE(value < 1.0f);
+
+        sum += value;
+        square_sum += value * value;
+    }
+
+    const auto n = static_cast<double>(values.size());
+    const auto mean = sum / n;
+    const auto variance = square_sum / n - mean * mean;
+
+    CHECK(mean == Catch::Approx(0.5).margin(0.002));
+    CHECK(variance == Catch::Approx(1.0 / 12.0).margin(0.002));
+    CHECK(chiSquare(values) < CHI_SQUARE_CRITICAL);
+}
+
+TEST_CASE("Xoshiro128 lanes are independent") {
+    Xoshiro128 engine {7};
+
+    // neighbouring values of block come from different lanes
+    std::vector<float> values(SAMPLE_COUNT);
+    engine.fill(values.data(), values.size());
+
+    double correlation = 0.0;
+    for (size_t i = 0; i + 1 < values.size(); ++i) {
+        correlation += (values[i] - 0.5) * (values[i + 1] - 0.5);
+    }
+    correlation /= static_cast<double>(values.size() - 1) / 12.0;
+
+    CHECK(correlation == Catch::Approx(0.0).margin(0.01));
+}
+
+TEST_CASE("Xoshiro128 with the same seed repeats sequence") {
+    Xoshiro128 a {123};
+    Xoshiro128 b {123};
+    Xoshiro128 c {124};
+
+    bool differs = false;
+    for (size_t i = 0; i < 100; ++i) {
+        const auto value = a();
+        REQUIRE(value == b());
+        differs |= value != c();
+    }
+
+    CHECK(differs);
+}
+
+TEST_CASE("RangeDistribution sample stays in range") {
+    RandomStream::Engine engine {1};
+    const RandomStream::Scope scope {engine};
+
+    const RangeDistribution<glm::vec3> distribution {glm::vec3(-1.0f, 2.0f, 10.0f), glm::vec3(1.0f, 4.0f, 10.0f)};
+
+    std::vector<glm::vec3> values(10001);
+    distribution.sample(values.data(), values.size());
+
+    glm::vec3 sum {0.0f};
+    for (const auto& value : values) {
+        REQUIRE(value.x >= -1.0f);
+        REQUIRE(value.x <= 1.0f);
+        REQUIRE(value.y >= 2.0f);
+        REQUIRE(value.y <= 4.0f);
+        REQUIRE(value.z == 10.0f);
+
+        sum += value;
+    }
+
+    const auto mean = sum / static_cast<float>(values.size());
+    CHECK(mean.x == Catch::Approx(0.0f).margin(0.05f));
+    CHECK(mean.y == Catch::Approx(3.0f).margin(0.05f));
+}
+
+TEST_CASE("RangeDistribution sample of double stays in range") {
+    RandomStream::Engine engine {2};
+    const RandomStream::Scope scope {engine};
+
+    const RangeDistribution<double> distribution {-3.0, -2.0};
+
+    std::vector<double> values(1001);
+    distribution.sample(values.data(), values.size());
+
+    for (const auto value : values) {
+        REQUIRE(value >= -3.0);
+        REQUIRE(value <= -2.0);
+    }
+}
+
+TEST_CASE("RangeDistribution sample is uniform") {
+    RandomStream::Engine engine {5};
+    const RandomStream::Scope scope {engine};
+
+    const RangeDistribution<float> distribution {2.0f, 4.0f};
+
+    std::vector<float> values(SAMPLE_COUNT);
+    distribution.sample(values.data(), values.size());
+
+    for (auto& value : values) {
+        value = (value - 2.0f) / 2.0f;
+    }
+
+    CHECK(chiSquare(values) < CHI_SQUARE_CRITICAL);
+}
+
+TEST_CASE("RangeDistribution shared by pool threads draws from their streams") {
+    const RangeDistribution<int> distribution {0, 1000};
+
+    constexpr size_t stream_count = 8;
+    constexpr size_t value_count = 1000;
+
+    const auto draw = [&] (std::vector<int>& values, size_t stream) {
+        RandomStream::Engine engine {RandomStream::seed(42, stream)};
+        const RandomStream::Scope scope {engine};
+
+        values.resize(value_count);
+        for (auto& value : values) {
+            value = distribution.get();
+        }
+    };
+
+    std::vector<std::vector<int>> serial(stream_count);
+    for (size_t stream = 0; stream < stream_count; ++stream) {
+        draw(serial[stream], stream);
+    }
+
+    std::vector<std::vector<int>> parallel(stream_count);
+    ThreadPool pool {3};
+    pool.parallelFor(stream_count, [&] (size_t stream) { draw(parallel[stream], stream); });
+
+    REQUIRE(parallel == serial);
+}
+
+TEST_CASE("RangeDistribution draws from edited range") {
+    RandomStream::Engine engine {3};
+    const RandomStream::Scope scope {engine};
+
+    RangeDistribution<float> distribution {0.0f, 1.0f};
+    distribution.setMin(10.0f);
+    distribution.getMax() = 20.0f;
+
+    for (size_t i = 0; i < 100; ++i) {
+        const auto value = distribution.get();
+        REQUIRE(value >= 10.0f);
+        REQUIRE(value <= 20.0f);
+    }
+}
+
+TEST_CASE("ConstDistribution sample repeats value") {
+    const ConstDistribution<float> distribution {3.0f};
+
+    std::vector<float> values(17);
+    distribution.sample(values.data(), values.size());
+
+    for (const auto value : values) {
+        CHECK(value == 3.0f);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <limitless/fx/effect_builder.hpp>
+#include <limitless/fx/emitters/sprite_emitter.hpp>
+#include <limitless/instances/effect_instance.hpp>
+#include <limitless/ms/material_builder.hpp>
+#include <limitless/assets.hpp>
+
+namespace LimitlessTest {
+    using namespace Limitless;
+    using namespace Limitless::fx;
+
+    class Effects {
+    public:
+        /**
+         * Effect with single sprite emitter "sparks"
+         *
+         * spray emits one particle on first update, its color is the first number of emitter stream
+         */
+        static inline std::shared_ptr<EffectInstance> sparks(Assets& assets) {
+            auto material = ms::Material::builder()
+                    .name("sparks")
+                    .color(glm::vec4{1.0f})
+                    .model(InstanceType::Effect)
+                    .build(assets);
+
+            EffectBuilder builder {assets};
+            return builder.create("sparks")
+                    .createEmitter<SpriteEmitter>("sparks")
+                    .setSpawnMode(EmitterSpawn::Mode::Spray)
+                    .setMaxCount(100)
+                    .setSpawnRate(100.0f)
+                    .addInitialColor(std::make_unique<RangeDistribution<glm::vec4>>(glm::vec4{0.0f}, glm::vec4{1.0f}))
+                    .addLifetime(std::make_unique<ConstDistribution<float>>(10.0f))
+                    .setMaterial(material)
+                    .build();
+        }
+    };
+}
@@ -0,0 +1,64 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/fx/mesh_gpu_particle.hpp>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+
+namespace {
+    // layout mesh particles were uploaded in before, model matrix built on CPU
+    struct alignas(64) MatrixMeshParticle {
+        glm::mat4 model;
+        MeshParticle particle;
+    };
+
+    MeshParticle makeParticle(float index) {
+        MeshParticle particle;
+        particle.color = glm::vec4(0.1f * index, 0.5f, 1.0f, 2.0f);
+        particle.subUV = glm::vec4(0.25f, 0.25f, 0.5f, 0.75f);
+        particle.properties = glm::vec4(index, -1.0f, 0.0f, 3.5f);
+        particle.acceleration = glm::vec3(0.0f, -9.8f, 0.0f);
+        particle.lifetime = 1.0f + index;
+        particle.position = glm::vec3(100.0f * index, 0.5f, -index);
+        particle.rotation = glm::vec3(0.1f * index, 2.0f, -3.0f);
+        particle.time = 0.5f * index;
+        particle.velocity = glm::vec3(1.0f, index, -2.0f);
+        particle.size = glm::vec3(0.5f, 1.0f, 2.0f + index);
+        return particle;
+    }
+
+    glm::vec4 unpack(const glm::uvec4& value, bool upper) {
+        const auto x = glm::unpackHalf2x16(upper ? value.z : value.x);
+        const auto y = glm::unpackHalf2x16(upper ? value.w : value.y);
+        return { x.x, x.y, y.x, y.y };
+    }
+
+    void checkHalf(const glm::vec4& actual, const glm::vec4& expected) {
+        for (glm::length_t i = 0; i < 4; ++i) {
+            // half float keeps 11 significant bits
+            CHECK(actual[i] == Catch::Approx(expected[i]).epsilon(1.0f / 1024.0f));
+        }
+    }
+}
+
+TEST_CASE("MeshGpuParticle keeps particle attributes") {
+    for (int i = 0; i < 4; ++i) {
+        const auto particle = makeParticle(static_cast<float>(i));
+        const MeshGpuParticle packed {particle};
+
+        // position and rotation drive model matrix, so they keep full precision
+        CHECK(packed.position == glm::vec4(particle.position, particle.time));
+        CHECK(packed.rotation == glm::vec4(particle.rotation, particle.lifetime));
+
+        checkHalf(unpack(packed.color, false), particle.color);
+        checkHalf(unpack(packed.color, true), particle.subUV);
+        checkHalf(unpack(packed.properties, false), particle.properties);
+        checkHalf(unpack(packed.properties, true), glm::vec4(particle.size, 0.0f));
+        checkHalf(unpack(packed.velocity, false), glm::vec4(particle.velocity, 0.0f));
+        checkHalf(unpack(packed.velocity, true), glm::vec4(particle.acceleration, 0.0f));
+    }
+}
+
+TEST_CASE("MeshGpuParticle is less than half of matrix particle") {
+    CHECK(sizeof(MeshGpuParticle) * 2 < sizeof(MatrixMeshParticle));
+}
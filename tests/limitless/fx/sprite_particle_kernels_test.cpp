@@ -0,0 +1,173 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/fx/sprite_particle_kernels.hpp>
+#include <limitless/util/thread_pool.hpp>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+
+namespace {
+    SpriteParticle makeParticle(float index) {
+        SpriteParticle particle;
+        particle.color = glm::vec4(0.1f * index, 0.5f, 1.0f, 1.0f);
+        particle.acceleration = glm::vec3(0.0f, -9.8f, 0.0f);
+        particle.lifetime = 1.0f + index;
+        particle.position = glm::vec3(index, 0.0f, -index);
+        particle.size = 4.0f + index;
+        particle.velocity = glm::vec3(1.0f, index, 0.0f);
+        return particle;
+    }
+}
+
+TEST_CASE("SpriteParticleStorage packs particles in GPU layout") {
+    SpriteParticleStorage storage;
+    for (int i = 0; i < 3; ++i) {
+        storage.push(makeParticle(static_cast<float>(i)));
+    }
+
+    std::vector<SpriteParticle> packed;
+    storage.pack(packed);
+
+    REQUIRE(packed.size() == 3);
+    REQUIRE(packed[2].position == makeParticle(2.0f).position);
+    REQUIRE(packed[2].velocity == makeParticle(2.0f).velocity);
+    REQUIRE(packed[2].lifetime == makeParticle(2.0f).lifetime);
+    REQUIRE(storage.get(1).color == makeParticle(1.0f).color);
+}
+
+TEST_CASE("SpriteParticleStorage removes dead particles in order") {
+    SpriteParticleStorage storage;
+    for (int i = 0; i < 5; ++i) {
+        storage.push(makeParticle(static_cast<float>(i)));
+    }
+    storage.lifetime[1] = 0.0f;
+    storage.lifetime[3] = -1.0f;
+
+    std::vector<size_t> indices;
+    storage.removeDead(indices);
+
+    REQUIRE(indices == std::vector<size_t>{1, 3});
+    REQUIRE(storage.count() == 3);
+    REQUIRE(storage.position.x == std::vector<float>{0.0f, 2.0f, 4.0f});
+    REQUIRE(storage.size == std::vector<float>{4.0f, 6.0f, 8.0f});
+}
+
+TEST_CASE("updateSprites matches module update of particles") {
+    constexpr float dt = 0.016f;
+
+    ConstDistribution<glm::vec3> velocity {glm::vec3(0.0f, 2.0f, 0.0f)};
+    ConstDistribution<glm::vec4> color {glm::vec4(0.0f)};
+    ConstDistribution<float> size {1.0f};
+
+    SpriteKernelModules modules;
+    modules.velocity_by_life = &velocity;
+    modules.color_by_life = &color;
+    modules.size_by_life = &size;
+    modules.time = true;
+    modules.lifetime = true;
+
+    // more particles than one block
+    std::vector<SpriteParticle> expected;
+    SpriteParticleStorage storage;
+    for (int i = 0; i < 300; ++i) {
+        expected.emplace_back(makeParticle(static_cast<float>(i % 7)));
+        storage.push(expected.back());
+    }
+
+    for (auto& particle : expected) {
+        const auto tick = particle.lifetime / dt;
+        particle.velocity += (velocity.get() - particle.velocity) / tick;
+        particle.color += (color.get() - particle.color) / tick;
+        particle.color = glm::clamp(particle.color, glm::vec4(0.0f), glm::vec4(std::numeric_limits<float>::max()));
+        particle.size += (size.get() - particle.size) / tick;
+        particle.time += dt;
+        particle.lifetime -= dt;
+        particle.position += particle.velocity * dt;
+        particle.velocity += particle.acceleration * dt;
+    }
+
+    updateSprites(storage, modules, dt);
+
+    std::vector<SpriteParticle> packed;
+    storage.pack(packed);
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        for (glm::length_t c = 0; c < 3; ++c) {
+            REQUIRE(packed[i].position[c] == Catch::Approx(expected[i].position[c]));
+            REQUIRE(packed[i].velocity[c] == Catch::Approx(expected[i].velocity[c]));
+        }
+        REQUIRE(packed[i].color.x == Catch::Approx(expected[i].color.x));
+        REQUIRE(packed[i].size == Catch::Approx(expected[i].size));
+        REQUIRE(packed[i].time == Catch::Approx(expected[i].time));
+        REQUIRE(packed[i].lifetime == Catch::Approx(expected[i].lifetime));
+    }
+}
+
+TEST_CASE("updateSprites samples range distributions per particle") {
+    RangeDistribution<glm::vec3> rate {glm::vec3(1.0f), glm::vec3(2.0f)};
+
+    SpriteKernelModules modules;
+    modules.rotation_rate = &rate;
+
+    SpriteParticleStorage storage;
+    for (int i = 0; i < 64; ++i) {
+        storage.push(makeParticle(0.0f));
+    }
+
+    updateSprites(storage, modules, 1.0f);
+
+    for (size_t i = 0; i < storage.count(); ++i) {
+        REQUIRE(storage.rotation.x[i] >= 1.0f);
+        REQUIRE(storage.rotation.x[i] <= 2.0f);
+    }
+    REQUIRE(storage.rotation.x[0] != storage.rotation.x[1]);
+}
+
+TEST_CASE("removeParticles keeps order of remaining elements") {
+    std::vector<int> data {0, 1, 2, 3, 4, 5, 6};
+
+    removeParticles(data, {0, 3, 4, 6});
+    REQUIRE(data == std::vector<int>{1, 2, 5});
+
+    removeParticles(data, {});
+    REQUIRE(data == std::vector<int>{1, 2, 5});
+
+    // per particle data of module may be shorter than particles
+    removeParticles(data, {1, 7});
+    REQUIRE(data == std::vector<int>{1, 5});
+}
+
+TEST_CASE("updateSprites of chunks on pool threads is deterministic") {
+    RangeDistribution<glm::vec3> rate {glm::vec3(-1.0f), glm::vec3(1.0f)};
+
+    SpriteKernelModules modules;
+    modules.rotation_rate = &rate;
+
+    constexpr size_t count = 1000;
+    constexpr size_t chunk_size = 256;
+
+    SpriteParticleStorage serial;
+    for (size_t i = 0; i < count; ++i) {
+        serial.push(makeParticle(static_cast<float>(i % 5)));
+    }
+    SpriteParticleStorage parallel = serial;
+
+    const auto update = [&] (SpriteParticleStorage& storage, size_t chunk) {
+        RandomStream::Engine engine {RandomStream::seed(42, chunk)};
+        const RandomStream::Scope scope {engine};
+
+        const auto begin = chunk * chunk_size;
+        updateSprites(storage, modules, 1.0f, begin, std::min(begin + chunk_size, count));
+    };
+
+    for (size_t chunk = 0; chunk < (count + chunk_size - 1) / chunk_size; ++chunk) {
+        update(serial, chunk);
+    }
+
+    ThreadPool pool {3};
+    pool.parallelFor((count + chunk_size - 1) / chunk_size, [&] (size_t chunk) { update(parallel, chunk); });
+
+    REQUIRE(parallel.rotation.x == serial.rotation.x);
+    REQUIRE(parallel.rotation.z == serial.rotation.z);
+    REQUIRE(parallel.position.y == serial.position.y);
+}
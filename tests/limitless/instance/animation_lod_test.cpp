@@ -0,0 +1,89 @@
+#include "../catch_amalgamated.hpp"
+#include "../util/camera.hpp"
+
+#include <limitless/instances/animation_lod.hpp>
+
+using namespace Limitless;
+using namespace LimitlessTest;
+
+TEST_CASE("AnimationLod selects level by screen size") {
+    Camera camera {{800, 800}};
+    AnimationLod lod;
+    lod.beginFrame(camera);
+
+    REQUIRE(lod.select(Views::boxInFront(camera, 0.5f), false) == 0);
+    REQUIRE(lod.select(Views::boxInFront(camera, 2.0f), false) == 0);
+    REQUIRE(lod.select(Views::boxInFront(camera, 5.0f), false) == 1);
+    REQUIRE(lod.select(Views::boxInFront(camera, 10.0f), false) == 2);
+    REQUIRE(lod.select(Views::boxInFront(camera, 100.0f), false) == 3);
+}
+
+TEST_CASE("AnimationLod skips culled instances without sockets") {
+    Camera camera {{800, 800}};
+    AnimationLod lod;
+    lod.beginFrame(camera);
+
+    const auto behind = Views::boxInFront(camera, -10.0f);
+
+    REQUIRE(lod.select(behind, false) == AnimationLod::CULLED);
+    REQUIRE(lod.select(behind, true) != AnimationLod::CULLED);
+
+    AnimationLodSettings settings;
+    settings.skip_culled = false;
+    lod.setSettings(settings);
+
+    REQUIRE(lod.select(behind, false) != AnimationLod::CULLED);
+}
+
+TEST_CASE("AnimationLod update intervals and leaf skipping follow settings") {
+    AnimationLodSettings settings;
+    settings.update_interval = {1, 2, 4, 0};
+    settings.skip_leaf_bones_level = 2;
+
+    AnimationLod lod {settings};
+
+    REQUIRE(lod.getUpdateInterval(0) == 1);
+    REQUIRE(lod.getUpdateInterval(1) == 2);
+    REQUIRE(lod.getUpdateInterval(2) == 4);
+    REQUIRE(lod.getUpdateInterval(3) == 1);
+    REQUIRE(lod.getUpdateInterval(AnimationLod::CULLED) == 1);
+
+    REQUIRE_FALSE(lod.shouldSkipLeaves(1));
+    REQUIRE(lod.shouldSkipLeaves(2));
+    REQUIRE_FALSE(lod.shouldSkipLeaves(AnimationLod::CULLED));
+}
+
+TEST_CASE("Disabled AnimationLod evaluates everything at full rate") {
+    Camera camera {{800, 800}};
+    AnimationLodSettings settings;
+    settings.enabled = false;
+
+    AnimationLod lod {settings};
+    lod.beginFrame(camera);
+
+    REQUIRE(lod.select(Views::boxInFront(camera, 100.0f), false) == 0);
+    REQUIRE(lod.select(Views::boxInFront(camera, -10.0f), false) == 0);
+    REQUIRE(lod.getUpdateInterval(3) == 1);
+    REQUIRE_FALSE(lod.shouldSkipLeaves(3));
+}
+
+TEST_CASE("AnimationLod counters are reset every frame") {
+    Camera camera {{800, 800}};
+    AnimationLod lod;
+    lod.beginFrame(camera);
+
+    lod.onEvaluated(10);
+    lod.onEvaluated(5);
+    lod.onInterpolated();
+    lod.onSkipped();
+
+    REQUIRE(lod.getStats().evaluated_instances == 2);
+    REQUIRE(lod.getStats().evaluated_bones == 15);
+    REQUIRE(lod.getStats().interpolated_instances == 1);
+    REQUIRE(lod.getStats().skipped_instances == 1);
+
+    lod.beginFrame(camera);
+
+    REQUIRE(lod.getStats().evaluated_instances == 0);
+    REQUIRE(lod.getStats().evaluated_bones == 0);
+}
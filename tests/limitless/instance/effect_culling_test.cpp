@@ -0,0 +1,252 @@
+#include "../catch_amalgamated.hpp"
+#include "../util/camera.hpp"
+#include "../fx/effects.hpp"
+
+#include <limitless/instances/effect_culling.hpp>
+#include <limitless/util/frustum_culling.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/scene.hpp>
+#include <limitless/camera.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+using namespace LimitlessTest;
+
+namespace {
+    class TestEmitter : public Emitter<> {
+    public:
+        // simulated time and number of simulation steps since last clear
+        float simulated {};
+        uint32_t steps {};
+
+        explicit TestEmitter(const glm::vec3& _position)
+            : Emitter<>(Type::Sprite) {
+            spawn.max_count = 10;
+            spawn.spawn_rate = 10.0f;
+            position = _position;
+        }
+
+        void addParticle(const glm::vec3& particle_position, float size) {
+            auto& particle = particles.emplace_back();
+            particle.position = particle_position;
+            particle.size = size;
+            particle.lifetime = 100.0f;
+        }
+
+        void computeBounds() noexcept { updateBounds(); }
+        void setFixedBounds(const Box& box) { fixed_bounds = box; }
+
+        // moves last update back as if time passed since then
+        void skip(std::chrono::duration<float> time) {
+            last_time -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(time);
+        }
+
+        [[nodiscard]] bool isSuspended() const noexcept { return suspended; }
+    protected:
+        void updateParticles(float dt, const Camera& camera, ThreadPool* pool) override {
+            simulated += dt;
+            ++steps;
+            Emitter<>::updateParticles(dt, camera, pool);
+        }
+    };
+}
+
+TEST_CASE("Emitter bounds without particles are its origin") {
+    TestEmitter emitter {glm::vec3{1.0f, 2.0f, 3.0f}};
+
+    REQUIRE_FALSE(emitter.getBounds());
+
+    emitter.computeBounds();
+
+    REQUIRE(emitter.getBounds());
+    REQUIRE(emitter.getBounds()->center == glm::vec3{1.0f, 2.0f, 3.0f});
+    REQUIRE(emitter.getBounds()->size == glm::vec3{0.0f});
+}
+
+TEST_CASE("Emitter bounds contain its particles") {
+    TestEmitter emitter {glm::vec3{0.0f}};
+    emitter.addParticle(glm::vec3{4.0f, 0.0f, 0.0f}, 2.0f);
+    emitter.addParticle(glm::vec3{0.0f, -2.0f, 1.0f}, 1.0f);
+
+    emitter.computeBounds();
+
+    // particle extents are half of their size
+    const auto& bounds = *emitter.getBounds();
+    REQUIRE(bounds.center - bounds.size * 0.5f == glm::vec3{-0.5f, -2.5f, -1.0f});
+    REQUIRE(bounds.center + bounds.size * 0.5f == glm::vec3{5.0f, 1.0f, 1.5f});
+
+    // authored bounds are used as they are, relative to emitter
+    emitter.setFixedBounds(Box {glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{2.0f}});
+    emitter.setPosition(glm::vec3{10.0f, 0.0f, 0.0f});
+    emitter.computeBounds();
+
+    REQUIRE(emitter.getBounds()->center == glm::vec3{10.0f, 1.0f, 0.0f});
+    REQUIRE(emitter.getBounds()->size == glm::vec3{2.0f});
+}
+
+TEST_CASE("EffectCulling culls emitters out of view and suspends far ones") {
+    Camera camera {{800, 800}};
+    EffectCullingSettings settings;
+    settings.distance = 25.0f;
+
+    EffectCulling culling {settings};
+    culling.beginFrame(camera);
+
+    TestEmitter visible {Views::pointInFront(camera, 10.0f)};
+    TestEmitter close {Views::pointInFront(camera, -10.0f)};
+    TestEmitter distant {Views::pointInFront(camera, -100.0f)};
+
+    for (auto* emitter : {&visible, &close, &distant}) {
+        emitter->computeBounds();
+    }
+
+    REQUIRE(culling.select(visible));
+    REQUIRE_FALSE(visible.isCulled());
+
+    // emitter behind camera is not drawn, but still simulated while it is close
+    REQUIRE(culling.select(close));
+    REQUIRE(close.isCulled());
+    REQUIRE_FALSE(close.isSuspended());
+
+    REQUIRE_FALSE(culling.select(distant));
+    REQUIRE(distant.isCulled());
+    REQUIRE(distant.isSuspended());
+
+    REQUIRE(culling.getStats().visible_emitters == 1);
+    REQUIRE(culling.getStats().culled_emitters == 1);
+    REQUIRE(culling.getStats().suspended_emitters == 1);
+}
+
+TEST_CASE("EffectCulling selects suspended emitter that moved into view") {
+    Camera camera {{800, 800}};
+    EffectCulling culling;
+    culling.beginFrame(camera);
+
+    TestEmitter emitter {Views::pointInFront(camera, -100.0f)};
+    emitter.addParticle(Views::pointInFront(camera, -101.0f), 1.0f);
+    emitter.computeBounds();
+
+    REQUIRE_FALSE(culling.select(emitter));
+    REQUIRE(emitter.isSuspended());
+
+    // suspended emitter is not updated, so moving it alone has to bring its bounds along
+    emitter.setPosition(Views::pointInFront(camera, 10.0f));
+
+    culling.beginFrame(camera);
+    REQUIRE(culling.select(emitter));
+    REQUIRE_FALSE(emitter.isCulled());
+}
+
+TEST_CASE("Emitter bounds follow its origin") {
+    TestEmitter emitter {glm::vec3{0.0f}};
+    emitter.addParticle(glm::vec3{1.0f, 0.0f, 0.0f}, 2.0f);
+    emitter.computeBounds();
+
+    // particles in world space stay, new ones spawn at origin
+    emitter.setPosition(glm::vec3{0.0f, 10.0f, 0.0f});
+
+    const auto& bounds = *emitter.getBounds();
+    REQUIRE(bounds.center - bounds.size * 0.5f == glm::vec3{0.0f, -1.0f, -1.0f});
+    REQUIRE(bounds.center + bounds.size * 0.5f == glm::vec3{2.0f, 10.0f, 1.0f});
+
+    // authored bounds are rebuilt around origin
+    emitter.setFixedBounds(Box {glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{2.0f}});
+    emitter.computeBounds();
+    emitter.setPosition(glm::vec3{5.0f, 0.0f, 0.0f});
+
+    REQUIRE(emitter.getBounds()->center == glm::vec3{5.0f, 1.0f, 0.0f});
+    REQUIRE(emitter.getBounds()->size == glm::vec3{2.0f});
+}
+
+TEST_CASE("EffectCulling suspended emitter catches up at most limit of skipped time") {
+    Camera camera {{800, 800}};
+    EffectCullingSettings settings;
+    settings.catch_up = std::chrono::duration<float>{0.5f};
+
+    EffectCulling culling {settings};
+    culling.beginFrame(camera);
+
+    TestEmitter emitter {Views::pointInFront(camera, -100.0f)};
+    emitter.update(camera);
+
+    REQUIRE_FALSE(culling.select(emitter));
+    REQUIRE(emitter.isSuspended());
+
+    // emitter was out of view for ten seconds and then came back into it
+    emitter.skip(std::chrono::duration<float>{10.0f});
+    emitter.setPosition(Views::pointInFront(camera, 10.0f));
+    emitter.computeBounds();
+
+    culling.beginFrame(camera);
+    REQUIRE(culling.select(emitter));
+    REQUIRE_FALSE(emitter.isCulled());
+
+    emitter.simulated = 0.0f;
+    emitter.steps = 0;
+    emitter.update(camera);
+
+    REQUIRE_FALSE(emitter.isSuspended());
+    REQUIRE(emitter.simulated == Catch::Approx(0.5f).margin(1e-3));
+
+    // skipped time is simulated in short steps, then current frame is
+    REQUIRE(emitter.steps >= 15);
+    REQUIRE(emitter.steps <= 17);
+}
+
+TEST_CASE("EffectCulling keeps emitters without bounds visible") {
+    Camera camera {{800, 800}};
+    EffectCulling culling;
+    culling.beginFrame(camera);
+
+    TestEmitter emitter {Views::pointInFront(camera, -100.0f)};
+    REQUIRE_FALSE(emitter.getBounds());
+
+    REQUIRE(culling.select(emitter));
+    REQUIRE_FALSE(emitter.isCulled());
+    REQUIRE_FALSE(emitter.isSuspended());
+}
+
+TEST_CASE("Effect without known bounds is never culled") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+    Camera camera {{800, 800}};
+    Scene scene {context};
+
+    const auto effect = Effects::sparks(assets);
+    const auto bounded = std::make_shared<EffectInstance>(effect, Views::pointInFront(camera, -10.0f));
+    const auto unbounded = std::make_shared<EffectInstance>(effect, Views::pointInFront(camera, -10.0f));
+
+    // particles simulated on GPU are not read back, so emitter without fixed bounds does not know them
+    const auto dispatcher = std::make_shared<char>();
+    unbounded->get<SpriteEmitter>("sparks").enableGpuSimulation(dispatcher);
+
+    bounded->update(camera);
+    unbounded->update(camera);
+
+    REQUIRE(bounded->isBounded());
+    REQUIRE_FALSE(unbounded->isBounded());
+
+    scene.add(bounded);
+    scene.add(unbounded);
+
+    FrustumCulling culling;
+    culling.update(scene, camera);
+
+    const auto& visible = culling.getVisibleInstances();
+    REQUIRE(std::find(visible.begin(), visible.end(), bounded) == visible.end());
+    REQUIRE(std::find(visible.begin(), visible.end(), unbounded) != visible.end());
+
+    EffectCulling effect_culling;
+    effect_culling.beginFrame(camera);
+
+    auto& bounded_emitter = bounded->get<SpriteEmitter>("sparks");
+    auto& unbounded_emitter = unbounded->get<SpriteEmitter>("sparks");
+
+    REQUIRE(effect_culling.select(bounded_emitter));
+    REQUIRE(bounded_emitter.isCulled());
+
+    REQUIRE(effect_culling.select(unbounded_emitter));
+    REQUIRE_FALSE(unbounded_emitter.isCulled());
+}
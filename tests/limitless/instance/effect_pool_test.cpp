@@ -0,0 +1,167 @@
+#include "../catch_amalgamated.hpp"
+#include "../fx/effects.hpp"
+
+#include <limitless/instances/effect_pool.hpp>
+#include <limitless/core/context.hpp>
+#include <limitless/camera.hpp>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+using namespace LimitlessTest;
+
+namespace {
+    const auto& getParticles(EffectInstance& instance) {
+        return instance.get<SpriteEmitter>("sparks").getParticles();
+    }
+
+    class TestEmitter : public Emitter<> {
+    public:
+        TestEmitter()
+            : Emitter<>(Type::Sprite) {
+            spawn.max_count = 10;
+            spawn.spawn_rate = 10.0f;
+        }
+
+        [[nodiscard]] const auto& getParticles() const noexcept { return particles; }
+        [[nodiscard]] bool isSuspended() const noexcept { return suspended; }
+        [[nodiscard]] auto getCatchUp() const noexcept { return catch_up; }
+        [[nodiscard]] auto getStartTime() const noexcept { return start_time; }
+    };
+}
+
+TEST_CASE("EffectPool hands out killed instance reset to its initial state") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+    Camera camera {{800, 800}};
+    EffectPool pool;
+
+    const auto effect = Effects::sparks(assets);
+
+    auto instance = pool.acquire(effect, glm::vec3{1.0f});
+    instance->update(camera);
+    REQUIRE(getParticles(*instance).size() == 1);
+
+    const auto* address = instance.get();
+    const auto id = instance->getId();
+
+    instance->kill();
+    instance.reset();
+
+    instance = pool.acquire(effect, glm::vec3{2.0f});
+
+    REQUIRE(instance.get() == address);
+    REQUIRE(instance->getId() != id);
+    REQUIRE(instance->getPosition() == glm::vec3{2.0f});
+    REQUIRE_FALSE(instance->isKilled());
+    REQUIRE(getParticles(*instance).empty());
+    REQUIRE_FALSE(instance->get<SpriteEmitter>("sparks").getBounds());
+
+    const auto stats = pool.getStats(effect);
+    REQUIRE(stats.created == 1);
+    REQUIRE(stats.reused == 1);
+    REQUIRE(stats.active == 1);
+    REQUIRE(stats.idle == 0);
+
+    // recycled instance draws the same numbers as new instance seeded with its id
+    EffectInstance fresh {effect, glm::vec3{2.0f}};
+    fresh.setSeed(instance->getId());
+
+    instance->update(camera);
+    fresh.update(camera);
+
+    REQUIRE(getParticles(*instance).size() == 1);
+    REQUIRE(getParticles(fresh).size() == 1);
+    REQUIRE(getParticles(*instance)[0].color == getParticles(fresh)[0].color);
+}
+
+TEST_CASE("EffectPool never recycles instance that is still held") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+    EffectPool pool;
+
+    const auto effect = Effects::sparks(assets);
+
+    auto held = pool.acquire(effect, glm::vec3{0.0f});
+    held->kill();
+
+    // e.g. scene did not remove killed instance yet
+    auto holder = held;
+    const auto other = pool.acquire(effect, glm::vec3{0.0f});
+    REQUIRE(other != held);
+    REQUIRE(held->isKilled());
+
+    pool.collect();
+
+    auto stats = pool.getStats(effect);
+    REQUIRE(stats.created == 2);
+    REQUIRE(stats.reused == 0);
+    REQUIRE(stats.active == 2);
+    REQUIRE(stats.idle == 0);
+
+    // any holder left keeps instance from being recycled
+    const auto* address = held.get();
+    held.reset();
+    pool.collect();
+
+    stats = pool.getStats(effect);
+    REQUIRE(stats.active == 2);
+    REQUIRE(stats.idle == 0);
+
+    // pool is the last owner once every holder is gone
+    holder.reset();
+
+    const auto recycled = pool.acquire(effect, glm::vec3{0.0f});
+    REQUIRE(recycled.get() == address);
+    REQUIRE_FALSE(recycled->isKilled());
+
+    stats = pool.getStats(effect);
+    REQUIRE(stats.created == 2);
+    REQUIRE(stats.reused == 1);
+}
+
+TEST_CASE("EffectPool prewarms idle instances") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+    EffectPool pool;
+
+    const auto effect = Effects::sparks(assets);
+
+    pool.prewarm(effect, 3);
+
+    auto stats = pool.getStats(effect);
+    REQUIRE(stats.created == 3);
+    REQUIRE(stats.idle == 3);
+
+    const auto instance = pool.acquire(effect, glm::vec3{0.0f});
+
+    stats = pool.getStats(effect);
+    REQUIRE(stats.created == 3);
+    REQUIRE(stats.reused == 1);
+    REQUIRE(stats.active == 1);
+    REQUIRE(stats.idle == 2);
+}
+
+TEST_CASE("Emitter reset drops particles and suspension") {
+    Camera camera {{800, 800}};
+    TestEmitter emitter;
+
+    emitter.update(camera);
+    REQUIRE(emitter.getParticles().size() == 1);
+    REQUIRE(emitter.getBounds());
+
+    emitter.suspend(std::chrono::duration<float>{2.0f});
+    emitter.setCulled(true);
+    emitter.setLodLevel({0.5f, 0.5f});
+    REQUIRE(emitter.isSuspended());
+
+    emitter.reset();
+
+    REQUIRE(emitter.getParticles().empty());
+    REQUIRE_FALSE(emitter.getBounds());
+    REQUIRE_FALSE(emitter.isDone());
+    REQUIRE_FALSE(emitter.isSuspended());
+    REQUIRE(emitter.getCatchUp().count() == 0.0f);
+    REQUIRE_FALSE(emitter.isCulled());
+    REQUIRE(emitter.getLodLevel().spawn_rate == 1.0f);
+    REQUIRE(emitter.getStartTime() == std::chrono::steady_clock::time_point {});
+}
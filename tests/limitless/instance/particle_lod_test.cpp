@@ -0,0 +1,167 @@
+#include "../catch_amalgamated.hpp"
+#include "../util/camera.hpp"
+
+#include <limitless/instances/particle_lod.hpp>
+#include <limitless/fx/emitters/emitter.hpp>
+#include <limitless/camera.hpp>
+
+using namespace Limitless;
+using namespace LimitlessTest;
+
+namespace {
+    class TestEmitter : public fx::Emitter<> {
+    public:
+        TestEmitter(const Box& box, uint32_t max_count)
+            : Emitter<>(Type::Sprite) {
+            spawn.max_count = max_count;
+            fixed_bounds = Box {glm::vec3{0.0f}, box.size};
+            position = box.center;
+            updateBounds();
+        }
+
+        [[nodiscard]] const auto& getParticles() const noexcept { return particles; }
+    };
+
+    // particles simulated elsewhere count against max count, as GPU simulated ones do
+    class OffloadingEmitter : public TestEmitter {
+    public:
+        size_t offloaded {};
+
+        using TestEmitter::TestEmitter;
+    protected:
+        [[nodiscard]] size_t getAliveCount() const noexcept override { return offloaded + particles.size(); }
+    };
+}
+
+TEST_CASE("ParticleLod selects level by screen size") {
+    Camera camera {{800, 800}};
+    ParticleLod lod;
+    lod.beginFrame(camera);
+
+    REQUIRE(lod.getLevel(Views::boxInFront(camera, 0.5f)) == 0);
+    REQUIRE(lod.getLevel(Views::boxInFront(camera, 2.0f)) == 0);
+    REQUIRE(lod.getLevel(Views::boxInFront(camera, 5.0f)) == 1);
+    REQUIRE(lod.getLevel(Views::boxInFront(camera, 15.0f)) == 2);
+    REQUIRE(lod.getLevel(Views::boxInFront(camera, 50.0f)) == 3);
+
+    // bounds of emitters simulated on GPU are unknown
+    REQUIRE(lod.getLevel(std::nullopt) == 0);
+}
+
+TEST_CASE("ParticleLod sets levels of emitter or default ones") {
+    Camera camera {{800, 800}};
+    ParticleLod lod;
+    lod.beginFrame(camera);
+
+    TestEmitter emitter {Views::boxInFront(camera, 5.0f), 100};
+    lod.select(emitter);
+
+    // emitters without their own levels are not reduced unless settings opt in
+    REQUIRE(emitter.getLodLevel().spawn_rate == 1.0f);
+    REQUIRE(emitter.getLodLevel().max_count == 1.0f);
+
+    ParticleLodSettings settings;
+    settings.default_lod = fx::EmitterLod {};
+    lod.setSettings(settings);
+    lod.select(emitter);
+
+    REQUIRE(emitter.getLodLevel().spawn_rate == 0.5f);
+    REQUIRE(emitter.getLodLevel().max_count == 0.5f);
+
+    fx::EmitterLod own;
+    own.levels[1] = {0.75f, 0.25f};
+    own.levels[1].drop(fx::ModuleType::RotationRate);
+    emitter.getLod() = own;
+
+    lod.select(emitter);
+
+    REQUIRE(emitter.getLodLevel().spawn_rate == 0.75f);
+    REQUIRE(emitter.getLodLevel().max_count == 0.25f);
+    REQUIRE(emitter.getLodLevel().isDropped(fx::ModuleType::RotationRate));
+    REQUIRE_FALSE(emitter.getLodLevel().isDropped(fx::ModuleType::SizeByLife));
+
+    REQUIRE(lod.getStats().emitters[1] == 3);
+}
+
+TEST_CASE("ParticleLod throttles least important emitters to fit budget") {
+    Camera camera {{800, 800}};
+
+    ParticleLodSettings settings;
+    settings.default_lod = fx::EmitterLod {};
+    settings.particle_budget = 1200;
+
+    ParticleLod lod {settings};
+    lod.beginFrame(camera);
+
+    TestEmitter close {Views::boxInFront(camera, 1.0f), 1000};
+    TestEmitter middle {Views::boxInFront(camera, 5.0f), 1000};
+    TestEmitter distant {Views::boxInFront(camera, 50.0f), 1000};
+
+    lod.select(middle);
+    lod.select(distant);
+    lod.select(close);
+
+    REQUIRE(lod.getStats().budgeted_particles == 1600);
+
+    lod.applyBudget();
+
+    REQUIRE(lod.getStats().budgeted_particles == 1200);
+    REQUIRE(lod.getStats().throttled_emitters == 2);
+
+    REQUIRE(close.getLodLevel().max_count == 1.0f);
+    REQUIRE(middle.getLodLevel().max_count == Catch::Approx(0.2f));
+    REQUIRE(middle.getLodLevel().spawn_rate == Catch::Approx(0.2f));
+    REQUIRE(distant.getLodLevel().max_count == 0.0f);
+    REQUIRE(distant.getLodLevel().spawn_rate == 0.0f);
+}
+
+TEST_CASE("Disabled ParticleLod keeps emitters at full detail") {
+    Camera camera {{800, 800}};
+
+    ParticleLodSettings settings;
+    settings.enabled = false;
+    settings.default_lod = fx::EmitterLod {};
+    settings.particle_budget = 1;
+
+    ParticleLod lod {settings};
+    lod.beginFrame(camera);
+
+    TestEmitter emitter {Views::boxInFront(camera, 50.0f), 1000};
+    lod.select(emitter);
+    lod.applyBudget();
+
+    REQUIRE(emitter.getLodLevel().spawn_rate == 1.0f);
+    REQUIRE(emitter.getLodLevel().max_count == 1.0f);
+}
+
+TEST_CASE("Burst scaled to no particles still counts as its loop") {
+    Camera camera {{800, 800}};
+    TestEmitter emitter {Views::boxInFront(camera, 5.0f), 100};
+
+    auto& spawn = emitter.getSpawn();
+    spawn.mode = fx::EmitterSpawn::Mode::Burst;
+    spawn.burst = fx::EmitterSpawn::Burst {};
+    spawn.burst->burst_count = std::make_unique<ConstDistribution<uint32_t>>(3);
+    spawn.burst->loops = 2;
+
+    emitter.setLodLevel({0.1f, 1.0f});
+    emitter.update(camera);
+
+    REQUIRE(emitter.getParticles().empty());
+    REQUIRE(spawn.burst->loops_done == 1);
+}
+
+TEST_CASE("Emitter spawns only up to max count including particles it does not hold") {
+    Camera camera {{800, 800}};
+    OffloadingEmitter emitter {Views::boxInFront(camera, 5.0f), 100};
+    emitter.offloaded = 98;
+
+    auto& spawn = emitter.getSpawn();
+    spawn.mode = fx::EmitterSpawn::Mode::Burst;
+    spawn.burst = fx::EmitterSpawn::Burst {};
+    spawn.burst->burst_count = std::make_unique<ConstDistribution<uint32_t>>(10);
+
+    emitter.update(camera);
+
+    REQUIRE(emitter.getParticles().size() == 2);
+}
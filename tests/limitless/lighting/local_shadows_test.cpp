@@ -0,0 +1,106 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/core/context.hpp>
+#include <limitless/lighting/lighting.hpp>
+#include <limitless/lighting/local_shadows.hpp>
+#include <limitless/camera.hpp>
+
+using namespace Limitless;
+
+TEST_CASE("LocalShadows keeps fallback regions of full atlas across frames") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+
+    RendererSettings settings;
+    settings.local_shadows_atlas_resolution = 1024;
+    settings.local_shadows_min_resolution = 64;
+    settings.local_shadows_max_resolution = 512;
+    settings.local_shadows_texel_budget = 1024 * 1024 * 8;
+
+    LocalShadows shadows {settings};
+    Lighting lighting {context};
+    Camera camera {{1024, 1024}};
+
+    // camera is inside of light radius, so it requests max resolution;
+    // six 512 cube faces do not fit 1024 atlas and fall back to 256
+    auto& light = lighting.add(Light {glm::vec4{1.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, 10.0f});
+    light.castShadow();
+
+    shadows.prepare(lighting, camera, {1024, 1024});
+
+    REQUIRE(shadows.getStats().shadowed_lights == 1);
+    REQUIRE(shadows.getStats().allocated_views == 6);
+    REQUIRE(shadows.getStats().used_texels == 6 * 256 * 256);
+
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        shadows.prepare(lighting, camera, {1024, 1024});
+
+        REQUIRE(shadows.getStats().shadowed_lights == 1);
+        REQUIRE(shadows.getStats().allocated_views == 0);
+        REQUIRE(shadows.getStats().used_texels == 6 * 256 * 256);
+    }
+}
+
+TEST_CASE("LocalShadows reallocates regions when requested resolution changes") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+
+    RendererSettings settings;
+    settings.local_shadows_atlas_resolution = 1024;
+    settings.local_shadows_min_resolution = 64;
+    settings.local_shadows_max_resolution = 512;
+    settings.local_shadows_texel_budget = 1024 * 1024 * 8;
+
+    LocalShadows shadows {settings};
+    Lighting lighting {context};
+    Camera camera {{1024, 1024}};
+
+    auto& light = lighting.add(Light {glm::vec4{1.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, 10.0f});
+    light.castShadow();
+
+    shadows.prepare(lighting, camera, {1024, 1024});
+    REQUIRE(shadows.getStats().allocated_views == 6);
+
+    // far light gets smaller resolution than before
+    camera.setPosition(glm::vec3{-1000.0f, 0.0f, 0.0f});
+    shadows.prepare(lighting, camera, {1024, 1024});
+
+    REQUIRE(shadows.getStats().allocated_views == 6);
+    REQUIRE(shadows.getStats().used_texels < 6 * 256 * 256);
+}
+
+TEST_CASE("LocalShadows applies updated settings") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+
+    RendererSettings settings;
+    settings.local_shadows_atlas_resolution = 1024;
+    settings.local_shadows_min_resolution = 64;
+    settings.local_shadows_max_resolution = 512;
+    settings.local_shadows_texel_budget = 1024 * 1024 * 8;
+
+    LocalShadows shadows {settings};
+    Lighting lighting {context};
+    Camera camera {{1024, 1024}};
+
+    auto& light = lighting.add(Light {glm::vec4{1.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, 10.0f});
+    light.castShadow();
+
+    shadows.prepare(lighting, camera, {1024, 1024});
+    REQUIRE(shadows.getStats().used_texels == 6 * 256 * 256);
+
+    // larger atlas fits max resolution of every cube face
+    settings.local_shadows_atlas_resolution = 2048;
+    shadows.update(settings);
+    REQUIRE(shadows.getAtlas().getSize() == 2048);
+
+    shadows.prepare(lighting, camera, {1024, 1024});
+    REQUIRE(shadows.getStats().allocated_views == 6);
+    REQUIRE(shadows.getStats().used_texels == 6 * 512 * 512);
+
+    // settings that keep atlas layout keep allocated regions
+    settings.local_shadows_update_budget = 1;
+    shadows.update(settings);
+
+    shadows.prepare(lighting, camera, {1024, 1024});
+    REQUIRE(shadows.getStats().allocated_views == 0);
+    REQUIRE(shadows.getStats().used_texels == 6 * 512 * 512);
+    REQUIRE(shadows.getStats().rendered_views <= 1);
+}
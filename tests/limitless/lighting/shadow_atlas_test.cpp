@@ -0,0 +1,57 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/lighting/shadow_atlas.hpp>
+
+using namespace Limitless;
+
+TEST_CASE("ShadowAtlas allocates whole atlas") {
+    ShadowAtlas atlas {1024, 64};
+
+    auto region = atlas.allocate(1024);
+
+    REQUIRE(region.has_value());
+    REQUIRE(region->origin == glm::uvec2{0, 0});
+    REQUIRE(region->size == 1024);
+    REQUIRE(atlas.getAllocatedTexels() == 1024 * 1024);
+    REQUIRE_FALSE(atlas.allocate(64).has_value());
+}
+
+TEST_CASE("ShadowAtlas rounds sizes to power of two") {
+    ShadowAtlas atlas {1024, 64};
+
+    REQUIRE(atlas.allocate(100)->size == 128);
+    REQUIRE(atlas.allocate(1)->size == 64);
+    REQUIRE_FALSE(atlas.allocate(4096).has_value());
+}
+
+TEST_CASE("ShadowAtlas packs smaller regions into split nodes") {
+    ShadowAtlas atlas {1024, 64};
+
+    auto big = atlas.allocate(512);
+    auto small1 = atlas.allocate(128);
+    auto small2 = atlas.allocate(128);
+
+    REQUIRE(big->origin == glm::uvec2{0, 0});
+    REQUIRE(small1->origin == glm::uvec2{512, 0});
+    REQUIRE(small2->origin == glm::uvec2{640, 0});
+}
+
+TEST_CASE("ShadowAtlas merges freed regions") {
+    ShadowAtlas atlas {1024, 64};
+
+    std::vector<ShadowAtlas::Region> regions;
+    for (uint32_t i = 0; i < 256; ++i) {
+        auto region = atlas.allocate(64);
+        REQUIRE(region.has_value());
+        regions.emplace_back(*region);
+    }
+
+    REQUIRE_FALSE(atlas.allocate(64).has_value());
+
+    for (const auto& region : regions) {
+        atlas.free(region);
+    }
+
+    REQUIRE(atlas.getAllocatedTexels() == 0);
+    REQUIRE(atlas.allocate(1024).has_value());
+}
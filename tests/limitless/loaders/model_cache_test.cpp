@@ -0,0 +1,242 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/loaders/model_cache.hpp>
+
+#include <fstream>
+
+using namespace Limitless;
+
+namespace {
+    class TempDirectory {
+    public:
+        fs::path path;
+
+        explicit TempDirectory(const std::string& name)
+            : path {fs::temp_directory_path() / name} {
+            fs::remove_all(path);
+        }
+
+        ~TempDirectory() {
+            fs::remove_all(path);
+        }
+    };
+
+    ModelCache::Entry makeEntry() {
+        ModelCache::Entry entry;
+        entry.content_key = 42;
+        entry.sources.push_back({"models/model.gltf", 1000, 123456789});
+        entry.sources.push_back({"models/model.bin", 5000, -1});
+
+        auto& model = entry.model;
+        model.skeletal = true;
+
+        auto& mesh = model.meshes.emplace_back();
+        mesh.name = "body";
+        mesh.material = 1;
+        mesh.skinned = true;
+        for (uint32_t i = 0; i < 100; ++i) {
+            const auto f = static_cast<float>(i);
+            mesh.vertices.push_back({glm::vec3{f, f + 1.0f, f + 2.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec2{f * 0.01f, 1.0f - f * 0.01f}});
+            mesh.indices.push_back(99 - i);
+            mesh.bone_weights.push_back({{i % 2, 1, 0, 0}, {0.75f, 0.25f, 0.0f, 0.0f}});
+        }
+
+        auto& plain = model.meshes.emplace_back();
+        plain.name = "hat";
+
+        model.bones.emplace_back(0, "root", glm::mat4{2.0f}, glm::mat4{1.0f});
+        model.bones.emplace_back(1, "arm", glm::mat4{1.0f}, glm::mat4{3.0f});
+        model.bones.back().joint_index = 0;
+        model.bones.back().position = glm::vec3{1.0f, 2.0f, 3.0f};
+
+        model.skeletons.emplace_back(0).add(1);
+
+        auto& animation = model.animations.emplace_back();
+        animation.name = "wave";
+        animation.duration = 2.0;
+        animation.tps = 1.0;
+
+        auto& node = animation.nodes.emplace_back();
+        node.bone = 1;
+        node.positions.emplace_back(glm::vec3{0.0f}, 0.0);
+        node.positions.emplace_back(glm::vec3{1.0f}, 2.0);
+        node.rotations.emplace_back(glm::fquat{1.0f, 0.0f, 0.0f, 0.0f}, 1.0);
+
+        auto& material = model.materials.emplace_back();
+        material.name = "model_skin";
+        material.blending = ms::Blending::Translucent;
+        material.alpha_cutoff = 0.5f;
+        material.two_sided = true;
+        material.color = glm::vec4{0.5f};
+        material.ior = 1.33f;
+
+        auto& diffuse = material.diffuse.emplace();
+        diffuse.path = "textures/skin.png";
+        diffuse.flags.space = TextureLoaderFlags::Space::sRGB;
+        diffuse.flags.mipmap = false;
+
+        auto& normal = material.normal.emplace();
+        normal.name = "model_skin_normal";
+        normal.bytes = {1, 2, 3, 4, 5};
+
+        model.materials.emplace_back().name = "model_plain";
+
+        return entry;
+    }
+}
+
+TEST_CASE("ModelCache restores saved model") {
+    const TempDirectory dir {"limitless_model_cache_test"};
+
+    const auto entry = makeEntry();
+    const auto& source = entry.model;
+    const auto key = ModelCache::hash("model source");
+    const auto path = ModelCache::getPath(dir.path, key);
+
+    ModelCache::save(path, key, entry);
+
+    const auto loaded_entry = ModelCache::load(path, key);
+    REQUIRE(loaded_entry);
+    CHECK(loaded_entry->content_key == 42);
+    CHECK(loaded_entry->sources == entry.sources);
+
+    const auto& loaded = loaded_entry->model;
+    CHECK(loaded.skeletal);
+
+    REQUIRE(loaded.meshes.size() == 2);
+    const auto& mesh = loaded.meshes[0];
+    CHECK(mesh.name == "body");
+    CHECK(mesh.material == 1);
+    CHECK(mesh.skinned);
+    REQUIRE(mesh.vertices.size() == 100);
+    CHECK(mesh.vertices[42].position == source.meshes[0].vertices[42].position);
+    CHECK(mesh.vertices[42].uv == source.meshes[0].vertices[42].uv);
+    CHECK(mesh.indices == source.meshes[0].indices);
+    REQUIRE(mesh.bone_weights.size() == 100);
+    CHECK(mesh.bone_weights[7].bone_index == source.meshes[0].bone_weights[7].bone_index);
+    CHECK(mesh.bone_weights[7].weight == source.meshes[0].bone_weights[7].weight);
+
+    const auto& plain = loaded.meshes[1];
+    CHECK(plain.name == "hat");
+    CHECK(plain.material == ModelData::NO_MATERIAL);
+    CHECK_FALSE(plain.skinned);
+    CHECK(plain.vertices.empty());
+
+    REQUIRE(loaded.bones.size() == 2);
+    CHECK(loaded.bones[0].name == "root");
+    CHECK(loaded.bones[0].node_transform == glm::mat4{2.0f});
+    CHECK_FALSE(loaded.bones[0].joint_index);
+    CHECK(loaded.bones[1].joint_index == 0u);
+    CHECK(loaded.bones[1].offset_matrix == glm::mat4{3.0f});
+    CHECK(loaded.bones[1].position == glm::vec3{1.0f, 2.0f, 3.0f});
+
+    CHECK(loaded.skeletons == source.skeletons);
+
+    REQUIRE(loaded.animations.size() == 1);
+    const auto& animation = loaded.animations[0];
+    CHECK(animation.name == "wave");
+    CHECK(animation.duration == 2.0);
+    REQUIRE(animation.nodes.size() == 1);
+    CHECK(animation.nodes[0].bone == 1);
+    REQUIRE(animation.nodes[0].positions.size() == 2);
+    CHECK(animation.nodes[0].positions[1].data == glm::vec3{1.0f});
+    CHECK(animation.nodes[0].positions[1].time == 2.0);
+    CHECK(animation.nodes[0].rotations.size() == 1);
+    CHECK(animation.nodes[0].scales.empty());
+
+    REQUIRE(loaded.materials.size() == 2);
+    const auto& material = loaded.materials[0];
+    CHECK(material.name == "model_skin");
+    CHECK(material.blending == ms::Blending::Translucent);
+    CHECK(material.alpha_cutoff == 0.5f);
+    CHECK(material.two_sided);
+    CHECK_FALSE(material.unlit);
+    CHECK(material.color == glm::vec4{0.5f});
+    CHECK(material.ior == 1.33f);
+    REQUIRE(material.diffuse);
+    CHECK(material.diffuse->path == "textures/skin.png");
+    CHECK(material.diffuse->flags.space == TextureLoaderFlags::Space::sRGB);
+    CHECK_FALSE(material.diffuse->flags.mipmap);
+    REQUIRE(material.normal);
+    CHECK(material.normal->path.empty());
+    CHECK(material.normal->name == "model_skin_normal");
+    CHECK(material.normal->bytes == std::vector<uint8_t>{1, 2, 3, 4, 5});
+    CHECK_FALSE(material.emissive_mask);
+
+    const auto& plain_material = loaded.materials[1];
+    CHECK(plain_material.name == "model_plain");
+    CHECK_FALSE(plain_material.alpha_cutoff);
+    CHECK_FALSE(plain_material.ior);
+    CHECK_FALSE(plain_material.diffuse);
+}
+
+TEST_CASE("ModelCache does not load file of another key") {
+    const TempDirectory dir {"limitless_model_cache_key_test"};
+
+    const auto key = ModelCache::hash("model source");
+    const auto path = ModelCache::getPath(dir.path, key);
+    ModelCache::save(path, key, makeEntry());
+
+    CHECK(ModelCache::load(path, key));
+    CHECK_FALSE(ModelCache::load(path, ModelCache::hash("changed model source")));
+    CHECK_FALSE(ModelCache::load(ModelCache::getPath(dir.path, key + 1), key + 1));
+}
+
+TEST_CASE("ModelCache treats damaged file as missing") {
+    const TempDirectory dir {"limitless_model_cache_damaged_test"};
+
+    const auto key = ModelCache::hash("model source");
+    const auto path = ModelCache::getPath(dir.path, key);
+    ModelCache::save(path, key, makeEntry());
+
+    fs::resize_file(path, fs::file_size(path) / 2);
+
+    CHECK_FALSE(ModelCache::load(path, key));
+}
+
+TEST_CASE("ModelCache hash depends on every byte") {
+    const std::string source(1000, 'a');
+
+    auto changed = source;
+    changed[997] = 'b';
+
+    CHECK(ModelCache::hash(source) == ModelCache::hash(source));
+    CHECK(ModelCache::hash(source) != ModelCache::hash(changed));
+    CHECK(ModelCache::hash(source) != ModelCache::hash(source.substr(1)));
+    CHECK(ModelCache::hash(source, 1) != ModelCache::hash(source, 2));
+}
+
+TEST_CASE("ModelCache leaves no temporary files after save") {
+    const TempDirectory dir {"limitless_model_cache_temporary_test"};
+
+    const auto key = ModelCache::hash("model source");
+    const auto path = ModelCache::getPath(dir.path, key);
+    ModelCache::save(path, key, makeEntry());
+    ModelCache::save(path, key, makeEntry());
+
+    size_t files {};
+    for ([[maybe_unused]] const auto& entry : fs::directory_iterator(dir.path)) {
+        ++files;
+    }
+
+    CHECK(files == 1);
+    CHECK(ModelCache::load(path, key));
+}
+
+TEST_CASE("ModelCache treats too deep skeleton as damaged file") {
+    const TempDirectory dir {"limitless_model_cache_skeleton_test"};
+
+    auto entry = makeEntry();
+
+    // each level is a single child, depth alone makes it invalid
+    auto* node = &entry.model.skeletons.emplace_back(0);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        node = &node->add(i);
+    }
+
+    const auto key = ModelCache::hash("deep model source");
+    const auto path = ModelCache::getPath(dir.path, key);
+    ModelCache::save(path, key, entry);
+
+    CHECK_FALSE(ModelCache::load(path, key));
+}
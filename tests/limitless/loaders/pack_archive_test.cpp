@@ -0,0 +1,123 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/loaders/pack_archives.hpp>
+
+#include <fstream>
+
+using namespace Limitless;
+
+namespace {
+    class TempDirectory {
+    public:
+        fs::path path;
+
+        explicit TempDirectory(const std::string& name)
+            : path {fs::temp_directory_path() / name} {
+            fs::remove_all(path);
+            fs::create_directories(path);
+        }
+
+        ~TempDirectory() {
+            fs::remove_all(path);
+        }
+
+        void write(const fs::path& name, const std::string& contents) const {
+            fs::create_directories((path / name).parent_path());
+            std::ofstream stream(path / name, std::ios::binary);
+            stream << contents;
+        }
+    };
+}
+
+TEST_CASE("PackArchive finds packed files by name") {
+    const TempDirectory dir {"limitless_pack_archive_test"};
+    dir.write("assets/materials/red.lmat", "red material");
+    dir.write("assets/textures/stone.png", "stone texture");
+    dir.write("assets/empty", "");
+
+    const auto archive_path = dir.path / "assets.lpak";
+
+    PackWriter writer;
+    writer.addDirectory(dir.path / "assets");
+    writer.write(archive_path);
+
+    const PackArchive archive {archive_path};
+    CHECK(archive.size() == 3);
+
+    const auto material = archive.find("materials/red.lmat");
+    REQUIRE(material);
+    CHECK(*material == "red material");
+    CHECK(archive.contains(material->data()));
+    CHECK(reinterpret_cast<uintptr_t>(material->data()) % PackArchive::BLOB_ALIGNMENT == 0);
+
+    const auto texture = archive.find("textures/stone.png");
+    REQUIRE(texture);
+    CHECK(*texture == "stone texture");
+
+    const auto empty = archive.find("empty");
+    REQUIRE(empty);
+    CHECK(empty->empty());
+
+    CHECK_FALSE(archive.find("materials/blue.lmat"));
+    CHECK_FALSE(archive.find("red.lmat"));
+}
+
+TEST_CASE("PackArchive rejects file that is not archive") {
+    const TempDirectory dir {"limitless_pack_archive_invalid_test"};
+    dir.write("not_archive", "definitely not an archive");
+
+    CHECK_THROWS_AS(PackArchive {dir.path / "not_archive"}, pack_archive_exception);
+}
+
+TEST_CASE("PackWriter rejects files with the same name") {
+    const TempDirectory dir {"limitless_pack_archive_duplicate_test"};
+    dir.write("a", "a");
+    dir.write("b", "b");
+
+    PackWriter writer;
+    writer.add("file", dir.path / "a");
+    writer.add("./file", dir.path / "b");
+
+    CHECK_THROWS_AS(writer.write(dir.path / "archive.lpak"), pack_archive_exception);
+}
+
+TEST_CASE("PackArchives resolve paths under mount points") {
+    const TempDirectory dir {"limitless_pack_archives_test"};
+    dir.write("base/materials/red.lmat", "base red");
+    dir.write("base/materials/blue.lmat", "base blue");
+    dir.write("patch/materials/red.lmat", "patched red");
+    dir.write("disk/green.lmat", "green on disk");
+
+    PackWriter base;
+    base.addDirectory(dir.path / "base");
+    base.write(dir.path / "base.lpak");
+
+    PackWriter patch;
+    patch.addDirectory(dir.path / "patch");
+    patch.write(dir.path / "patch.lpak");
+
+    PackArchives archives;
+    CHECK(archives.empty());
+
+    archives.mount(dir.path / "base.lpak", "assets/");
+    archives.mount(dir.path / "patch.lpak", "assets");
+
+    // later archive shadows entries of earlier one
+    CHECK(archives.find("assets/materials/red.lmat") == "patched red");
+    CHECK(archives.find("assets/materials/blue.lmat") == "base blue");
+    CHECK(archives.find("assets/./textures/../materials/blue.lmat") == "base blue");
+
+    CHECK_FALSE(archives.find("materials/blue.lmat"));
+    CHECK_FALSE(archives.find("assets2/materials/blue.lmat"));
+
+    const auto archived = archives.open("assets/materials/blue.lmat");
+    CHECK(archived.isArchived());
+    CHECK(archives.contains(archived.data()));
+
+    const auto disk = archives.open(dir.path / "disk/green.lmat");
+    CHECK_FALSE(disk.isArchived());
+    CHECK_FALSE(archives.contains(disk.data()));
+
+    auto reader = disk.reader();
+    CHECK(reader.view(reader.size()) == "green on disk");
+}
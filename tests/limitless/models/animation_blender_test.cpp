@@ -0,0 +1,151 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/animation_blender.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Limitless;
+
+namespace {
+    AnimationNode makeTranslation(Bone& bone, const glm::vec3& position) {
+        return {
+            std::vector<KeyFrame<glm::vec3>>{{position, 0.0}, {position, 10.0}},
+            std::vector<KeyFrame<glm::fquat>>{},
+            std::vector<KeyFrame<glm::vec3>>{},
+            bone
+        };
+    }
+
+    /**
+     * Chain root -> child, clips "a" and "b" move root and child to constant positions
+     */
+    std::shared_ptr<SkeletalModel> makeModel() {
+        std::vector<Bone> bones;
+        bones.emplace_back(0, "root", glm::mat4{1.0f});
+        bones.emplace_back(1, "child", glm::translate(glm::mat4{1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}), glm::mat4{1.0f});
+        bones[0].joint_index = 0;
+        bones[1].joint_index = 1;
+        bones[1].position = glm::vec3{0.0f, 1.0f, 0.0f};
+
+        std::vector<AnimationNode> a;
+        a.emplace_back(makeTranslation(bones[0], glm::vec3{0.0f}));
+        a.emplace_back(makeTranslation(bones[1], glm::vec3{0.0f, 1.0f, 0.0f}));
+
+        std::vector<AnimationNode> b;
+        b.emplace_back(makeTranslation(bones[0], glm::vec3{10.0f, 0.0f, 0.0f}));
+        b.emplace_back(makeTranslation(bones[1], glm::vec3{0.0f, 3.0f, 0.0f}));
+
+        std::vector<Animation> animations;
+        animations.emplace_back("a", 10.0, 10.0, std::move(a));
+        animations.emplace_back("b", 10.0, 10.0, std::move(b));
+
+        Tree<uint32_t> skeleton {0};
+        skeleton.add(1);
+
+        return std::make_shared<SkeletalModel>(
+            std::vector<std::shared_ptr<AbstractMesh>>{},
+            std::vector<std::shared_ptr<ms::Material>>{},
+            std::move(bones),
+            std::unordered_map<std::string, uint32_t>{{"root", 0}, {"child", 1}},
+            std::vector<Tree<uint32_t>>{std::move(skeleton)},
+            std::move(animations),
+            "chain"
+        );
+    }
+
+    class Result {
+    public:
+        std::vector<glm::mat4> global {2, glm::mat4{1.0f}};
+        std::vector<glm::mat4> bones {2, glm::mat4{1.0f}};
+    };
+}
+
+TEST_CASE("AnimationBlender blends clips by weight") {
+    auto model = makeModel();
+    const auto& animations = model->getAnimations();
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    blender.add(animations[0], 0.5f);
+    blender.add(animations[1], 0.5f);
+
+    Result result;
+    blender.evaluate(*model, result.global, result.bones);
+
+    REQUIRE(result.bones[0][3].x == Catch::Approx(5.0f));
+    REQUIRE(result.bones[1][3].x == Catch::Approx(5.0f));
+    REQUIRE(result.bones[1][3].y == Catch::Approx(2.0f));
+}
+
+TEST_CASE("AnimationBlender gives remaining weight to bind pose") {
+    auto model = makeModel();
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    blender.add(model->getAnimations()[1], 0.25f);
+
+    Result result;
+    blender.evaluate(*model, result.global, result.bones);
+
+    REQUIRE(result.bones[0][3].x == Catch::Approx(2.5f));
+    REQUIRE(result.bones[1][3].y == Catch::Approx(1.5f));
+}
+
+TEST_CASE("AnimationBlender limits layer by bone mask") {
+    auto model = makeModel();
+    const auto& animations = model->getAnimations();
+
+    auto mask = std::make_shared<BoneMask>(BoneMask::subtree(*model, "child"));
+    REQUIRE((*mask)[0] == 0.0f);
+    REQUIRE((*mask)[1] == 1.0f);
+    REQUIRE_THROWS_AS(BoneMask::subtree(*model, "tail"), bone_not_found);
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    blender.add(animations[0], 1.0f);
+    blender.add(animations[1], 1.0f, mask);
+
+    Result result;
+    blender.evaluate(*model, result.global, result.bones);
+
+    // root follows only "a", child is averaged
+    REQUIRE(result.bones[0][3].x == Catch::Approx(0.0f));
+    REQUIRE(result.bones[1][3].y == Catch::Approx(2.0f));
+}
+
+TEST_CASE("AnimationBlender applies additive layers on top") {
+    auto model = makeModel();
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    blender.add(model->getAnimations()[0], 1.0f);
+    blender.add(model->getAnimations()[1], 0.5f, {}, true);
+
+    Result result;
+    blender.evaluate(*model, result.global, result.bones);
+
+    // half of (b - bind) is added to a
+    REQUIRE(result.bones[0][3].x == Catch::Approx(5.0f));
+    REQUIRE(result.bones[1][3].y == Catch::Approx(2.0f));
+}
+
+TEST_CASE("AnimationBlender crossfades and drops faded out layers") {
+    auto model = makeModel();
+    const auto& animations = model->getAnimations();
+
+    AnimationBlender blender;
+    blender.initialize(*model);
+    blender.add(animations[0]);
+    blender.crossfade(animations[1], 1.0);
+
+    REQUIRE_FALSE(blender.isSingleClip());
+
+    blender.advance(0.5);
+    REQUIRE(blender.getLayers().size() == 2);
+    REQUIRE(blender.getLayers()[0].weight == Catch::Approx(0.5f));
+    REQUIRE(blender.getLayers()[1].weight == Catch::Approx(0.5f));
+
+    blender.advance(0.5);
+    REQUIRE(blender.getLayers().size() == 1);
+    REQUIRE(blender.getLayers()[0].animation == &animations[1]);
+    REQUIRE(blender.isSingleClip());
+}
@@ -0,0 +1,64 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+
+using namespace Limitless;
+
+namespace {
+    AnimationNode makeNode(Bone& bone, uint32_t count) {
+        std::vector<KeyFrame<glm::vec3>> positions;
+        std::vector<KeyFrame<glm::fquat>> rotations;
+        std::vector<KeyFrame<glm::vec3>> scales;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            positions.emplace_back(glm::vec3{static_cast<float>(i)}, static_cast<double>(i));
+            rotations.emplace_back(glm::fquat{1.0f, 0.0f, 0.0f, 0.0f}, static_cast<double>(i) * 0.5);
+            scales.emplace_back(glm::vec3{1.0f}, static_cast<double>(i) * 2.0);
+        }
+
+        return {std::move(positions), std::move(rotations), std::move(scales), bone};
+    }
+}
+
+TEST_CASE("AnimationNode finds keyframe segment containing time") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+    auto node = makeNode(bone, 10);
+
+    REQUIRE(node.findPositionKeyframe(0.0) == 0);
+    REQUIRE(node.findPositionKeyframe(0.5) == 0);
+    REQUIRE(node.findPositionKeyframe(1.0) == 0);
+    REQUIRE(node.findPositionKeyframe(1.5) == 1);
+    REQUIRE(node.findPositionKeyframe(8.5) == 8);
+    REQUIRE(node.findPositionKeyframe(9.0) == 8);
+    REQUIRE(node.findPositionKeyframe(42.0) == 0);
+}
+
+TEST_CASE("AnimationNode cursor lookup matches stateless lookup") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+    auto node = makeNode(bone, 100);
+
+    AnimationNode::Cursor cursor;
+
+    // forward playback with loops and seeks
+    for (double time = 0.0; time < 300.0; time += 0.3) {
+        const auto t = glm::mod(time, 99.0);
+        REQUIRE(node.findPositionKeyframe(t, cursor.position) == node.findPositionKeyframe(t));
+        REQUIRE(node.findRotationKeyframe(t, cursor.rotation) == node.findRotationKeyframe(t));
+        REQUIRE(node.findScalingKeyframe(t, cursor.scaling) == node.findScalingKeyframe(t));
+    }
+
+    for (double t : {50.0, 3.0, 97.5, 0.0, 60.2}) {
+        REQUIRE(node.findPositionKeyframe(t, cursor.position) == node.findPositionKeyframe(t));
+    }
+}
+
+TEST_CASE("AnimationNode interpolates position with cursor") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+    auto node = makeNode(bone, 10);
+
+    AnimationNode::Cursor cursor;
+
+    REQUIRE(node.positionLerp(2.5, cursor) == glm::vec3{2.5f});
+    REQUIRE(node.positionLerp(2.75, cursor) == glm::vec3{2.75f});
+    REQUIRE(node.positionLerp(7.0, cursor) == glm::vec3{7.0f});
+}
@@ -0,0 +1,81 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/baked_animations.hpp>
+#include <limitless/models/skeletal_model.hpp>
+#include <limitless/instances/skeletal_instance.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Limitless;
+
+namespace {
+    /**
+     * Two-bone chain, root moves along x from 0 to 10 during 1 second
+     */
+    std::shared_ptr<SkeletalModel> makeModel() {
+        std::vector<Bone> bones;
+        bones.emplace_back(0, "root", glm::mat4{1.0f});
+        bones.emplace_back(1, "child", glm::translate(glm::mat4{1.0f}, glm::vec3{0.0f, 1.0f, 0.0f}), glm::mat4{1.0f});
+        bones[0].joint_index = 0;
+        bones[1].joint_index = 1;
+
+        std::vector<AnimationNode> nodes;
+        nodes.emplace_back(
+            std::vector<KeyFrame<glm::vec3>>{{glm::vec3{0.0f}, 0.0}, {glm::vec3{10.0f, 0.0f, 0.0f}, 25.0}},
+            std::vector<KeyFrame<glm::fquat>>{},
+            std::vector<KeyFrame<glm::vec3>>{},
+            bones[0]
+        );
+
+        std::vector<Animation> animations;
+        animations.emplace_back("move", 25.0, 25.0, std::move(nodes));
+
+        Tree<uint32_t> skeleton {0};
+        skeleton.add(1);
+
+        std::unordered_map<std::string, uint32_t> bone_map {{"root", 0}, {"child", 1}};
+
+        return std::make_shared<SkeletalModel>(
+            std::vector<std::shared_ptr<AbstractMesh>>{},
+            std::vector<std::shared_ptr<ms::Material>>{},
+            std::move(bones),
+            std::move(bone_map),
+            std::vector<Tree<uint32_t>>{std::move(skeleton)},
+            std::move(animations),
+            "chain"
+        );
+    }
+}
+
+TEST_CASE("BakedAnimations samples animation at fixed rate") {
+    auto model = makeModel();
+    BakedAnimations baked {*model, 4.0};
+
+    REQUIRE(baked.getJointCount() == 2);
+    REQUIRE(baked.getClips().size() == 1);
+
+    const auto& clip = baked.getClips()[0];
+    REQUIRE(clip.first_frame == 0);
+    REQUIRE(clip.frame_count == 5);
+    REQUIRE(clip.joint_count == 2);
+    REQUIRE(clip.frame_rate == Catch::Approx(4.0f));
+    REQUIRE(baked.getPalettes().size() == 10);
+    REQUIRE(baked.getDuration(0) == Catch::Approx(1.0));
+
+    // frame 2 is half of animation
+    const auto& root = baked.getPalettes()[2 * 2 + 0];
+    const auto& child = baked.getPalettes()[2 * 2 + 1];
+    REQUIRE(root[3].x == Catch::Approx(5.0f));
+    REQUIRE(child[3].x == Catch::Approx(5.0f));
+    REQUIRE(child[3].y == Catch::Approx(1.0f));
+
+    // last frame samples the end of animation
+    REQUIRE(baked.getPalettes()[4 * 2][3].x == Catch::Approx(10.0f));
+}
+
+TEST_CASE("BakedAnimations finds animation by name") {
+    auto model = makeModel();
+    BakedAnimations baked {*model};
+
+    REQUIRE(baked.getAnimationIndex("move") == 0);
+    REQUIRE_THROWS_AS(baked.getAnimationIndex("jump"), no_such_animation);
+}
@@ -0,0 +1,148 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+
+using namespace Limitless;
+
+TEST_CASE("QuantizedQuat restores rotation within precision") {
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const auto f = static_cast<float>(i);
+        const auto axis = glm::normalize(glm::vec3{glm::sin(f * 1.3f), glm::cos(f * 0.7f), glm::sin(f * 0.2f) + 0.1f});
+        const auto q = glm::angleAxis(f * 0.037f, axis);
+
+        const auto decoded = QuantizedQuat::encode(q).decode();
+
+        REQUIRE(std::abs(glm::dot(q, decoded)) == Catch::Approx(1.0f).margin(1e-6f));
+    }
+}
+
+TEST_CASE("Compressed vec3 track stays within error threshold") {
+    std::vector<KeyFrame<glm::vec3>> keys;
+    for (uint32_t i = 0; i < 300; ++i) {
+        const auto t = static_cast<double>(i);
+        keys.emplace_back(glm::vec3(glm::sin(t * 0.05), glm::cos(t * 0.03) * 4.0, t * 0.01), t);
+    }
+
+    const auto error = 0.001f;
+    const auto track = CompressedVec3Track::compress(keys, error);
+
+    REQUIRE(track);
+    REQUIRE(track->getSampleCount() <= keys.size() * 2);
+    for (const auto& key : keys) {
+        const auto value = track->sample(key.time);
+        REQUIRE(glm::abs(value.x - key.data.x) <= error);
+        REQUIRE(glm::abs(value.y - key.data.y) <= error);
+        REQUIRE(glm::abs(value.z - key.data.z) <= error);
+    }
+}
+
+TEST_CASE("Compressed track stores constant channel as single sample") {
+    std::vector<KeyFrame<glm::vec3>> scales;
+    std::vector<KeyFrame<glm::fquat>> rotations;
+    for (uint32_t i = 0; i < 100; ++i) {
+        scales.emplace_back(glm::vec3{1.0f}, static_cast<double>(i));
+        rotations.emplace_back(glm::angleAxis(0.5f, glm::vec3{0.0f, 1.0f, 0.0f}), static_cast<double>(i));
+    }
+
+    const auto scale = CompressedVec3Track::compress(scales, 0.001f);
+    const auto rotation = CompressedQuatTrack::compress(rotations, 0.001f);
+
+    REQUIRE(scale->getSampleCount() == 1);
+    REQUIRE(rotation->getSampleCount() == 1);
+    REQUIRE(scale->sample(42.0).x == Catch::Approx(1.0f));
+}
+
+TEST_CASE("AnimationNode keeps keyframes of track that cannot be compressed within error") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+
+    // step is much shorter than any uniform sample step
+    std::vector<KeyFrame<glm::vec3>> positions;
+    positions.emplace_back(glm::vec3{0.0f}, 0.0);
+    positions.emplace_back(glm::vec3{0.0f}, 1.0);
+    positions.emplace_back(glm::vec3{10.0f}, 1.0001);
+    positions.emplace_back(glm::vec3{10.0f}, 2.0);
+
+    std::vector<KeyFrame<glm::fquat>> rotations;
+    rotations.emplace_back(glm::angleAxis(0.0f, glm::vec3{0.0f, 0.0f, 1.0f}), 0.0);
+    rotations.emplace_back(glm::angleAxis(1.0f, glm::vec3{0.0f, 0.0f, 1.0f}), 2.0);
+
+    REQUIRE_FALSE(CompressedVec3Track::compress(positions, 0.001f).has_value());
+
+    AnimationNode node {positions, rotations, {}, bone};
+    node.compress({});
+
+    REQUIRE(node.positions.size() == 4);
+    REQUIRE(node.rotations.empty());
+
+    size_t cursor {};
+    REQUIRE(node.findPositionKeyframe(1.00005, cursor) == 1);
+    REQUIRE(node.positionLerp(1.00005)->x == Catch::Approx(5.0f).margin(0.001f));
+    REQUIRE(node.positionLerp(1.5)->x == 10.0f);
+    REQUIRE(glm::abs(glm::dot(*node.rotationLerp(1.0), glm::angleAxis(0.5f, glm::vec3{0.0f, 0.0f, 1.0f}))) == Catch::Approx(1.0f).margin(1e-5f));
+}
+
+TEST_CASE("Compressed AnimationNode samples through lerp functions") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+
+    std::vector<KeyFrame<glm::vec3>> positions;
+    std::vector<KeyFrame<glm::fquat>> rotations;
+    for (uint32_t i = 0; i < 100; ++i) {
+        const auto t = static_cast<float>(i);
+        positions.emplace_back(glm::vec3{t, 0.0f, 0.0f}, static_cast<double>(i));
+        rotations.emplace_back(glm::angleAxis(t * 0.02f, glm::vec3{0.0f, 0.0f, 1.0f}), static_cast<double>(i));
+    }
+
+    AnimationNode node {positions, rotations, {}, bone};
+    const auto original_usage = node.getMemoryUsage();
+
+    node.compress({});
+
+    REQUIRE(node.positions.empty());
+    REQUIRE(node.getMemoryUsage() < original_usage);
+
+    AnimationNode::Cursor cursor;
+    REQUIRE(node.positionLerp(10.5, cursor)->x == Catch::Approx(10.5f).margin(0.001f));
+    REQUIRE(glm::abs(glm::dot(*node.rotationLerp(20.0, cursor), rotations[20].data)) == Catch::Approx(1.0f).margin(1e-6f));
+    REQUIRE_FALSE(node.scalingLerp(20.0, cursor).has_value());
+}
+
+TEST_CASE("Compressed and uncompressed AnimationNode clamp at track ends") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+
+    // track covers only part of animation
+    std::vector<KeyFrame<glm::vec3>> positions;
+    for (uint32_t i = 1; i <= 5; ++i) {
+        const auto t = static_cast<float>(i);
+        positions.emplace_back(glm::vec3{t * 2.0f, 0.0f, 0.0f}, static_cast<double>(i));
+    }
+
+    AnimationNode node {positions, {}, {}, bone};
+    AnimationNode compressed {positions, {}, {}, bone};
+    compressed.compress({});
+
+    REQUIRE(node.positionLerp(0.0)->x == 2.0f);
+    REQUIRE(node.positionLerp(-3.0)->x == 2.0f);
+    REQUIRE(node.positionLerp(6.0)->x == 10.0f);
+    REQUIRE(node.positionLerp(42.0)->x == 10.0f);
+
+    for (double t : {-3.0, 0.0, 1.0, 2.5, 5.0, 6.0, 42.0}) {
+        REQUIRE(compressed.positionLerp(t)->x == Catch::Approx(node.positionLerp(t)->x).margin(0.001f));
+    }
+}
+
+TEST_CASE("Compressed AnimationNode has no keyframes to find") {
+    Bone bone {0, "bone", glm::mat4{1.0f}};
+
+    std::vector<KeyFrame<glm::vec3>> positions;
+    positions.emplace_back(glm::vec3{0.0f}, 0.0);
+    positions.emplace_back(glm::vec3{1.0f}, 1.0);
+
+    AnimationNode node {positions, {}, {}, bone};
+    node.compress({});
+
+    size_t cursor {};
+    REQUIRE_THROWS_AS(node.findPositionKeyframe(0.5), std::logic_error);
+    REQUIRE_THROWS_AS(node.findPositionKeyframe(0.5, cursor), std::logic_error);
+    REQUIRE_THROWS_AS(node.findRotationKeyframe(0.5), std::logic_error);
+    REQUIRE_THROWS_AS(node.findScalingKeyframe(0.5, cursor), std::logic_error);
+}
@@ -0,0 +1,104 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+
+using namespace Limitless;
+
+TEST_CASE("PoseCache quantizes animation time") {
+    PoseCache cache {30.0};
+    Animation animation {"walk", 100.0, 25.0, {}};
+
+    // 25 ticks per second, 30 frames per second
+    REQUIRE(cache.getFrame(animation, 0.0) == 0);
+    REQUIRE(cache.getFrame(animation, 25.0) == 30);
+    REQUIRE(cache.getFrame(animation, 25.0 + 0.5) == 30);
+    REQUIRE(cache.getFrameTime(animation, 30) == Catch::Approx(25.0));
+    REQUIRE(cache.getFrameTime(animation, cache.getFrame(animation, 42.3)) <= 42.3);
+}
+
+TEST_CASE("PoseCache counts hits and misses") {
+    PoseCache cache;
+    Animation walk {"walk", 100.0, 25.0, {}};
+    Animation run {"run", 100.0, 25.0, {}};
+
+    REQUIRE(cache.find(walk, 3) == nullptr);
+
+    auto pose = std::make_shared<PoseCache::Pose>();
+    pose->bone_transform.resize(4, glm::mat4{1.0f});
+    cache.insert(walk, 3, pose);
+
+    REQUIRE(cache.find(walk, 3) == pose);
+    REQUIRE(cache.find(walk, 4) == nullptr);
+    REQUIRE(cache.find(run, 3) == nullptr);
+
+    REQUIRE(cache.getStats().hits == 1);
+    REQUIRE(cache.getStats().misses == 3);
+
+    cache.resetStats();
+    REQUIRE(cache.getStats().hits == 0);
+    REQUIRE(cache.getStats().misses == 0);
+}
+
+TEST_CASE("PoseCache drops poses that are no longer used") {
+    PoseCache cache;
+    Animation walk {"walk", 100.0, 25.0, {}};
+
+    auto pose = std::make_shared<PoseCache::Pose>();
+    cache.insert(walk, 0, pose);
+    pose.reset();
+
+    REQUIRE(cache.find(walk, 0) == nullptr);
+    REQUIRE(cache.size() == 0);
+
+    std::vector<std::shared_ptr<PoseCache::Pose>> alive;
+    for (uint64_t frame = 0; frame < 1000; ++frame) {
+        auto p = std::make_shared<PoseCache::Pose>();
+        cache.insert(walk, frame, p);
+        if (frame % 10 == 0) {
+            alive.emplace_back(std::move(p));
+        }
+    }
+
+    REQUIRE(cache.size() < 1000);
+    for (uint64_t frame = 0; frame < 1000; frame += 10) {
+        REQUIRE(cache.find(walk, frame) == alive[frame / 10]);
+    }
+}
+
+TEST_CASE("PoseCache reuses released poses") {
+    PoseCache cache;
+    Animation walk {"walk", 100.0, 25.0, {}};
+
+    auto pose = cache.acquire();
+    pose->bone_transform.resize(4, glm::mat4{2.0f});
+    const auto* address = pose.get();
+    cache.insert(walk, 0, pose);
+
+    REQUIRE(cache.getStats().allocations == 1);
+    REQUIRE(cache.getReleasedCount() == 0);
+
+    pose.reset();
+    REQUIRE(cache.getReleasedCount() == 1);
+    REQUIRE(cache.find(walk, 0) == nullptr);
+
+    // released pose comes back with its contents, caller overwrites them
+    auto reused = cache.acquire();
+    REQUIRE(reused.get() == address);
+    REQUIRE(reused->bone_transform.size() == 4);
+    REQUIRE(cache.getStats().allocations == 1);
+
+    auto another = cache.acquire();
+    REQUIRE(another.get() != address);
+    REQUIRE(cache.getStats().allocations == 2);
+}
+
+TEST_CASE("PoseCache releases poses that outlive it") {
+    std::shared_ptr<PoseCache::Pose> pose;
+    {
+        PoseCache cache;
+        pose = cache.acquire();
+    }
+
+    pose.reset();
+    SUCCEED();
+}
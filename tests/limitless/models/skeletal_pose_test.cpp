@@ -0,0 +1,185 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/models/skeletal_model.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+
+using namespace Limitless;
+
+namespace {
+    glm::mat4 translation(const glm::vec3& v) {
+        return glm::translate(glm::mat4{1.0f}, v);
+    }
+
+    glm::fquat aroundZ(float angle) {
+        return glm::angleAxis(angle, glm::vec3{0.0f, 0.0f, 1.0f});
+    }
+
+    /**
+     * Two skeleton trees, bones are listed in different order than they are in trees:
+     *
+     * hips(2) -> spine(0) -> head(4)
+     *                     -> helper(5) -> hand(1)
+     * prop(3) -> prop_tip(6)
+     *
+     * spine, helper and prop are not animated, helper is not a joint
+     */
+    std::shared_ptr<SkeletalModel> makeModel() {
+        std::vector<Bone> bones;
+        bones.emplace_back(0, "spine", translation({0.0f, 1.0f, 0.0f}) * glm::mat4_cast(aroundZ(0.3f)), glm::mat4{1.0f});
+        bones.emplace_back(1, "hand", translation({0.5f, 0.0f, 0.0f}), translation({-1.0f, -2.0f, 0.0f}));
+        bones.emplace_back(2, "hips", glm::mat4{1.0f}, glm::mat4{1.0f});
+        bones.emplace_back(3, "prop", translation({5.0f, 0.0f, 2.0f}) * glm::scale(glm::mat4{1.0f}, glm::vec3{2.0f}), glm::mat4{1.0f});
+        bones.emplace_back(4, "head", translation({0.0f, 0.5f, 0.0f}), translation({0.0f, -1.5f, 0.0f}));
+        bones.emplace_back(5, "helper", translation({1.0f, 0.0f, 0.0f}), glm::mat4{1.0f});
+        bones.emplace_back(6, "prop_tip", translation({0.0f, 0.0f, 1.0f}), glm::mat4{1.0f});
+
+        // joints are numbered independently of bones
+        bones[0].joint_index = 3;
+        bones[1].joint_index = 0;
+        bones[2].joint_index = 5;
+        bones[3].joint_index = 1;
+        bones[4].joint_index = 4;
+        bones[6].joint_index = 2;
+
+        // fallbacks of channels that animate only some components
+        bones[4].position = glm::vec3{0.0f, 0.5f, 0.0f};
+        bones[1].rotation = aroundZ(-0.4f);
+        bones[1].scale = glm::vec3{1.5f};
+
+        std::vector<AnimationNode> nodes;
+        nodes.emplace_back(
+            std::vector<KeyFrame<glm::vec3>>{{glm::vec3{0.0f}, 0.0}, {glm::vec3{0.0f, 0.0f, 4.0f}, 10.0}},
+            std::vector<KeyFrame<glm::fquat>>{},
+            std::vector<KeyFrame<glm::vec3>>{},
+            bones[6]
+        );
+        nodes.emplace_back(
+            std::vector<KeyFrame<glm::vec3>>{},
+            std::vector<KeyFrame<glm::fquat>>{{aroundZ(0.0f), 0.0}, {aroundZ(1.0f), 5.0}, {aroundZ(0.5f), 10.0}},
+            std::vector<KeyFrame<glm::vec3>>{{glm::vec3{1.0f}, 0.0}, {glm::vec3{0.5f, 1.0f, 2.0f}, 10.0}},
+            bones[4]
+        );
+        nodes.emplace_back(
+            std::vector<KeyFrame<glm::vec3>>{{glm::vec3{0.0f}, 0.0}, {glm::vec3{2.0f, 0.0f, 0.0f}, 4.0}, {glm::vec3{2.0f, 3.0f, 0.0f}, 10.0}},
+            std::vector<KeyFrame<glm::fquat>>{{aroundZ(0.0f), 0.0}, {aroundZ(-0.8f), 10.0}},
+            std::vector<KeyFrame<glm::vec3>>{},
+            bones[2]
+        );
+        nodes.emplace_back(
+            std::vector<KeyFrame<glm::vec3>>{{glm::vec3{0.2f, 0.0f, 0.0f}, 2.0}, {glm::vec3{0.8f, 0.0f, 0.0f}, 8.0}},
+            std::vector<KeyFrame<glm::fquat>>{},
+            std::vector<KeyFrame<glm::vec3>>{},
+            bones[1]
+        );
+
+        std::vector<Animation> animations;
+        animations.emplace_back("wave", 10.0, 25.0, std::move(nodes));
+
+        Tree<uint32_t> hips {2};
+        auto& spine = hips.add(0);
+        spine.add(4);
+        spine.add(5).add(1);
+
+        Tree<uint32_t> prop {3};
+        prop.add(6);
+
+        std::unordered_map<std::string, uint32_t> bone_map;
+        for (const auto& bone : bones) {
+            bone_map.emplace(bone.name, bone.index);
+        }
+
+        std::vector<Tree<uint32_t>> skeletons;
+        skeletons.emplace_back(std::move(hips));
+        skeletons.emplace_back(std::move(prop));
+
+        return std::make_shared<SkeletalModel>(
+            std::vector<std::shared_ptr<AbstractMesh>>{},
+            std::vector<std::shared_ptr<ms::Material>>{},
+            std::move(bones),
+            std::move(bone_map),
+            std::move(skeletons),
+            std::move(animations),
+            "rig"
+        );
+    }
+
+    /**
+     * Recursive evaluation over skeleton trees that looks animation node up by its bone
+     */
+    void evaluateTree(
+        const SkeletalModel& model,
+        const Animation& animation,
+        double time,
+        const Tree<uint32_t>& node,
+        const glm::mat4& parent_transform,
+        std::vector<glm::mat4>& bone_transform
+    ) {
+        const auto& bone = model.getBones()[*node];
+        const auto anim_node = std::find_if(animation.nodes.begin(), animation.nodes.end(), [&] (const auto& n) {
+            return &n.bone == &bone;
+        });
+
+        auto local_transform = bone.node_transform;
+        if (anim_node != animation.nodes.end()) {
+            const auto position = anim_node->positionLerp(time).value_or(bone.position);
+            const auto rotation = anim_node->rotationLerp(time).value_or(bone.rotation);
+            const auto scale = anim_node->scalingLerp(time).value_or(bone.scale);
+
+            local_transform = translation(position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4{1.0f}, scale);
+        }
+
+        const auto global_transform = parent_transform * local_transform;
+        if (bone.joint_index) {
+            bone_transform[*bone.joint_index] = global_transform * bone.offset_matrix;
+        }
+
+        for (const auto& child : node) {
+            evaluateTree(model, animation, time, child, global_transform, bone_transform);
+        }
+    }
+
+    void requireEqual(const glm::mat4& actual, const glm::mat4& expected) {
+        for (glm::length_t c = 0; c < 4; ++c) {
+            for (glm::length_t r = 0; r < 4; ++r) {
+                REQUIRE(actual[c][r] == Catch::Approx(expected[c][r]).margin(1e-5f));
+            }
+        }
+    }
+}
+
+TEST_CASE("Flattened skeleton keeps parents before children") {
+    const auto model = makeModel();
+    const auto& flat = model->getFlatSkeleton();
+
+    REQUIRE(flat.size() == model->getBones().size());
+    for (size_t i = 0; i < flat.size(); ++i) {
+        REQUIRE(flat[i].parent < static_cast<int32_t>(i));
+    }
+
+    REQUIRE(std::count_if(flat.begin(), flat.end(), [] (const auto& node) { return node.parent < 0; }) == 2);
+}
+
+TEST_CASE("SkeletalModel evaluatePose matches recursive evaluation of skeleton trees") {
+    const auto model = makeModel();
+    const auto& animation = model->getAnimations()[0];
+
+    for (const auto time : {-1.0, 0.0, 1.0, 2.5, 4.0, 5.0, 7.3, 10.0, 12.0}) {
+        std::vector<AnimationNode::Cursor> cursors(animation.nodes.size());
+        std::vector<glm::mat4> global_transform(model->getFlatSkeleton().size());
+        std::vector<glm::mat4> bone_transform(6, glm::mat4{0.0f});
+
+        const auto sampled = model->evaluatePose(animation, time, cursors, global_transform, bone_transform);
+
+        std::vector<glm::mat4> expected(6, glm::mat4{0.0f});
+        for (const auto& skeleton : model->getSkeletonTrees()) {
+            evaluateTree(*model, animation, time, skeleton, glm::mat4{1.0f}, expected);
+        }
+
+        REQUIRE(sampled == animation.nodes.size());
+        for (size_t joint = 0; joint < expected.size(); ++joint) {
+            requireEqual(bone_transform[joint], expected[joint]);
+        }
+    }
+}
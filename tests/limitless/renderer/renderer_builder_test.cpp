@@ -0,0 +1,70 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/renderer/renderer.hpp>
+#include <limitless/renderer/sceneupdate_pass.hpp>
+#include <limitless/renderer/skinning_pass.hpp>
+#include <limitless/renderer/particle_simulation_pass.hpp>
+#include <limitless/renderer/shadow_pass.hpp>
+#include <limitless/renderer/local_shadow_pass.hpp>
+#include <limitless/core/context.hpp>
+
+using namespace Limitless;
+
+namespace {
+    template<typename RenderPass>
+    size_t getIndex(const Renderer& renderer) {
+        const auto& passes = renderer.getPasses();
+        for (size_t i = 0; i < passes.size(); ++i) {
+            if (dynamic_cast<RenderPass*>(passes[i].get())) {
+                return i;
+            }
+        }
+
+        FAIL("pass is not present");
+        return passes.size();
+    }
+
+    void checkDeferredOrder(const Renderer& renderer) {
+        REQUIRE(renderer.getPasses().size() == 5);
+        REQUIRE(getIndex<SceneUpdatePass>(renderer) == 0);
+        REQUIRE(getIndex<SkinningPass>(renderer) == 1);
+        REQUIRE(getIndex<ParticleSimulationPass>(renderer) == 2);
+        REQUIRE(getIndex<DirectionalShadowPass>(renderer) == 3);
+        REQUIRE(getIndex<LocalShadowPass>(renderer) == 4);
+    }
+}
+
+TEST_CASE("Renderer keeps order of passes enabled at runtime") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+
+    RendererSettings settings;
+    auto renderer = Renderer::builder()
+            .settings(settings)
+            .addSceneUpdatePass()
+            .build();
+
+    // passes are enabled in reverse order of pipeline
+    settings.local_shadow_maps = true;
+    renderer->update(settings);
+
+    settings.cascade_shadow_maps = true;
+    renderer->update(settings);
+
+    settings.gpu_particles = true;
+    renderer->update(settings);
+
+    settings.compute_skinning = true;
+    renderer->update(settings);
+
+    checkDeferredOrder(*renderer);
+
+    // pass enabled again returns to its place
+    settings.gpu_particles = false;
+    renderer->update(settings);
+    REQUIRE_FALSE(renderer->isPresent<ParticleSimulationPass>());
+
+    settings.gpu_particles = true;
+    renderer->update(settings);
+
+    checkDeferredOrder(*renderer);
+}
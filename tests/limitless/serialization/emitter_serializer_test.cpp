@@ -0,0 +1,118 @@
+#include "../catch_amalgamated.hpp"
+#include "../fx/effects.hpp"
+
+#include <limitless/serialization/emitter_serializer.hpp>
+#include <limitless/serialization/material_serializer.hpp>
+#include <limitless/serialization/module_serializer.hpp>
+#include <limitless/util/bytebuffer.hpp>
+#include <limitless/core/context.hpp>
+
+using namespace Limitless;
+using namespace Limitless::fx;
+using namespace LimitlessTest;
+
+namespace {
+    // emitter as it was written before fixed bounds and levels of detail were stored
+    ByteBuffer serializeVersion1(const SpriteEmitter& emitter) {
+        ByteBuffer buffer;
+        buffer << std::string {"sparks"}
+               << uint8_t {0x1}
+               << emitter.getType()
+               << emitter.getLocalPosition()
+               << emitter.getLocalRotation()
+               << emitter.getLocalSpace()
+               << emitter.getSpawn()
+               << emitter.getDuration().count()
+               << emitter.getMaterial()
+               << emitter.getModules();
+        return buffer;
+    }
+
+    ByteBuffer serialize(const SpriteEmitter& emitter) {
+        ByteBuffer buffer;
+        EmitterSerializer serializer;
+        buffer << std::string {"sparks"}
+               << serializer.serialize(emitter);
+        return buffer;
+    }
+
+    // every effect is loaded to its own assets, so names of loaded materials do not collide
+    SpriteEmitter& deserialize(Assets& assets, const ByteBuffer& buffer) {
+        auto reader = buffer.reader();
+
+        EffectBuilder builder {assets};
+        builder.create("sparks");
+
+        EmitterSerializer serializer;
+        serializer.deserialize(assets, reader, builder);
+
+        REQUIRE(reader.remaining() == 0);
+
+        return builder.build()->get<SpriteEmitter>("sparks");
+    }
+
+    void checkEqual(const SpriteEmitter& lhs, const SpriteEmitter& rhs) {
+        REQUIRE(lhs.getLocalPosition() == rhs.getLocalPosition());
+        REQUIRE(lhs.getLocalSpace() == rhs.getLocalSpace());
+        REQUIRE(lhs.getSpawn().mode == rhs.getSpawn().mode);
+        REQUIRE(lhs.getSpawn().max_count == rhs.getSpawn().max_count);
+        REQUIRE(lhs.getSpawn().spawn_rate == rhs.getSpawn().spawn_rate);
+        REQUIRE(lhs.getDuration() == rhs.getDuration());
+        REQUIRE(lhs.getModules().size() == rhs.getModules().size());
+        REQUIRE(lhs.getMaterial().getName() == rhs.getMaterial().getName());
+    }
+}
+
+TEST_CASE("EmitterSerializer reads emitter of version 1") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+
+    auto& source = Effects::sparks(assets)->get<SpriteEmitter>("sparks");
+    source.getLocalPosition() = glm::vec3{1.0f, 2.0f, 3.0f};
+    source.getDuration() = std::chrono::duration<float>{2.0f};
+
+    Assets old_assets {"../../assets"};
+    auto& old = deserialize(old_assets, serializeVersion1(source));
+
+    checkEqual(old, source);
+
+    // fields version 1 did not have are left unset
+    REQUIRE_FALSE(old.getFixedBounds());
+    REQUIRE_FALSE(old.getLod());
+
+    // and it is written back in current version
+    Assets new_assets {"../../assets"};
+    auto& loaded = deserialize(new_assets, serialize(old));
+
+    checkEqual(loaded, source);
+    REQUIRE_FALSE(loaded.getFixedBounds());
+    REQUIRE_FALSE(loaded.getLod());
+}
+
+TEST_CASE("EmitterSerializer round trips fixed bounds and levels of detail") {
+    Context context = {"Title", {1, 1}, nullptr, {{WindowHint::Hint::Visible, false}}};
+    Assets assets {"../../assets"};
+
+    auto& source = Effects::sparks(assets)->get<SpriteEmitter>("sparks");
+    source.getFixedBounds() = Box {glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{4.0f}};
+
+    EmitterLod lod;
+    lod.levels[2] = {0.25f, 0.5f};
+    lod.levels[2].drop(ModuleType::InitialColor);
+    source.getLod() = lod;
+
+    Assets loaded_assets {"../../assets"};
+    auto& loaded = deserialize(loaded_assets, serialize(source));
+
+    checkEqual(loaded, source);
+
+    REQUIRE(loaded.getFixedBounds());
+    REQUIRE(loaded.getFixedBounds()->center == glm::vec3{0.0f, 1.0f, 0.0f});
+    REQUIRE(loaded.getFixedBounds()->size == glm::vec3{4.0f});
+
+    REQUIRE(loaded.getLod());
+    REQUIRE(loaded.getLod()->levels[2].spawn_rate == 0.25f);
+    REQUIRE(loaded.getLod()->levels[2].max_count == 0.5f);
+    REQUIRE(loaded.getLod()->levels[2].isDropped(ModuleType::InitialColor));
+    REQUIRE_FALSE(loaded.getLod()->levels[1].isDropped(ModuleType::InitialColor));
+}
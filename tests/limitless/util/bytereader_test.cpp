@@ -0,0 +1,82 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/util/bytebuffer.hpp>
+
+using namespace Limitless;
+
+TEST_CASE("ByteReader reads values in order they were written") {
+    ByteBuffer buffer;
+
+    const std::vector<float> values {1.0f, 2.0f, 3.0f};
+    const std::map<std::string, int> map {{"a", 1}, {"b", 2}};
+
+    buffer << std::string{"name"} << 15.3f << values << map << uint8_t{7};
+
+    auto reader = buffer.reader();
+
+    std::string name;
+    float f {};
+    std::vector<float> values1;
+    std::map<std::string, int> map1;
+    uint8_t u {};
+
+    reader >> name >> f >> values1 >> map1 >> u;
+
+    CHECK(name == "name");
+    CHECK(f == 15.3f);
+    CHECK(values1 == values);
+    CHECK(map1 == map);
+    CHECK(u == 7);
+    CHECK(reader.empty());
+}
+
+TEST_CASE("ByteReader views strings without copying") {
+    ByteBuffer buffer;
+    buffer << std::string{"vertex code"} << std::string{};
+
+    auto reader = buffer.reader();
+    const auto code = reader.viewString();
+    const auto empty = reader.viewString();
+
+    CHECK(code == "vertex code");
+    CHECK(reinterpret_cast<const std::byte*>(code.data()) == buffer.data() + sizeof(size_t));
+    CHECK(empty.empty());
+    CHECK(reader.tell() == buffer.size());
+}
+
+TEST_CASE("ByteReader throws on reading past the end") {
+    ByteBuffer buffer;
+    buffer << uint16_t{1};
+
+    auto reader = buffer.reader();
+
+    uint32_t value {};
+    CHECK_THROWS_AS(reader >> value, std::out_of_range);
+    CHECK(reader.tell() == 0);
+
+    // string that claims more bytes than left
+    ByteBuffer truncated;
+    truncated << size_t{100} << uint32_t{0};
+
+    auto string_reader = truncated.reader();
+    std::string str;
+    CHECK_THROWS_AS(string_reader >> str, std::out_of_range);
+}
+
+TEST_CASE("ByteBuffer continues reading where previous read stopped") {
+    ByteBuffer buffer;
+    buffer << std::string{"shrek!"} << 1 << 2;
+
+    std::string str;
+    int a {};
+    buffer >> str >> a;
+
+    int b {};
+    buffer >> b;
+
+    CHECK(str == "shrek!");
+    CHECK(a == 1);
+    CHECK(b == 2);
+    CHECK(buffer.reader().empty());
+    CHECK(buffer.size() == sizeof(size_t) + 6 + 2 * sizeof(int));
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <limitless/camera.hpp>
+#include <limitless/util/box.hpp>
+
+namespace LimitlessTest {
+    using namespace Limitless;
+
+    class Views {
+    public:
+        /**
+         * Point on view direction of camera, negative distance is behind it
+         */
+        static inline glm::vec3 pointInFront(const Camera& camera, float distance) {
+            return camera.getPosition() + camera.getFront() * distance;
+        }
+
+        /**
+         * Unit box centered on view direction of camera
+         */
+        static inline Box boxInFront(const Camera& camera, float distance) {
+            return {pointInFront(camera, distance), glm::vec3{1.0f}};
+        }
+    };
+}
@@ -0,0 +1,61 @@
+#include "../catch_amalgamated.hpp"
+
+#include <limitless/util/bytebuffer.hpp>
+#include <limitless/util/mapped_file.hpp>
+
+#include <fstream>
+
+using namespace Limitless;
+
+namespace {
+    fs::path writeFile(const std::string& name, const ByteBuffer& buffer) {
+        const auto path = fs::temp_directory_path() / name;
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        return path;
+    }
+}
+
+TEST_CASE("MappedFile is parsed in place") {
+    ByteBuffer buffer;
+    buffer << std::string{"material"} << 42 << std::vector<float>{1.0f, 2.0f};
+
+    const auto path = writeFile("limitless_mapped_file_test.bin", buffer);
+
+    {
+        const MappedFile file {path};
+        REQUIRE(file.size() == buffer.size());
+
+        auto reader = file.reader();
+
+        std::string name;
+        int value {};
+        std::vector<float> values;
+        reader >> name >> value >> values;
+
+        CHECK(name == "material");
+        CHECK(value == 42);
+        CHECK(values == std::vector<float>{1.0f, 2.0f});
+        CHECK(reader.empty());
+    }
+
+    fs::remove(path);
+}
+
+TEST_CASE("MappedFile of empty file has nothing to read") {
+    const auto path = writeFile("limitless_mapped_file_empty_test.bin", ByteBuffer{});
+
+    {
+        const MappedFile file {path};
+        CHECK(file.size() == 0);
+        CHECK(file.reader().empty());
+    }
+
+    fs::remove(path);
+}
+
+TEST_CASE("MappedFile throws on missing file") {
+    CHECK_THROWS_AS(MappedFile {fs::temp_directory_path() / "limitless_mapped_file_missing.bin"}, std::runtime_error);
+}
@@ -0,0 +1,32 @@
+#include "../catch_amalgamated.hpp"
+#include "camera.hpp"
+
+#include <limitless/util/screen_size.hpp>
+
+#include <limits>
+
+using namespace Limitless;
+using namespace LimitlessTest;
+
+TEST_CASE("ScreenSize decreases with distance") {
+    Camera camera {{800, 800}};
+    const ScreenSize screen_size {camera};
+
+    const auto close = screen_size.get(Views::boxInFront(camera, 5.0f));
+    const auto distant = screen_size.get(Views::boxInFront(camera, 10.0f));
+
+    REQUIRE(close == Catch::Approx(distant * 2.0f));
+
+    // camera inside of box
+    REQUIRE(screen_size.get(Views::boxInFront(camera, 0.5f)) == std::numeric_limits<float>::max());
+}
+
+TEST_CASE("ScreenSize level is index of the first reached threshold") {
+    const std::array<float, 3> thresholds {0.25f, 0.1f, 0.04f};
+
+    REQUIRE(ScreenSize::getLevel(1.0f, thresholds) == 0);
+    REQUIRE(ScreenSize::getLevel(0.25f, thresholds) == 0);
+    REQUIRE(ScreenSize::getLevel(0.2f, thresholds) == 1);
+    REQUIRE(ScreenSize::getLevel(0.05f, thresholds) == 2);
+    REQUIRE(ScreenSize::getLevel(0.01f, thresholds) == 3);
+}
@@ -0,0 +1,35 @@
+#include <limitless/loaders/pack_archive.hpp>
+
+#include <iostream>
+
+using namespace Limitless;
+
+// packs files of directories to archive, names of files are relative to their directory:
+//
+//      limitless-pack assets.lpak assets/
+//
+// archive is mounted to the same directory to be used by loaders:
+//
+//      assets.archives.mount("assets.lpak", "assets/");
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <archive> <directory>..." << std::endl;
+        return 1;
+    }
+
+    try {
+        PackWriter writer;
+        for (int i = 2; i < argc; ++i) {
+            writer.addDirectory(argv[i]);
+        }
+        writer.write(argv[1]);
+
+        const PackArchive archive {argv[1]};
+        std::cout << "packed " << archive.size() << " files to " << argv[1] << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}